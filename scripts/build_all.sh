@@ -15,6 +15,7 @@ BUILD_TYPE="${BUILD_TYPE:-Release}"
 CC="${CC:-clang}"
 ENABLE_SANITIZERS="${ENABLE_SANITIZERS:-true}"
 ENABLE_COVERAGE="${ENABLE_COVERAGE:-false}"
+ENABLE_PROFILE="${ENABLE_PROFILE:-false}"
 PARALLEL_JOBS="${PARALLEL_JOBS:-$(nproc 2>/dev/null || sysctl -n hw.ncpu 2>/dev/null || echo 4)}"
 
 # 로그 함수들
@@ -60,101 +61,52 @@ setup_build_env() {
     export CC
     export ENABLE_SANITIZERS
     export ENABLE_COVERAGE
+    export ENABLE_PROFILE
     
     log_success "Build environment configured"
 }
 
-# 공통 라이브러리 빌드
+# 빌드할 변형들 (fuzzer, standalone, afl, coverage)
+BUILD_VARIANTS="${BUILD_VARIANTS:-fuzzer standalone afl}"
+
+# 최상위 Makefile 호출 (하니스/변형 전체를 하나의 잡서버로 병렬 빌드)
+run_make() {
+    make --no-print-directory -j"$PARALLEL_JOBS" \
+        BUILD_TYPE="$BUILD_TYPE" \
+        CC="$CC" \
+        ENABLE_SANITIZERS="$ENABLE_SANITIZERS" \
+        ENABLE_COVERAGE="$ENABLE_COVERAGE" \
+        ENABLE_PROFILE="$ENABLE_PROFILE" \
+        BUILD_STATS_FILE="$PWD/$BUILD_STATS_FILE" \
+        VARIANTS="$BUILD_VARIANTS" \
+        "$@"
+}
+
+# 공통 라이브러리 빌드 (변형별 libcfs_common.a)
 build_common_libs() {
     log_info "Building common libraries..."
     local start_time=$(date +%s)
     
-    cd src/common
-    
-    # 구문 검사
-    $CC -Wall -Wextra -std=c99 -fsyntax-only utils.c
-    
-    cd - >/dev/null
+    run_make common
     
     local duration=$(($(date +%s) - start_time))
     record_build_stat "common_libs" "SUCCESS" "$duration"
-    log_success "Common libraries validated (${duration}s)"
+    log_success "Common libraries built (${duration}s)"
 }
 
-# MM Load 하니스 빌드
-build_mm_load() {
-    log_info "Building MM Load harness..."
-    local start_time=$(date +%s)
+# 하니스 빌드 (src/harnesses/*/Makefile 자동 탐색, 하니스/변형 간 병렬)
+build_harnesses() {
+    local targets=("$@")
+    local label="${targets[*]:-all harnesses}"
     
-    cd src/harnesses/mm_load
-    
-    # 병렬 빌드 실행
-    make -j"$PARALLEL_JOBS" all \
-        BUILD_TYPE="$BUILD_TYPE" \
-        CC="$CC" \
-        ENABLE_SANITIZERS="$ENABLE_SANITIZERS" \
-        ENABLE_COVERAGE="$ENABLE_COVERAGE"
-    
-    # AFL++ 버전도 빌드 (가능한 경우)
-    make afl \
-        BUILD_TYPE="$BUILD_TYPE" \
-        CC="$CC" \
-        ENABLE_SANITIZERS="$ENABLE_SANITIZERS" \
-        ENABLE_COVERAGE="$ENABLE_COVERAGE" || log_warning "AFL++ build skipped (not available)"
+    log_info "Building $label (variants: $BUILD_VARIANTS)..."
+    local start_time=$(date +%s)
     
-    cd - >/dev/null
+    run_make "${targets[@]:-all}"
     
     local duration=$(($(date +%s) - start_time))
-    record_build_stat "mm_load" "SUCCESS" "$duration"
-    log_success "MM Load harness built (${duration}s)"
-}
-
-# MM Dump 하니스 빌드 (향후 확장용)
-build_mm_dump() {
-    if [ -f "src/harnesses/mm_dump/Makefile" ]; then
-        log_info "Building MM Dump harness..."
-        local start_time=$(date +%s)
-        
-        cd src/harnesses/mm_dump
-        make -j"$PARALLEL_JOBS" all \
-            BUILD_TYPE="$BUILD_TYPE" \
-            CC="$CC" \
-            ENABLE_SANITIZERS="$ENABLE_SANITIZERS" \
-            ENABLE_COVERAGE="$ENABLE_COVERAGE"
-        cd - >/dev/null
-        
-        local duration=$(($(date +%s) - start_time))
-        record_build_stat "mm_dump" "SUCCESS" "$duration"
-        log_success "MM Dump harness built (${duration}s)"
-    else
-        log_warning "MM Dump harness not implemented yet, skipping..."
-    fi
-}
-
-# 다른 MM 하니스들 빌드 (향후 확장)
-build_other_harnesses() {
-    local harnesses=("mm_peek" "mm_fill")
-    
-    for harness in "${harnesses[@]}"; do
-        if [ -f "src/harnesses/$harness/Makefile" ]; then
-            log_info "Building $harness harness..."
-            local start_time=$(date +%s)
-            
-            cd "src/harnesses/$harness"
-            make -j"$PARALLEL_JOBS" all \
-                BUILD_TYPE="$BUILD_TYPE" \
-                CC="$CC" \
-                ENABLE_SANITIZERS="$ENABLE_SANITIZERS" \
-                ENABLE_COVERAGE="$ENABLE_COVERAGE"
-            cd - >/dev/null
-            
-            local duration=$(($(date +%s) - start_time))
-            record_build_stat "$harness" "SUCCESS" "$duration"
-            log_success "$harness harness built (${duration}s)"
-        else
-            log_warning "$harness harness not implemented yet, skipping..."
-        fi
-    done
+    record_build_stat "harnesses" "SUCCESS" "$duration"
+    log_success "Harnesses built (${duration}s)"
 }
 
 # 단위 테스트 빌드
@@ -206,10 +158,14 @@ verify_builds() {
     log_info "Verifying builds..."
     
     local build_dir="bin/${BUILD_TYPE,,}"  # 소문자로 변환
-    local required_binaries=(
-        "$build_dir/mm_load_fuzzer"
-        "$build_dir/mm_load_test"
-    )
+    local required_binaries=()
+    local harness_dir harness
+    for harness_dir in src/harnesses/*/; do
+        [ -f "$harness_dir/Makefile" ] || continue
+        harness=$(basename "$harness_dir")
+        [[ " $BUILD_VARIANTS " == *" fuzzer "* ]] && required_binaries+=("$build_dir/${harness}_fuzzer")
+        [[ " $BUILD_VARIANTS " == *" standalone "* ]] && required_binaries+=("$build_dir/${harness}_test")
+    done
     
     local missing_count=0
     for binary in "${required_binaries[@]}"; do
@@ -246,15 +202,19 @@ print_build_summary() {
     log_info "Compiler: $CC"
     log_info "Sanitizers: $ENABLE_SANITIZERS"
     log_info "Coverage: $ENABLE_COVERAGE"
+    log_info "Stage profiler: $ENABLE_PROFILE"
     log_info "Parallel Jobs: $PARALLEL_JOBS"
     log_info "Total Duration: ${total_duration}s"
     
     if [ -f "$BUILD_STATS_FILE" ]; then
         echo
-        log_info "Component Build Times:"
-        tail -10 "$BUILD_STATS_FILE" | while IFS= read -r line; do
-            echo "  $line"
-        done
+        log_info "Slowest Build Targets (this run):"
+        awk -v since="$(date -d "@$START_TIME" '+%Y-%m-%d %H:%M:%S' 2>/dev/null || echo 0)" \
+            'substr($0, 1, 19) >= since' "$BUILD_STATS_FILE" | \
+            sed -n 's/.* - \(.*\): \(.*\) (\([0-9.]*\)s)$/\3 \1 \2/p' | \
+            sort -rn | head -10 | while read -r secs name status; do
+                printf "  %8ss  %-40s %s\n" "$secs" "$name" "$status"
+            done
     fi
     
     echo
@@ -291,7 +251,10 @@ CFS MM Fuzzer 빌드 스크립트
     CC                  사용할 컴파일러 (기본: clang)
     ENABLE_SANITIZERS   Sanitizer 활성화 (기본: true)
     ENABLE_COVERAGE     Coverage 활성화 (기본: false)
+    ENABLE_PROFILE      단계별 프로파일러 계측 (기본: false)
     PARALLEL_JOBS       병렬 작업 수 (기본: CPU 코어 수)
+    BUILD_VARIANTS      빌드할 변형들 (기본: "fuzzer standalone afl")
+    CCACHE              컴파일러 캐시 (기본: 자동 감지, 빈 값이면 비활성화)
 
 옵션:
     -h, --help          이 도움말 표시
@@ -299,6 +262,7 @@ CFS MM Fuzzer 빌드 스크립트
     --release           Release 빌드 강제
     --no-sanitizers     Sanitizer 비활성화
     --coverage          Coverage 활성화
+    --profile           단계별 프로파일러 계측 포함
     --verify-only       빌드 검증만 수행
     --clean             빌드 전 정리
     --create-seeds      시드 파일 생성
@@ -382,6 +346,10 @@ main() {
                 ENABLE_COVERAGE="true"
                 shift
                 ;;
+            --profile)
+                ENABLE_PROFILE="true"
+                shift
+                ;;
             --verify-only)
                 verify_only=true
                 shift
@@ -439,26 +407,14 @@ main() {
     
     if [ -n "$target" ]; then
         # 특정 타겟만 빌드
-        case "$target" in
-            mm_load)
-                build_mm_load
-                ;;
-            mm_dump)
-                build_mm_dump
-                ;;
-            mm_peek|mm_fill)
-                build_other_harnesses
-                ;;
-            *)
-                log_error "Unknown target: $target"
-                exit 1
-                ;;
-        esac
+        if [ ! -f "src/harnesses/$target/Makefile" ]; then
+            log_error "Unknown target: $target"
+            exit 1
+        fi
+        build_harnesses "$target"
     else
         # 전체 빌드
-        build_mm_load
-        build_mm_dump
-        build_other_harnesses
+        build_harnesses
         build_unit_tests
         build_integration_tests
     fi
@@ -0,0 +1,261 @@
+#!/bin/bash
+# scripts/campaign.sh - 여러 하니스에 코어를 나눠 주는 적응형 퍼징 캠페인
+#
+# 사용법: campaign.sh [옵션]
+#   --targets LIST     쉼표로 구분한 하니스 (기본: mm_load,mm_dump,mm_fill)
+#   --cores N          전체 워커 수 = CPU 예산 (기본: CPU 수)
+#   --rss-mb MB        전체 RSS 예산 (기본: 코어당 1024)
+#   --hours H          전체 캠페인 시간, 소수 가능 (기본: 48)
+#   --epoch SECONDS    재배분 주기 (기본: 1800)
+#   --stall SECONDS    이 시간 동안 커버리지가 늘지 않으면 세션 종료 (기본: 600)
+#   --build-type TYPE  빌드 타입 (기본: release)
+#   --out DIR          결과 디렉토리 (기본: results/campaign_<시각>)
+#
+# 에포크마다 하니스별로 run_fuzzing.sh 세션 하나를 배정된 코어 수만큼의 워커로 돌리고
+# 세션 시계열 (stats/timeseries.csv) 의 ft 증가량을 코어·초 당 속도로 환산한다.
+#   - 정체한 하니스 (--stall 로 조기 종료되었거나 ft 증가 없음) 는 코퍼스를
+#     libFuzzer -merge=1 로 증류하고 한 에포크 쉰 뒤 코어 하나로 다시 시도한다.
+#   - 나머지 코어는 아직 커버리지가 늘고 있는 하니스에 속도 비례로 배분한다.
+#   - 워커당 -rss_limit_mb 는 RSS 예산 / 코어 수이며, 에포크 중 합계 RSS 가 예산을
+#     넘으면 RSS 가 가장 큰 하니스 세션을 먼저 끝낸다.
+#
+# 에포크별 결정은 <out>/campaign.csv
+# (epoch,target,cores,seconds,cov,ft,ft_gain,rate,stalled) 에 남는다.
+
+set -e
+
+TARGETS="mm_load,mm_dump,mm_fill"
+CORES="$(nproc 2>/dev/null || echo 1)"
+RSS_BUDGET=""
+HOURS=48
+EPOCH=1800
+STALL=600
+BUILD_TYPE="${BUILD_TYPE:-release}"
+OUT_DIR=""
+
+usage() {
+    sed -n '2,25s/^# \{0,1\}//p' "$0"
+    exit "${1:-0}"
+}
+
+log() { echo "[campaign $(date +%H:%M:%S)] $*"; }
+
+while [ $# -gt 0 ]; do
+    case "$1" in
+        --targets) TARGETS="$2"; shift 2 ;;
+        --cores) CORES="$2"; shift 2 ;;
+        --rss-mb) RSS_BUDGET="$2"; shift 2 ;;
+        --hours) HOURS="$2"; shift 2 ;;
+        --epoch) EPOCH="$2"; shift 2 ;;
+        --stall) STALL="$2"; shift 2 ;;
+        --build-type) BUILD_TYPE="$2"; shift 2 ;;
+        --out) OUT_DIR="$2"; shift 2 ;;
+        -h|--help) usage 0 ;;
+        *) echo "Unknown option: $1" >&2; usage 2 ;;
+    esac
+done
+
+cd "$(dirname "$0")/.."
+
+IFS=, read -r -a TARGET_LIST <<< "$TARGETS"
+RSS_BUDGET="${RSS_BUDGET:-$((CORES * 1024))}"
+WORKER_RSS=$((RSS_BUDGET / CORES))
+OUT_DIR="${OUT_DIR:-results/campaign_$(date +%Y%m%d_%H%M%S)}"
+DEADLINE=$(( $(date +%s) + $(awk -v h="$HOURS" 'BEGIN { print int(h * 3600) }') ))
+
+for t in "${TARGET_LIST[@]}"; do
+    if [ ! -x "bin/$BUILD_TYPE/${t}_fuzzer" ]; then
+        echo "Fuzzer binary not found: bin/$BUILD_TYPE/${t}_fuzzer" >&2
+        exit 1
+    fi
+done
+
+mkdir -p "$OUT_DIR"
+echo "epoch,target,cores,seconds,cov,ft,ft_gain,rate,stalled" > "$OUT_DIR/campaign.csv"
+
+declare -A cores rate resting session_pid
+
+# 시작은 균등 배분
+for i in "${!TARGET_LIST[@]}"; do
+    t="${TARGET_LIST[$i]}"
+    cores[$t]=$(( CORES / ${#TARGET_LIST[@]} + (i < CORES % ${#TARGET_LIST[@]} ? 1 : 0) ))
+    rate[$t]=0
+    resting[$t]=0
+done
+
+# 세션 결과 디렉토리 (run_fuzzing.sh 가 RESULTS_ROOT 아래에 하니스별로 만든다)
+session_dir() {
+    ls -d "$1/${2}_libfuzzer_"* 2>/dev/null | tail -n 1
+}
+
+# 코퍼스 증류: 커버리지를 유지하는 최소 입력만 새 디렉토리로 모으고 기존 코퍼스는 보관
+distill_corpus() {
+    local t="$1" epoch_dir="$2"
+    local corpus="corpus/$t"
+    local distilled="$epoch_dir/${t}_distilled"
+
+    [ -d "$corpus" ] || return 0
+    mkdir -p "$distilled"
+    if "bin/$BUILD_TYPE/${t}_fuzzer" -merge=1 -rss_limit_mb="$WORKER_RSS" \
+            "$distilled" "$corpus" > "$epoch_dir/${t}_distill.log" 2>&1; then
+        local before=$(find "$corpus" -type f | wc -l)
+        local after=$(find "$distilled" -type f | wc -l)
+        mv "$corpus" "$epoch_dir/${t}_corpus_before"
+        mv "$distilled" "$corpus"
+        log "$t: distilled corpus $before -> $after inputs"
+    else
+        log "$t: distillation failed, keeping corpus (see ${t}_distill.log)"
+        rm -rf "$distilled"
+    fi
+}
+
+# 에포크 동안 전체 RSS 예산 감시
+enforce_rss() {
+    local epoch_dir="$1"
+
+    while true; do
+        local alive=0
+        local t
+        for t in "${!session_pid[@]}"; do
+            kill -0 "${session_pid[$t]}" 2>/dev/null && alive=$((alive + 1))
+        done
+        [ "$alive" -gt 0 ] || break
+        sleep 10
+
+        local total=0 worst="" worst_rss=0
+        for t in "${!session_pid[@]}"; do
+            kill -0 "${session_pid[$t]}" 2>/dev/null || continue
+            local ts="$(session_dir "$epoch_dir" "$t")/stats/timeseries.csv"
+            [ -s "$ts" ] || continue
+            local rss=$(tail -n 1 "$ts" | cut -d, -f9)
+            total=$((total + rss))
+            if [ "$rss" -gt "$worst_rss" ]; then
+                worst="$t"
+                worst_rss="$rss"
+            fi
+        done
+
+        if [ "$total" -gt "$RSS_BUDGET" ] && [ -n "$worst" ]; then
+            log "RSS ${total}MB over budget ${RSS_BUDGET}MB, stopping $worst (${worst_rss}MB)"
+            # 이 캠페인의 그 세션 (프로세스 그룹) 만 끝낸다
+            kill -TERM -- -"${session_pid[$worst]}" 2>/dev/null || true
+            unset "session_pid[$worst]"
+        fi
+    done
+}
+
+# 실행 중인 세션 전부 종료 (캠페인이 중단될 때)
+stop_sessions() {
+    local t
+    for t in "${!session_pid[@]}"; do
+        kill -TERM -- -"${session_pid[$t]}" 2>/dev/null || true
+    done
+}
+
+# 다음 에포크 코어 배분: 정체한 하니스는 쉬고, 나머지는 1 코어씩 + 남는 코어를 속도 비례로
+reallocate() {
+    local eligible=() t
+    for t in "${TARGET_LIST[@]}"; do
+        [ "${resting[$t]}" -eq 0 ] && eligible+=("$t")
+        cores[$t]=0
+    done
+
+    # 모두 정체했으면 (증류 후) 전부 다시 균등하게
+    if [ ${#eligible[@]} -eq 0 ]; then
+        for t in "${TARGET_LIST[@]}"; do
+            resting[$t]=0
+        done
+        eligible=("${TARGET_LIST[@]}")
+    fi
+
+    # 속도 순 정렬, 코어보다 하니스가 많으면 빠른 쪽부터
+    mapfile -t eligible < <(for t in "${eligible[@]}"; do echo "${rate[$t]} $t"; done | sort -k1,1nr | cut -d' ' -f2 | head -n "$CORES")
+
+    local spare=$((CORES - ${#eligible[@]}))
+    local total_rate=0
+    for t in "${eligible[@]}"; do
+        cores[$t]=1
+        total_rate=$((total_rate + rate[$t]))
+    done
+
+    local given=0
+    if [ "$total_rate" -gt 0 ]; then
+        for t in "${eligible[@]}"; do
+            local share=$((spare * rate[$t] / total_rate))
+            cores[$t]=$((cores[$t] + share))
+            given=$((given + share))
+        done
+    fi
+
+    # 나머지는 속도가 높은 순서로 하나씩
+    local i=0
+    while [ "$given" -lt "$spare" ]; do
+        t="${eligible[$((i % ${#eligible[@]}))]}"
+        cores[$t]=$((cores[$t] + 1))
+        given=$((given + 1))
+        i=$((i + 1))
+    done
+}
+
+# 세션은 각자의 프로세스 그룹에서 돌므로 캠페인 중단 시 직접 끝낸다
+trap 'stop_sessions; exit 130' INT TERM
+
+log "Targets: ${TARGET_LIST[*]}, $CORES cores, ${RSS_BUDGET}MB RSS, ${HOURS}h, epoch ${EPOCH}s"
+
+epoch=1
+while [ "$(date +%s)" -lt "$DEADLINE" ]; do
+    epoch_dir="$OUT_DIR/epoch_$epoch"
+    mkdir -p "$epoch_dir"
+    length=$(( DEADLINE - $(date +%s) ))
+    [ "$length" -gt "$EPOCH" ] && length="$EPOCH"
+
+    session_pid=()
+    for t in "${TARGET_LIST[@]}"; do
+        if [ "${cores[$t]}" -eq 0 ]; then
+            # 쉬는 하니스는 다음 에포크에 코어 하나로 복귀
+            [ "${resting[$t]}" -gt 0 ] && resting[$t]=0
+            continue
+        fi
+        log "epoch $epoch: $t x${cores[$t]} for ${length}s"
+        # setsid: 세션마다 새 프로세스 그룹 (그룹 ID = 세션 PID) 으로 띄워 이 세션만 골라 끝낼 수 있게 한다
+        # (작업 제어가 없는 스크립트의 백그라운드 자식은 그룹 리더가 아니므로 setsid 는 fork 없이 exec 한다)
+        RESULTS_ROOT="$epoch_dir" STALL_TIMEOUT="$STALL" \
+            setsid ./scripts/run_fuzzing.sh --target "$t" --jobs "${cores[$t]}" --time "$length" \
+            --memory "$WORKER_RSS" --build-type "$BUILD_TYPE" > "$epoch_dir/$t.log" 2>&1 &
+        session_pid[$t]=$!
+    done
+
+    started=$(date +%s)
+    ran=("${!session_pid[@]}")
+    enforce_rss "$epoch_dir"
+    wait || true
+    elapsed=$(( $(date +%s) - started ))
+    [ "$elapsed" -gt 0 ] || elapsed=1
+
+    for t in "${ran[@]}"; do
+        dir="$(session_dir "$epoch_dir" "$t")"
+        ts="$dir/stats/timeseries.csv"
+        cov=0; ft=0; gain=0; stalled=0
+        if [ -s "$ts" ]; then
+            read -r cov ft gain < <(awk -F, 'NR == 2 { ft0 = $6 } NR > 1 { cov = $5; ft = $6 } END { print cov + 0, ft + 0, ft - ft0 }' "$ts")
+        fi
+        [ -f "$dir/stats/stalled" ] && stalled=1
+        [ "$gain" -le 0 ] && stalled=1
+
+        # ft 증가량 / (코어·시간), 정수 비교를 위해 ×3600
+        rate[$t]=$(( gain * 3600 / (cores[$t] * elapsed) ))
+        echo "$epoch,$t,${cores[$t]},$elapsed,$cov,$ft,$gain,${rate[$t]},$stalled" >> "$OUT_DIR/campaign.csv"
+        log "epoch $epoch: $t cov $cov ft $ft (+$gain, ${rate[$t]} ft/core-hour)$([ $stalled -eq 1 ] && echo ', stalled')"
+
+        if [ "$stalled" -eq 1 ]; then
+            resting[$t]=1
+            rate[$t]=0
+            distill_corpus "$t" "$epoch_dir"
+        fi
+    done
+
+    reallocate
+    epoch=$((epoch + 1))
+done
+
+log "Campaign finished: $OUT_DIR/campaign.csv"
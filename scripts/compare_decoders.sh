@@ -0,0 +1,81 @@
+#!/bin/bash
+# scripts/compare_decoders.sh - mm_load 입력 디코더별 커버리지 증가 비교
+#
+# 사용법: compare_decoders.sh [runs] [seed]
+# 빈 코퍼스에서 같은 시드/실행 횟수로 libFuzzer 를 디코더마다 한 번씩 돌리고
+# "#N ... cov: X ft: Y" 진행 줄을 decoder,execs,cov,ft CSV 로 모아
+# 실행 횟수 체크포인트별 커버리지를 나란히 출력한다.
+#
+# libFuzzer 가 없는 툴체인(gcc 만 있는 환경)에서는 프로세스 내 퍼징 루프
+# (mtfuzz 변형, -fsanitize-coverage=trace-pc) 를 워커 1개로 같은 방식으로 돌린다.
+# 두 엔진의 cov/ft 는 계측 방식이 달라 서로 비교할 수 없고, 디코더 간 비교만 의미가 있다.
+#
+# 환경 변수:
+#   BUILD_TYPE   빌드 타입 (기본: release)
+#   ENGINE       fuzzer | mtfuzz (기본: fuzzer 바이너리가 있으면 fuzzer, 없으면 mtfuzz)
+#   OUT_DIR      결과 디렉토리 (기본: results/decoder_compare_<시각>)
+
+set -e
+
+RUNS="${1:-2000000}"
+SEED="${2:-1}"
+BUILD_TYPE="${BUILD_TYPE:-release}"
+if [ -z "$ENGINE" ]; then
+    ENGINE=fuzzer
+    [ -x "bin/${BUILD_TYPE}/mm_load_fuzzer" ] || ENGINE=mtfuzz
+fi
+FUZZER_BIN="bin/${BUILD_TYPE}/mm_load_${ENGINE}"
+OUT_DIR="${OUT_DIR:-results/decoder_compare_$(date +%Y%m%d_%H%M%S)}"
+CSV="$OUT_DIR/coverage.csv"
+
+if [ ! -x "$FUZZER_BIN" ]; then
+    echo "Fuzzer binary not found: $FUZZER_BIN (make VARIANTS=$ENGINE)" >&2
+    exit 1
+fi
+
+mkdir -p "$OUT_DIR"
+echo "decoder,execs,cov,ft" > "$CSV"
+
+for decoder in legacy typed; do
+    corpus="$OUT_DIR/corpus_$decoder"
+    log="$OUT_DIR/$decoder.log"
+    rm -rf "$corpus"
+    mkdir -p "$corpus"
+
+    echo "Running $decoder decoder ($ENGINE, $RUNS runs, seed $SEED)..."
+    if [ "$ENGINE" = "mtfuzz" ]; then
+        CFS_DECODER="$decoder" "$FUZZER_BIN" -fuzz -workers=1 "$corpus" \
+            -seed="$SEED" -runs="$RUNS" -max_len=4096 \
+            > "$log" 2>&1 || true
+    else
+        CFS_DECODER="$decoder" "$FUZZER_BIN" "$corpus" \
+            -seed="$SEED" -runs="$RUNS" -max_len=4096 -print_final_stats=1 \
+            > "$log" 2>&1 || true
+    fi
+
+    # "#12345	NEW    cov: 210 ft: 480 corp: ..." 형식의 진행 줄
+    awk -v d="$decoder" '
+        /^#[0-9]+/ && / cov: / {
+            execs = substr($1, 2)
+            for (i = 2; i < NF; i++) {
+                if ($i == "cov:") cov = $(i + 1)
+                if ($i == "ft:") ft = $(i + 1)
+            }
+            print d "," execs "," cov "," ft
+        }' "$log" >> "$CSV"
+done
+
+# 체크포인트마다 그 시점까지의 마지막 값 비교
+echo
+printf "%12s %12s %12s %12s %12s\n" "execs" "legacy cov" "typed cov" "legacy ft" "typed ft"
+for checkpoint in 1000 10000 100000 1000000 "$RUNS"; do
+    [ "$checkpoint" -gt "$RUNS" ] && continue
+    row=$(awk -F, -v c="$checkpoint" '
+        NR > 1 && $2 <= c { cov[$1] = $3; ft[$1] = $4 }
+        END { printf "%12s %12s %12s %12s", cov["legacy"] + 0, cov["typed"] + 0, ft["legacy"] + 0, ft["typed"] + 0 }
+    ' "$CSV")
+    printf "%12s %s\n" "$checkpoint" "$row"
+done
+
+echo
+echo "CSV: $CSV"
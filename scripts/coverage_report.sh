@@ -0,0 +1,170 @@
+#!/bin/bash
+# scripts/coverage_report.sh - 대규모 코퍼스 source-based coverage 보고서
+#
+# 사용법: coverage_report.sh [옵션] <코퍼스 디렉토리|팩>...
+#   -t, --target NAME     하니스 (기본: mm_load)
+#   -b, --bin PATH        llvmcov 변형 바이너리 (기본: bin/<빌드>/<하니스>_test_llvmcov, 없으면 빌드)
+#   -j, --shards N        병렬 재생 프로세스 수 (기본: CPU 수)
+#   -o, --out DIR         결과 디렉토리 (기본: results/coverage_<하니스>)
+#   -i, --incremental     지난 보고서 이후 추가된 입력만 재생해 기존 프로파일에 병합
+#
+# 입력 목록을 샤드로 나눠 샤드마다 한 프로세스가 -list= 로 프로세스 내 재생하고
+# (입력마다 프로세스를 띄우지 않음), 샤드별 .profraw 를 llvm-profdata 로 병렬 병합한다.
+# 결과:
+#   summary.txt      파일별 요약
+#   functions.txt    함수별 영역/줄/분기 커버리지
+#   branches.txt     하니스 소스의 분기별 실행 횟수 (검증 분기 확인용)
+#   uncovered_branches.txt  실행되지 않은 분기 방향이 있는 줄 (file:line, 방향 수)
+#   html/            HTML 보고서
+#
+# 증분 상태 ($OUT/state) 는 바이너리가 바뀌면 버리고 전체를 다시 재생한다.
+#
+# 환경 변수:
+#   BUILD_TYPE      빌드 타입 (기본: release)
+#   LLVM_PROFDATA   llvm-profdata 경로 (기본: llvm-profdata)
+#   LLVM_COV        llvm-cov 경로 (기본: llvm-cov)
+
+set -e
+
+TARGET="mm_load"
+BIN=""
+SHARDS="$(nproc 2>/dev/null || echo 1)"
+OUT_DIR=""
+INCREMENTAL=false
+BUILD_TYPE="${BUILD_TYPE:-release}"
+LLVM_PROFDATA="${LLVM_PROFDATA:-llvm-profdata}"
+LLVM_COV="${LLVM_COV:-llvm-cov}"
+CORPORA=()
+
+usage() {
+    sed -n '2,26s/^# \{0,1\}//p' "$0"
+    exit "${1:-0}"
+}
+
+while [ $# -gt 0 ]; do
+    case "$1" in
+        -t|--target) TARGET="$2"; shift 2 ;;
+        -b|--bin) BIN="$2"; shift 2 ;;
+        -j|--shards) SHARDS="$2"; shift 2 ;;
+        -o|--out) OUT_DIR="$2"; shift 2 ;;
+        -i|--incremental) INCREMENTAL=true; shift ;;
+        -h|--help) usage 0 ;;
+        -*) echo "Unknown option: $1" >&2; usage 2 ;;
+        *) CORPORA+=("$1"); shift ;;
+    esac
+done
+
+[ ${#CORPORA[@]} -eq 0 ] && usage 2
+
+ROOT_DIR="$(cd "$(dirname "$0")/.." && pwd)"
+OUT_DIR="${OUT_DIR:-results/coverage_$TARGET}"
+STATE_DIR="$OUT_DIR/state"
+WORK_DIR="$OUT_DIR/work"
+
+if [ -z "$BIN" ]; then
+    BIN="$ROOT_DIR/bin/$BUILD_TYPE/${TARGET}_test_llvmcov"
+    if [ ! -x "$BIN" ]; then
+        echo "Building $TARGET llvmcov variant..."
+        make -C "$ROOT_DIR/src/harnesses/$TARGET" llvmcov BUILD_TYPE="$BUILD_TYPE"
+    fi
+fi
+
+for tool in "$LLVM_PROFDATA" "$LLVM_COV"; do
+    if ! command -v "$tool" >/dev/null 2>&1; then
+        echo "$tool not found (set LLVM_PROFDATA / LLVM_COV)" >&2
+        exit 1
+    fi
+done
+
+[ "$SHARDS" -ge 1 ] 2>/dev/null || SHARDS=1
+
+mkdir -p "$STATE_DIR"
+rm -rf "$WORK_DIR"
+mkdir -p "$WORK_DIR"
+
+# 전체 입력 목록 (디렉토리는 파일 단위, 팩은 파일 하나로 샤드에 배정)
+for corpus in "${CORPORA[@]}"; do
+    if [ -d "$corpus" ]; then
+        find "$(cd "$corpus" && pwd)" -type f ! -name '.*'
+    elif [ -f "$corpus" ]; then
+        echo "$(cd "$(dirname "$corpus")" && pwd)/$(basename "$corpus")"
+    else
+        echo "Skipping missing corpus: $corpus" >&2
+    fi
+done | LC_ALL=C sort -u > "$WORK_DIR/all.list"
+
+# 증분 모드: 같은 바이너리로 이미 재생한 입력은 건너뜀
+BIN_HASH="$(sha1sum "$BIN" | cut -d' ' -f1)"
+if $INCREMENTAL && [ -f "$STATE_DIR/merged.profdata" ] && [ -f "$STATE_DIR/replayed.list" ] \
+        && [ "$(cat "$STATE_DIR/binary.sha1" 2>/dev/null)" = "$BIN_HASH" ]; then
+    LC_ALL=C comm -13 "$STATE_DIR/replayed.list" "$WORK_DIR/all.list" > "$WORK_DIR/new.list"
+    PREVIOUS="$STATE_DIR/merged.profdata"
+else
+    $INCREMENTAL && echo "No reusable state for this binary, replaying the full corpus"
+    cp "$WORK_DIR/all.list" "$WORK_DIR/new.list"
+    rm -f "$STATE_DIR/replayed.list" "$STATE_DIR/merged.profdata"
+    PREVIOUS=""
+fi
+
+TOTAL=$(wc -l < "$WORK_DIR/all.list")
+NEW=$(wc -l < "$WORK_DIR/new.list")
+echo "Inputs: $TOTAL total, $NEW to replay ($SHARDS shards)"
+
+if [ "$NEW" -gt 0 ]; then
+    [ "$SHARDS" -gt "$NEW" ] && SHARDS="$NEW"
+    split -n "l/$SHARDS" -d -a 4 "$WORK_DIR/new.list" "$WORK_DIR/shard-"
+
+    # 샤드마다 한 프로세스, 프로세스 내에서는 단일 스레드 재생
+    START=$(date +%s)
+    pids=()
+    for shard in "$WORK_DIR"/shard-[0-9][0-9][0-9][0-9]; do
+        [ -s "$shard" ] || continue
+        LLVM_PROFILE_FILE="$shard.profraw" CFS_WATCHDOG=0 \
+            "$BIN" -j 1 -list="$shard" > "$shard.log" 2>&1 &
+        pids+=($!)
+    done
+    failed=0
+    for pid in "${pids[@]}"; do
+        wait "$pid" || failed=$((failed + 1))
+    done
+    echo "Replayed $NEW inputs in $(( $(date +%s) - START ))s"
+    [ "$failed" -gt 0 ] && echo "Warning: $failed shard(s) reported unreadable inputs or failures (see $WORK_DIR/*.log)"
+
+    # 샤드 프로파일 (+ 이전 병합 결과) 병렬 병합
+    "$LLVM_PROFDATA" merge -sparse -num-threads="$SHARDS" \
+        "$WORK_DIR"/shard-*.profraw ${PREVIOUS:+"$PREVIOUS"} -o "$WORK_DIR/merged.profdata"
+    mv "$WORK_DIR/merged.profdata" "$STATE_DIR/merged.profdata"
+
+    LC_ALL=C sort -u -m "$WORK_DIR/new.list" ${PREVIOUS:+"$STATE_DIR/replayed.list"} \
+        > "$WORK_DIR/replayed.list"
+    mv "$WORK_DIR/replayed.list" "$STATE_DIR/replayed.list"
+    echo "$BIN_HASH" > "$STATE_DIR/binary.sha1"
+fi
+
+PROFDATA="$STATE_DIR/merged.profdata"
+if [ ! -f "$PROFDATA" ]; then
+    echo "No profile data to report" >&2
+    exit 1
+fi
+
+HARNESS_SOURCES=("$ROOT_DIR/src/harnesses/$TARGET"/*.c)
+SOURCES=("${HARNESS_SOURCES[@]}" "$ROOT_DIR"/src/common/*.c)
+
+"$LLVM_COV" report "$BIN" -instr-profile="$PROFDATA" "${SOURCES[@]}" > "$OUT_DIR/summary.txt"
+"$LLVM_COV" report "$BIN" -instr-profile="$PROFDATA" -show-functions "${SOURCES[@]}" \
+    > "$OUT_DIR/functions.txt"
+"$LLVM_COV" show "$BIN" -instr-profile="$PROFDATA" -show-branches=count \
+    -num-threads="$SHARDS" "${HARNESS_SOURCES[@]}" > "$OUT_DIR/branches.txt"
+"$LLVM_COV" show "$BIN" -instr-profile="$PROFDATA" -show-branches=count -format=html \
+    -num-threads="$SHARDS" -output-dir="$OUT_DIR/html" "${SOURCES[@]}"
+
+# lcov BRDA:<line>,<block>,<branch>,<taken> 중 taken 이 0 또는 "-" 인 분기 방향
+"$LLVM_COV" export "$BIN" -instr-profile="$PROFDATA" -format=lcov "${HARNESS_SOURCES[@]}" | awk -F'[:,]' '
+    /^SF:/ { file = substr($0, 4); sub(".*/", "", file) }
+    /^BRDA:/ && ($5 == "-" || $5 == "0") { print file ":" $2 }
+' | LC_ALL=C sort -t: -k1,1 -k2,2n | uniq -c | awk '{ print $2 " (" $1 " uncovered)" }' \
+    > "$OUT_DIR/uncovered_branches.txt"
+
+tail -n 1 "$OUT_DIR/summary.txt"
+echo "Uncovered branch sites: $(wc -l < "$OUT_DIR/uncovered_branches.txt")"
+echo "Reports in $OUT_DIR (functions.txt, branches.txt, uncovered_branches.txt, html/)"
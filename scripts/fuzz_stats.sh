@@ -0,0 +1,189 @@
+#!/bin/bash
+# scripts/fuzz_stats.sh - 퍼징 세션 커버리지 시계열 수집/병합
+#
+# 사용법:
+#   fuzz_stats.sh record <worker> <csv> [start_us]
+#       표준 입력의 libFuzzer 출력을 그대로 표준 출력으로 넘기면서
+#       "#N ... cov: X ft: Y corp: C/B exec/s: E rss: RMb" 진행 줄을
+#       도착 시각과 함께 CSV 에 한 줄씩 추가한다.
+#   fuzz_stats.sh afl <plot_data> <worker> <csv>
+#       AFL++ plot_data 를 같은 CSV 형식으로 변환한다.
+#   fuzz_stats.sh merge <out_prefix> [bucket_s] <csv>...
+#       워커별 CSV 를 bucket_s (기본 10) 초 단위로 병합해
+#       <out_prefix>.csv 와 <out_prefix>.json 을 쓴다.
+#       각 구간에서 워커마다 마지막 값을 쓰고, 실행 수/속도/RSS 는 합,
+#       cov/ft/코퍼스는 최대값 (워커들이 코퍼스 디렉토리를 공유하므로).
+#   fuzz_stats.sh stalled <merged_csv> <window_s>
+#       마지막 window_s 초 동안 cov 와 ft 가 늘지 않았으면 0 을 반환한다.
+#
+# 워커별 CSV 열: time_s,worker,execs,exec_per_sec,cov,ft,corpus,corpus_bytes,rss_mb
+# 병합 CSV 열:   time_s,workers,execs,exec_per_sec,cov,ft,corpus,corpus_bytes,rss_mb
+
+set -e
+
+CSV_HEADER="time_s,worker,execs,exec_per_sec,cov,ft,corpus,corpus_bytes,rss_mb"
+
+usage() {
+    sed -n '2,24s/^# \{0,1\}//p' "$0"
+    exit "${1:-0}"
+}
+
+# 진행 줄 하나를 CSV 행으로 (fork 없이 bash 정규식만 사용)
+record() {
+    local worker="$1" csv="$2" start_us="${3:-${EPOCHREALTIME/./}}"
+    local line now execs eps cov ft corp corp_bytes rss unit
+
+    [ -s "$csv" ] || echo "$CSV_HEADER" > "$csv"
+    exec 3>>"$csv"
+
+    while IFS= read -r line || [ -n "$line" ]; do
+        printf '%s\n' "$line"
+        [[ $line =~ ^#([0-9]+)[[:space:]] && $line == *" cov: "* ]] || continue
+        execs="${BASH_REMATCH[1]}"
+
+        cov=0; ft=0; corp=0; corp_bytes=0; eps=0; rss=0
+        [[ $line =~ \ cov:\ ([0-9]+) ]] && cov="${BASH_REMATCH[1]}"
+        [[ $line =~ \ ft:\ ([0-9]+) ]] && ft="${BASH_REMATCH[1]}"
+        [[ $line =~ \ exec/s:\ ([0-9]+) ]] && eps="${BASH_REMATCH[1]}"
+        [[ $line =~ \ rss:\ ([0-9]+)Mb ]] && rss="${BASH_REMATCH[1]}"
+        if [[ $line =~ \ corp:\ ([0-9]+)/([0-9]+)([KMG]?)b ]]; then
+            corp="${BASH_REMATCH[1]}"
+            corp_bytes="${BASH_REMATCH[2]}"
+            unit="${BASH_REMATCH[3]}"
+            case "$unit" in
+                K) corp_bytes=$((corp_bytes << 10)) ;;
+                M) corp_bytes=$((corp_bytes << 20)) ;;
+                G) corp_bytes=$((corp_bytes << 30)) ;;
+            esac
+        fi
+
+        now="${EPOCHREALTIME/./}"
+        printf '%d.%03d,%s,%s,%s,%s,%s,%s,%s,%s\n' \
+            $(((now - start_us) / 1000000)) $((((now - start_us) / 1000) % 1000)) \
+            "$worker" "$execs" "$eps" "$cov" "$ft" "$corp" "$corp_bytes" "$rss" >&3
+    done
+
+    exec 3>&-
+}
+
+# AFL++ plot_data (헤더 이름으로 열을 찾아 버전 차이를 흡수)
+afl_convert() {
+    local plot="$1" worker="$2" csv="$3"
+
+    [ -s "$csv" ] || echo "$CSV_HEADER" > "$csv"
+    awk -F', *' -v w="$worker" '
+        NR == 1 {
+            sub(/^# */, "")
+            for (i = 1; i <= NF; i++) col[$i] = i
+            t = col["relative_time"] ? col["relative_time"] : col["unix_time"]
+            next
+        }
+        /^#/ { next }
+        {
+            if (NR == 2) t0 = col["relative_time"] ? 0 : $t
+            edges = col["edges_found"] ? $(col["edges_found"]) : 0
+            corpus = col["corpus_count"] ? $(col["corpus_count"]) : $(col["paths_total"])
+            execs = col["total_execs"] ? $(col["total_execs"]) : 0
+            eps = col["execs_per_sec"] ? $(col["execs_per_sec"]) : 0
+            printf "%s,%s,%d,%d,%d,%d,%d,0,0\n", $t - t0, w, execs, eps, edges, edges, corpus
+        }' "$plot" >> "$csv"
+}
+
+merge() {
+    local prefix="$1" bucket="$2"
+    shift 2
+
+    awk -F, -v bucket="$bucket" -v csv="$prefix.csv" -v json="$prefix.json" '
+        FNR == 1 { next }
+        {
+            b = int($1 / bucket)
+            if (b > last) last = b
+            count[b, $2]++
+            # 구간 안에서 워커별 마지막 값
+            execs[b, $2] = $3; eps[b, $2] = $4; cov[b, $2] = $5; ft[b, $2] = $6
+            corp[b, $2] = $7; bytes[b, $2] = $8; rss[b, $2] = $9
+            if (!($2 in seen)) { seen[$2] = 1; workers[++nworkers] = $2 }
+        }
+        END {
+            print "time_s,workers,execs,exec_per_sec,cov,ft,corpus,corpus_bytes,rss_mb" > csv
+            printf "[" > json
+            first = 1
+            for (b = 0; b <= last; b++) {
+                s_execs = s_eps = m_cov = m_ft = m_corp = m_bytes = s_rss = active = 0
+                for (i = 1; i <= nworkers; i++) {
+                    w = workers[i]
+                    if ((b, w) in count) {
+                        cur_execs[w] = execs[b, w]; cur_eps[w] = eps[b, w]
+                        cur_cov[w] = cov[b, w]; cur_ft[w] = ft[b, w]
+                        cur_corp[w] = corp[b, w]; cur_bytes[w] = bytes[b, w]
+                        cur_rss[w] = rss[b, w]; alive[w] = 1
+                        active++
+                    } else {
+                        # 이번 구간에 진행 줄이 없으면 속도는 0 으로 보고 나머지는 유지
+                        cur_eps[w] = 0
+                    }
+                    if (!alive[w]) continue
+                    s_execs += cur_execs[w]; s_eps += cur_eps[w]; s_rss += cur_rss[w]
+                    if (cur_cov[w] > m_cov) m_cov = cur_cov[w]
+                    if (cur_ft[w] > m_ft) m_ft = cur_ft[w]
+                    if (cur_corp[w] > m_corp) m_corp = cur_corp[w]
+                    if (cur_bytes[w] > m_bytes) m_bytes = cur_bytes[w]
+                }
+                if (!active) continue
+                t = (b + 1) * bucket
+                printf "%d,%d,%d,%d,%d,%d,%d,%d,%d\n", t, active, s_execs, s_eps, m_cov, m_ft, m_corp, m_bytes, s_rss > csv
+                printf "%s\n  {\"time_s\": %d, \"workers\": %d, \"execs\": %d, \"exec_per_sec\": %d, \"cov\": %d, \"ft\": %d, \"corpus\": %d, \"corpus_bytes\": %d, \"rss_mb\": %d}", \
+                    first ? "" : ",", t, active, s_execs, s_eps, m_cov, m_ft, m_corp, m_bytes, s_rss > json
+                first = 0
+            }
+            print "\n]" > json
+        }' "$@"
+}
+
+# 마지막 window 초 동안 cov/ft 증가가 없으면 정체
+stalled() {
+    local csv="$1" window="$2"
+
+    [ -s "$csv" ] || return 1
+    awk -F, -v window="$window" '
+        NR == 1 { next }
+        { t[NR] = $1; cov[NR] = $5; ft[NR] = $6; n = NR }
+        END {
+            if (n < 2 || t[n] < window) exit 1
+            for (i = n; i > 1 && t[i] > t[n] - window; i--) ;
+            exit (cov[n] > cov[i] || ft[n] > ft[i]) ? 1 : 0
+        }' "$csv"
+}
+
+case "${1:-}" in
+    record)
+        [ $# -ge 3 ] || usage 2
+        record "$2" "$3" "$4"
+        ;;
+    afl)
+        [ $# -eq 4 ] || usage 2
+        afl_convert "$2" "$3" "$4"
+        ;;
+    merge)
+        [ $# -ge 3 ] || usage 2
+        prefix="$2"
+        shift 2
+        bucket=10
+        if [[ $1 =~ ^[0-9]+$ ]]; then
+            bucket="$1"
+            shift
+        fi
+        [ $# -ge 1 ] || usage 2
+        merge "$prefix" "$bucket" "$@"
+        ;;
+    stalled)
+        [ $# -eq 3 ] || usage 2
+        stalled "$2" "$3"
+        ;;
+    -h|--help)
+        usage 0
+        ;;
+    *)
+        usage 2
+        ;;
+esac
@@ -24,6 +24,15 @@ TIME_LIMIT="${TIME_LIMIT:-$DEFAULT_TIME}"
 MEMORY_LIMIT="${MEMORY_LIMIT:-$DEFAULT_MEMORY}"
 PARALLEL_JOBS="${PARALLEL_JOBS:-$DEFAULT_JOBS}"
 BUILD_TYPE="${BUILD_TYPE:-release}"
+CORPUS_PACK="${CORPUS_PACK:-}"
+CORPUS_WORKDIR="${CORPUS_WORKDIR:-/dev/shm}"
+REPLAY_BASELINE="${REPLAY_BASELINE:-}"
+WATCHDOG_DIR="${CFS_WATCHDOG_DIR:-}"
+PROFILE_DIR="${CFS_PROFILE_DIR:-}"
+RESULTS_ROOT="${RESULTS_ROOT:-results}"
+STATS_BUCKET="${STATS_BUCKET:-10}"
+STALL_TIMEOUT="${STALL_TIMEOUT:-0}"
+STALL_RESEED=false
 
 # 로그 함수들
 log_info() { echo -e "${BLUE}[INFO]${NC} $1"; }
@@ -34,8 +43,14 @@ log_error() { echo -e "${RED}[ERROR]${NC} $1"; }
 # 퍼징 결과 디렉토리 설정
 setup_results_dir() {
     local timestamp=$(date +%Y%m%d_%H%M%S)
-    RESULTS_DIR="results/${TARGET}_${FUZZER}_${timestamp}"
-    mkdir -p "$RESULTS_DIR"/{crashes,hangs,queue,logs}
+    RESULTS_DIR="${RESULTS_ROOT}/${TARGET}_${FUZZER}_${timestamp}"
+    mkdir -p "$RESULTS_DIR"/{crashes,hangs,timeouts,queue,logs,stats}
+    
+    # 실행별 워치독이 예산 초과 입력과 보고서를 저장할 위치
+    export CFS_WATCHDOG_DIR="${WATCHDOG_DIR:-$RESULTS_DIR/timeouts}"
+    
+    # 단계별 프로파일러 빌드 (ENABLE_PROFILE=true) 가 종료 시 느린 입력을 쓸 위치
+    export CFS_PROFILE_DIR="${PROFILE_DIR:-$RESULTS_DIR/profile}"
     
     log_info "Results directory: $RESULTS_DIR"
 }
@@ -53,7 +68,10 @@ check_binaries() {
                 afl)
                     FUZZER_BIN="$BIN_DIR/mm_load_afl"
                     ;;
-                standalone)
+                inproc)
+                    FUZZER_BIN="$BIN_DIR/mm_load_mtfuzz"
+                    ;;
+                standalone|replay)
                     FUZZER_BIN="$BIN_DIR/mm_load_test"
                     ;;
                 *)
@@ -71,7 +89,10 @@ check_binaries() {
                 afl)
                     FUZZER_BIN="$BIN_DIR/mm_dump_afl"
                     ;;
-                standalone)
+                inproc)
+                    FUZZER_BIN="$BIN_DIR/mm_dump_mtfuzz"
+                    ;;
+                standalone|replay)
                     FUZZER_BIN="$BIN_DIR/mm_dump_test"
                     ;;
                 *)
@@ -81,6 +102,27 @@ check_binaries() {
             esac
             CORPUS_DIR="corpus/mm_dump"
             ;;
+        mm_fill)
+            case "$FUZZER" in
+                libfuzzer)
+                    FUZZER_BIN="$BIN_DIR/mm_fill_fuzzer"
+                    ;;
+                afl)
+                    FUZZER_BIN="$BIN_DIR/mm_fill_afl"
+                    ;;
+                inproc)
+                    FUZZER_BIN="$BIN_DIR/mm_fill_mtfuzz"
+                    ;;
+                standalone|replay)
+                    FUZZER_BIN="$BIN_DIR/mm_fill_test"
+                    ;;
+                *)
+                    log_error "Unknown fuzzer: $FUZZER"
+                    exit 1
+                    ;;
+            esac
+            CORPUS_DIR="corpus/mm_fill"
+            ;;
         *)
             log_error "Unknown target: $TARGET"
             exit 1
@@ -117,11 +159,14 @@ setup_corpus() {
                 cd - >/dev/null
                 ;;
             mm_dump)
-                if [ -f "src/harnesses/mm_dump/Makefile" ]; then
-                    cd src/harnesses/mm_dump
-                    make create-seeds
-                    cd - >/dev/null
-                fi
+                cd src/harnesses/mm_dump
+                make create-seeds
+                cd - >/dev/null
+                ;;
+            mm_fill)
+                cd src/harnesses/mm_fill
+                make create-seeds
+                cd - >/dev/null
                 ;;
         esac
     fi
@@ -130,6 +175,42 @@ setup_corpus() {
     log_info "Corpus directory: $CORPUS_DIR ($seed_count seeds)"
 }
 
+# 코퍼스 팩 사용 시: 팩을 tmpfs 작업 디렉토리로 한 번에 펼친다
+setup_corpus_pack() {
+    [ -n "$CORPUS_PACK" ] || return 0
+    
+    PACK_TOOL="bin/${BUILD_TYPE}/cfs_corpus_pack"
+    if [ ! -x "$PACK_TOOL" ]; then
+        log_error "Corpus pack tool not found: $PACK_TOOL"
+        log_info "Please run: ./scripts/build_all.sh"
+        exit 1
+    fi
+    
+    [ -d "$CORPUS_WORKDIR" ] || CORPUS_WORKDIR="${TMPDIR:-/tmp}"
+    local work_dir="$CORPUS_WORKDIR/cfs_corpus_${TARGET}_$$"
+    
+    if [ -f "$CORPUS_PACK" ]; then
+        "$PACK_TOOL" unpack "$CORPUS_PACK" "$work_dir" >/dev/null
+    else
+        log_warning "Corpus pack not found, seeding from $CORPUS_DIR: $CORPUS_PACK"
+        mkdir -p "$work_dir"
+        cp "$CORPUS_DIR"/* "$work_dir"/ 2>/dev/null || true
+    fi
+    
+    CORPUS_DIR="$work_dir"
+    trap 'rm -rf "$CORPUS_DIR"' EXIT
+    log_info "Corpus pack: $CORPUS_PACK -> $CORPUS_DIR ($(find "$CORPUS_DIR" -type f | wc -l) inputs)"
+}
+
+# 세션 종료 후 작업 디렉토리를 다시 팩으로 저장
+save_corpus_pack() {
+    [ -n "$CORPUS_PACK" ] || return 0
+    
+    "$PACK_TOOL" pack "$CORPUS_DIR" "$CORPUS_PACK" >/dev/null && \
+        log_info "Corpus pack updated: $CORPUS_PACK" || \
+        log_warning "Failed to update corpus pack: $CORPUS_PACK"
+}
+
 # LibFuzzer 실행
 run_libfuzzer() {
     log_info "Starting LibFuzzer..."
@@ -147,9 +228,10 @@ run_libfuzzer() {
         "-exact_artifact_path=$RESULTS_DIR/crashes/crash-"
     )
     
-    # 병렬 실행 지원
-    if [ "$PARALLEL_JOBS" -gt 1 ]; then
-        fuzzer_args+=("-jobs=$PARALLEL_JOBS" "-workers=$PARALLEL_JOBS")
+    # 직전 세션이 정체로 끝났으면 다른 피드백 신호로 다시 시작
+    if [ "$STALL_RESEED" = "true" ]; then
+        fuzzer_args+=("-use_value_profile=1")
+        log_info "Re-seeding after stall: new seeds, value profile enabled"
     fi
     
     # 딕셔너리 파일이 있으면 사용
@@ -176,9 +258,32 @@ run_libfuzzer() {
         echo
     } > "$RESULTS_DIR/logs/session.log"
     
-    "$FUZZER_BIN" "${fuzzer_args[@]}" 2>&1 | tee -a "$RESULTS_DIR/logs/session.log"
+    # 병렬 작업은 같은 코퍼스 디렉토리를 공유하는 워커 프로세스들로 실행하고
+    # 워커마다 진행 줄을 시계열 CSV 로 기록한다 (워커 0 은 세션 로그/화면에도 출력)
+    local start_us="${EPOCHREALTIME/./}"
+    local session_seed=$(( (RANDOM << 15 | RANDOM) + 1 ))
+    local pids=()
+    local worker
+    for ((worker = 0; worker < PARALLEL_JOBS; worker++)); do
+        (
+            set -o pipefail
+            "$FUZZER_BIN" "${fuzzer_args[@]}" "-seed=$((session_seed + worker))" 2>&1 | \
+                scripts/fuzz_stats.sh record "$worker" "$RESULTS_DIR/stats/worker_$worker.csv" "$start_us" | \
+                if [ "$worker" -eq 0 ]; then tee -a "$RESULTS_DIR/logs/session.log"; \
+                else cat > "$RESULTS_DIR/logs/worker_$worker.log"; fi
+        ) &
+        pids+=($!)
+    done
     
-    local exit_code=${PIPESTATUS[0]}
+    monitor_workers "${pids[@]}"
+    
+    local exit_code=0
+    local pid
+    for pid in "${pids[@]}"; do
+        wait "$pid" || exit_code=$?
+    done
+    
+    merge_stats
     
     {
         echo
@@ -190,6 +295,100 @@ run_libfuzzer() {
     return $exit_code
 }
 
+# 프로세스 내 다중 워커 퍼저 실행 (mtfuzz 변형, 워커는 스레드로 코퍼스 색인을 공유)
+run_inproc() {
+    log_info "Starting in-process fuzzer..."
+    log_info "Target: $TARGET"
+    log_info "Time limit: ${TIME_LIMIT}s"
+    log_info "Workers: $PARALLEL_JOBS"
+    
+    local fuzzer_args=(
+        "-fuzz"
+        "-workers=$PARALLEL_JOBS"
+        "-max_total_time=$TIME_LIMIT"
+        "-seed=$(( (RANDOM << 15 | RANDOM) + 1 ))"
+        "-artifact_prefix=$RESULTS_DIR/crashes/"
+        "$CORPUS_DIR"
+    )
+    
+    echo "Command: $FUZZER_BIN ${fuzzer_args[*]}" | tee "$RESULTS_DIR/logs/command.log"
+    
+    {
+        echo "=== In-process Fuzzing Session Started at $(date) ==="
+        echo "Target: $TARGET"
+        echo "Binary: $FUZZER_BIN"
+        echo "Corpus: $CORPUS_DIR"
+        echo "Time Limit: ${TIME_LIMIT}s"
+        echo "Workers: $PARALLEL_JOBS"
+        echo "Results: $RESULTS_DIR"
+        echo "================================"
+        echo
+    } > "$RESULTS_DIR/logs/session.log"
+    
+    # 진행 줄은 프로세스 전체 합계이므로 시계열은 워커 0 하나로 기록
+    local start_us="${EPOCHREALTIME/./}"
+    (
+        set -o pipefail
+        "$FUZZER_BIN" "${fuzzer_args[@]}" 2>&1 | \
+            scripts/fuzz_stats.sh record 0 "$RESULTS_DIR/stats/worker_0.csv" "$start_us" | \
+            tee -a "$RESULTS_DIR/logs/session.log"
+    ) &
+    local pid=$!
+    
+    monitor_workers "$pid"
+    
+    local exit_code=0
+    wait "$pid" || exit_code=$?
+    
+    merge_stats
+    
+    {
+        echo
+        echo "=== In-process Fuzzing Session Ended at $(date) ==="
+        echo "Exit Code: $exit_code"
+        echo "================================"
+    } >> "$RESULTS_DIR/logs/session.log"
+    
+    return $exit_code
+}
+
+# 워커별 시계열을 세션 시계열로 병합
+merge_stats() {
+    local csvs=("$RESULTS_DIR"/stats/worker_*.csv)
+    [ -f "${csvs[0]}" ] || return 0
+    scripts/fuzz_stats.sh merge "$RESULTS_DIR/stats/timeseries" "$STATS_BUCKET" "${csvs[@]}"
+}
+
+# 워커가 도는 동안 주기적으로 시계열을 병합하고, 정체 시 세션을 조기 종료
+monitor_workers() {
+    local pids=("$@")
+    local started=$(date +%s)
+    
+    while true; do
+        local alive=0
+        local pid
+        for pid in "${pids[@]}"; do
+            kill -0 "$pid" 2>/dev/null && alive=$((alive + 1))
+        done
+        [ "$alive" -gt 0 ] || break
+        
+        sleep "$STATS_BUCKET"
+        merge_stats
+        
+        if [ "$STALL_TIMEOUT" -gt 0 ] && \
+           [ $(( $(date +%s) - started )) -ge "$STALL_TIMEOUT" ] && \
+           scripts/fuzz_stats.sh stalled "$RESULTS_DIR/stats/timeseries.csv" "$STALL_TIMEOUT"; then
+            log_warning "No new coverage for ${STALL_TIMEOUT}s, stopping session"
+            touch "$RESULTS_DIR/stats/stalled"
+            # libFuzzer 는 SIGTERM 에 최종 통계를 출력하고 종료한다
+            for pid in "${pids[@]}"; do
+                pkill -TERM -P "$pid" -f -- "$FUZZER_BIN" 2>/dev/null || true
+            done
+            break
+        fi
+    done
+}
+
 # AFL++ 실행
 run_afl() {
     log_info "Starting AFL++..."
@@ -227,6 +426,15 @@ run_afl() {
     if [ -d "$afl_output" ]; then
         find "$afl_output" -name "crashes" -type d -exec cp -r {} "$RESULTS_DIR/" \; 2>/dev/null || true
         find "$afl_output" -name "hangs" -type d -exec cp -r {} "$RESULTS_DIR/" \; 2>/dev/null || true
+        
+        # 인스턴스별 plot_data 를 같은 시계열 형식으로 변환
+        local plot
+        for plot in "$afl_output"/*/plot_data; do
+            [ -f "$plot" ] || continue
+            local instance=$(basename "$(dirname "$plot")")
+            scripts/fuzz_stats.sh afl "$plot" "$instance" "$RESULTS_DIR/stats/worker_$instance.csv"
+        done
+        merge_stats
     fi
 }
 
@@ -255,12 +463,36 @@ run_standalone() {
     return $exit_code
 }
 
+# 코퍼스/크래시 배치 재생 (standalone 바이너리, 프로세스 내 N 스레드)
+run_replay() {
+    log_info "Replaying corpus in-process..."
+    
+    local replay_args=(
+        "-j" "$PARALLEL_JOBS"
+        "-report=$RESULTS_DIR/logs/replay.csv"
+    )
+    
+    # 이전 재생 보고서가 있으면 상태 코드 회귀 비교
+    if [ -n "$REPLAY_BASELINE" ]; then
+        replay_args+=("-baseline=$REPLAY_BASELINE")
+        log_info "Baseline: $REPLAY_BASELINE"
+    fi
+    
+    # 코퍼스 팩은 setup_corpus_pack 에서 이미 CORPUS_DIR 로 펼쳐져 있다
+    replay_args+=("$CORPUS_DIR")
+    
+    echo "Command: $FUZZER_BIN ${replay_args[*]}" | tee "$RESULTS_DIR/logs/command.log"
+    "$FUZZER_BIN" "${replay_args[@]}" 2>&1 | tee "$RESULTS_DIR/logs/replay.log"
+    return ${PIPESTATUS[0]}
+}
+
 # 결과 분석
 analyze_results() {
     log_info "Analyzing fuzzing results..."
     
     local crash_count=$(find "$RESULTS_DIR/crashes" -type f 2>/dev/null | wc -l)
     local hang_count=$(find "$RESULTS_DIR/hangs" -type f 2>/dev/null | wc -l)
+    local timeout_count=$(find "$RESULTS_DIR/timeouts" -type f ! -name '*.txt' 2>/dev/null | wc -l)
     
     {
         echo "=== Fuzzing Results Summary ==="
@@ -270,10 +502,25 @@ analyze_results() {
         echo "Duration: ${TIME_LIMIT}s"
         echo "Crashes Found: $crash_count"
         echo "Hangs Found: $hang_count"
+        echo "Timeouts Found: $timeout_count (watchdog budget exceeded)"
+        if [ -s "$RESULTS_DIR/stats/timeseries.csv" ]; then
+            tail -n 1 "$RESULTS_DIR/stats/timeseries.csv" | \
+                awk -F, '{ printf "Coverage: cov %s, ft %s, corpus %s, %s execs (%s workers)\n", $5, $6, $7, $3, $2 }'
+        fi
+        [ -f "$RESULTS_DIR/stats/stalled" ] && echo "Stopped: coverage stalled for ${STALL_TIMEOUT}s"
         echo "Results Directory: $RESULTS_DIR"
         echo "=============================="
     } | tee "$RESULTS_DIR/summary.txt"
     
+    # 워치독 보고서의 명령/단계별 분포 (느린 경로 위치)
+    if [ "$timeout_count" -gt 0 ]; then
+        log_warning "Found $timeout_count inputs over the watchdog budget"
+        for report in "$RESULTS_DIR/timeouts"/*.txt; do
+            [ -f "$report" ] || continue
+            echo "$(sed -n 's/^command: //p' "$report") / $(sed -n 's/^stage: //p' "$report")"
+        done | sort | uniq -c | sort -rn | tee "$RESULTS_DIR/timeouts_by_stage.txt"
+    fi
+    
     if [ "$crash_count" -gt 0 ]; then
         log_warning "Found $crash_count crashes!"
         log_info "Crash files saved in: $RESULTS_DIR/crashes/"
@@ -317,13 +564,18 @@ CFS MM Fuzzer 실행 스크립트
 옵션:
     -h, --help              이 도움말 표시
     --target TARGET         타겟 하니스 (mm_load, mm_dump, mm_peek, mm_fill)
-    --fuzzer FUZZER         퍼저 (libfuzzer, afl, standalone)
+    --fuzzer FUZZER         퍼저 (libfuzzer, afl, standalone, replay)
     --time SECONDS          퍼징 시간 (초)
     --memory MB             메모리 제한 (MB)
     --jobs N                병렬 작업 수
     --build-type TYPE       빌드 타입 (debug, release)
     --cfs-mode              CFS 통합 모드
     --continuous            지속적 퍼징 모드
+    --corpus-pack FILE      코퍼스 팩 사용 (tmpfs 로 펼친 뒤 세션 종료 시 다시 저장)
+    --differential          차분 모드 (시뮬레이션 vs 참조 구현, 불일치를 크래시로 보고)
+    --sequence              명령 시퀀스 모드 (접두부 스냅샷에서 이어 실행)
+    --stall SECONDS         커버리지가 SECONDS 동안 늘지 않으면 세션 종료 (지속 모드는 재시드 후 재시작)
+    --mission-config FILE   미션 프로파일 (심볼/경로/메모리 영역, configs/missions/*.mission)
 
 환경 변수:
     TARGET                  타겟 하니스 (기본: mm_load)
@@ -332,6 +584,24 @@ CFS MM Fuzzer 실행 스크립트
     MEMORY_LIMIT            메모리 제한 (기본: 1024MB)
     PARALLEL_JOBS           병렬 작업 수 (기본: 1)
     BUILD_TYPE              빌드 타입 (기본: release)
+    CORPUS_PACK             코퍼스 팩 파일 (기본: 사용 안함)
+    CORPUS_WORKDIR          팩을 펼칠 디렉토리 (기본: /dev/shm)
+    REPLAY_BASELINE         replay 모드에서 비교할 이전 replay.csv
+    CFS_DIFF_LOOSE          차분 모드에서 양쪽 모두 실패한 경우 상태 코드 차이 무시 (기본: 0)
+    CFS_SNAPSHOT            시퀀스 모드 접두부 스냅샷 캐시 (기본: 1, 0 이면 매번 루트부터)
+    CFS_DUMP_DIR            mm_dump 파일을 VFS 대신 이 디렉토리에 writev 로 출력 (tmpfs 권장)
+    CFS_LOAD_STREAM         mm_load 단일 패스 스트리밍 CRC 로드 (기본: 0, CRC 먼저 확인)
+    CFS_MISSION             --mission-config 와 같음 (기본: 하니스 내장 기본 미션)
+    CFS_DECODER             mm_load 입력 디코더 (기본: 고정 폭 필드, legacy 면 이전 패킷 배치)
+    CFS_WATCHDOG            실행별 워치독 (기본: 1, 0 이면 끔)
+    CFS_WATCHDOG_US         모든 명령의 실행 예산 (마이크로초, 기본: 5000, sequence 20000)
+    CFS_WATCHDOG_BUDGET     명령별 예산 (예: load=800,fill=200,dump=1500,sequence=5000)
+    CFS_WATCHDOG_DIR        예산 초과 입력/보고서 저장 위치 (기본: 결과 디렉토리/timeouts)
+    CFS_WATCHDOG_FATAL      예산 초과 시 abort 하여 크래시로 저장 (기본: 0)
+    RESULTS_ROOT            결과 디렉토리를 만들 위치 (기본: results)
+    STATS_BUCKET            시계열 병합 간격 (초, 기본: 10, 결과 디렉토리/stats/timeseries.{csv,json})
+    STALL_TIMEOUT           --stall 과 같음 (기본: 0, 사용 안함)
+    CFS_PROFILE_DIR         단계별 느린 입력 보고서 위치 (ENABLE_PROFILE 빌드, 기본: 결과 디렉토리/profile)
 
 예제:
     $0                                           # 기본 설정으로 mm_load 퍼징
@@ -340,17 +610,24 @@ CFS MM Fuzzer 실행 스크립트
     TARGET=mm_load FUZZER=libfuzzer $0          # 환경변수 사용
     $0 --fuzzer standalone                       # 단독 테스트 실행
     $0 --continuous --time 86400                # 24시간 지속적 퍼징
+    $0 --fuzzer replay --jobs 8                 # 코퍼스 전체 회귀 재생
+    $0 --fuzzer inproc --jobs 8                 # 한 프로세스 8 스레드 퍼징 (mtfuzz 빌드)
+    $0 --differential --time 3600               # 시뮬레이션 드리프트 탐지
+    $0 --sequence --time 3600                   # 다단계 명령 시퀀스로 깊은 상태 탐색
+    $0 --continuous --jobs 8 --stall 1800       # 30분 정체 시 재시드하며 지속 퍼징
 
 지원하는 타겟:
     mm_load     - MM LoadMemFromFileCmd 퍼징
-    mm_dump     - MM DumpMemToFileCmd 퍼징 (구현 예정)
+    mm_dump     - MM DumpMemToFileCmd 퍼징
     mm_peek     - MM PeekCmd 퍼징 (구현 예정)
-    mm_fill     - MM FillMemCmd 퍼징 (구현 예정)
+    mm_fill     - MM FillMemCmd 퍼징
 
 지원하는 퍼저:
     libfuzzer   - LLVM LibFuzzer (기본)
     afl         - AFL++ 퍼저
+    inproc      - 프로세스 내 다중 워커 퍼저 (mtfuzz 빌드, --jobs 만큼 스레드)
     standalone  - 독립 실행 테스트
+    replay      - 코퍼스/팩 전체를 프로세스 내에서 병렬 재생 (회귀 검사)
 EOF
 }
 
@@ -375,6 +652,9 @@ run_continuous() {
             afl)
                 run_afl || true
                 ;;
+            inproc)
+                run_inproc || true
+                ;;
             *)
                 log_error "Continuous mode not supported for fuzzer: $FUZZER"
                 exit 1
@@ -383,6 +663,12 @@ run_continuous() {
         
         # 결과 분석
         analyze_results
+        save_corpus_pack
+        
+        # 정체로 끝난 세션 다음에는 재시드
+        if [ -f "$RESULTS_DIR/stats/stalled" ]; then
+            STALL_RESEED=true
+        fi
         
         # 세션 완료
         local elapsed=$(($(date +%s) - start_time))
@@ -439,6 +725,26 @@ main() {
                 continuous_mode=true
                 shift
                 ;;
+            --corpus-pack)
+                CORPUS_PACK="$2"
+                shift 2
+                ;;
+            --differential)
+                export CFS_DIFFERENTIAL=1
+                shift
+                ;;
+            --sequence)
+                export CFS_SEQUENCE=1
+                shift
+                ;;
+            --stall)
+                STALL_TIMEOUT="$2"
+                shift 2
+                ;;
+            --mission-config)
+                export CFS_MISSION="$2"
+                shift 2
+                ;;
             *)
                 log_error "Unknown option: $1"
                 show_help
@@ -454,6 +760,21 @@ main() {
     log_info "Memory Limit: ${MEMORY_LIMIT}MB"
     log_info "Parallel Jobs: $PARALLEL_JOBS"
     log_info "Build Type: $BUILD_TYPE"
+    if [ "${CFS_DIFFERENTIAL:-0}" != "0" ]; then
+        log_info "Differential: simulation vs reference"
+    fi
+    if [ "${CFS_SEQUENCE:-0}" != "0" ]; then
+        log_info "Sequence: prefix snapshot cache ${CFS_SNAPSHOT:-1}"
+    fi
+    if [ -n "${CFS_MISSION:-}" ]; then
+        if [ ! -f "$CFS_MISSION" ]; then
+            log_error "Mission file not found: $CFS_MISSION"
+            exit 1
+        fi
+        # 워커/재시작 시 작업 디렉토리와 무관하게 찾도록 절대 경로로
+        export CFS_MISSION="$(cd "$(dirname "$CFS_MISSION")" && pwd)/$(basename "$CFS_MISSION")"
+        log_info "Mission: $CFS_MISSION"
+    fi
     
     if [ "$cfs_mode" = "true" ]; then
         log_info "CFS Integration: Enabled"
@@ -463,6 +784,7 @@ main() {
     # 사전 검사
     check_binaries
     setup_corpus
+    setup_corpus_pack
     
     if [ "$continuous_mode" = "true" ]; then
         run_continuous
@@ -477,9 +799,15 @@ main() {
             afl)
                 run_afl
                 ;;
+            inproc)
+                run_inproc
+                ;;
             standalone)
                 run_standalone
                 ;;
+            replay)
+                run_replay
+                ;;
             *)
                 log_error "Unknown fuzzer: $FUZZER"
                 exit 1
@@ -488,6 +816,7 @@ main() {
         
         # 결과 분석
         analyze_results
+        save_corpus_pack
         
         log_success "Fuzzing session completed!"
         log_info "Results saved in: $RESULTS_DIR"
@@ -0,0 +1,36 @@
+#!/bin/bash
+# scripts/timed_build.sh - 빌드 타겟별 소요 시간 기록 래퍼
+#
+# 사용법: timed_build.sh <stats_file> <target> <command...>
+# 명령을 실행하고 "<시각> - <타겟>: <SUCCESS|FAILED> (<초>s)" 형식으로
+# 밀리초 단위 소요 시간을 stats_file 에 추가한다.
+
+stats_file="$1"
+target="$2"
+shift 2
+
+now_ms() {
+    local ns
+    ns=$(date +%s%N 2>/dev/null)
+    if [[ "$ns" =~ ^[0-9]+$ ]]; then
+        echo $((ns / 1000000))
+    else
+        echo $(($(date +%s) * 1000))
+    fi
+}
+
+start_ms=$(now_ms)
+"$@"
+status=$?
+duration_ms=$(($(now_ms) - start_ms))
+
+if [ $status -eq 0 ]; then
+    result="SUCCESS"
+else
+    result="FAILED"
+fi
+
+printf '%s - %s: %s (%d.%03ds)\n' "$(date '+%Y-%m-%d %H:%M:%S')" "$target" "$result" \
+    $((duration_ms / 1000)) $((duration_ms % 1000)) >> "$stats_file"
+
+exit $status
@@ -0,0 +1,316 @@
+/*
+ * CFS 시뮬레이션 메모리 아레나
+ *
+ * 설정은 워커 시작 전에 한 번 정하고 이후에는 읽기만 한다.
+ * 아레나 자체는 스레드별 (sim_mem.c 의 스레드 지역 상태) 이고, 통계만 전체 합으로 센다.
+ * 미리 폴트는 배치마다 한 번뿐이라 getrusage/clock_gettime 비용은 무시할 만하다.
+ */
+
+#define _GNU_SOURCE
+
+#include "arena.h"
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+
+#define ARENA_PAGE_SIZE     4096u
+
+typedef struct {
+    CFS_ArenaHugeMode_t huge;
+    uint32_t            batch_shift;
+} ArenaConfig_t;
+
+static ArenaConfig_t g_arena = { CFS_ARENA_HUGE_AUTO, 21 };
+static CFS_ArenaStats_t g_arena_stats;
+
+static const char * const g_arena_backing_names[CFS_ARENA_BACKING_COUNT] = {
+    "4KB pages", "thp", "hugetlb"
+};
+
+static uint64_t Arena_NowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// 현재 스레드가 지금까지 받은 페이지 폴트 (minor + major)
+static uint64_t Arena_ThreadFaults(void) {
+    struct rusage usage;
+#ifdef RUSAGE_THREAD
+    if (getrusage(RUSAGE_THREAD, &usage) != 0) {
+        return 0;
+    }
+#else
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#endif
+    return (uint64_t)usage.ru_minflt + (uint64_t)usage.ru_majflt;
+}
+
+void CFS_Arena_Configure(CFS_ArenaHugeMode_t huge, uint32_t prefault_kb) {
+    g_arena.huge = huge;
+    if (prefault_kb == 0) {
+        g_arena.batch_shift = 0;
+        return;
+    }
+    if ((prefault_kb & (prefault_kb - 1)) != 0) {
+        prefault_kb = CFS_ARENA_DEFAULT_PREFAULT_KB;
+    }
+    g_arena.batch_shift = (uint32_t)__builtin_ctz(prefault_kb) + 10;
+    if (g_arena.batch_shift < 12) {
+        g_arena.batch_shift = 12;
+    }
+}
+
+void CFS_Arena_ConfigureFromEnv(void) {
+    const char *huge = getenv("CFS_ARENA_HUGEPAGES");
+    const char *prefault = getenv("CFS_ARENA_PREFAULT_KB");
+    CFS_ArenaHugeMode_t mode = CFS_ARENA_HUGE_AUTO;
+    uint32_t prefault_kb = CFS_ARENA_DEFAULT_PREFAULT_KB;
+
+    if (huge && huge[0] != '\0') {
+        if (strcmp(huge, "explicit") == 0) {
+            mode = CFS_ARENA_HUGE_EXPLICIT;
+        } else if (strcmp(huge, "thp") == 0) {
+            mode = CFS_ARENA_HUGE_THP;
+        } else if (strcmp(huge, "off") == 0 || strcmp(huge, "0") == 0) {
+            mode = CFS_ARENA_HUGE_OFF;
+        } else if (strcmp(huge, "auto") != 0) {
+            fprintf(stderr, "CFS_ARENA_HUGEPAGES must be auto, explicit, thp or off, using auto\n");
+        }
+    }
+    if (prefault && prefault[0] != '\0') {
+        prefault_kb = (uint32_t)strtoul(prefault, NULL, 0);
+        if ((prefault_kb & (prefault_kb - 1)) != 0) {
+            fprintf(stderr, "CFS_ARENA_PREFAULT_KB must be a power of two, using %u\n",
+                    CFS_ARENA_DEFAULT_PREFAULT_KB);
+        }
+    }
+    CFS_Arena_Configure(mode, prefault_kb);
+}
+
+/*
+ * 명시적 휴지페이지: 풀이 모자라면 mmap 이 바로 실패하도록 MAP_NORESERVE 를 쓰지 않는다
+ * (예약 없이 매핑하면 나중에 폴트할 때 SIGBUS)
+ */
+static void* Arena_MapHugetlb(size_t map_size) {
+#ifdef MAP_HUGETLB
+    void *map = mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    return (map == MAP_FAILED) ? NULL : map;
+#else
+    (void)map_size;
+    return NULL;
+#endif
+}
+
+// 투명 휴지페이지: 2MB 정렬로 예약한 뒤 앞뒤 여분을 잘라냄
+static void* Arena_MapThp(size_t map_size) {
+#ifdef MADV_HUGEPAGE
+    const size_t align = CFS_ARENA_HUGE_PAGE_SIZE;
+    uint8_t *map = mmap(NULL, map_size + align, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (map == MAP_FAILED) {
+        return NULL;
+    }
+
+    uint8_t *base = (uint8_t *)(((uintptr_t)map + align - 1) & ~(uintptr_t)(align - 1));
+    size_t head = (size_t)(base - map);
+    if (head > 0) {
+        munmap(map, head);
+    }
+    munmap(base + map_size, align - head);
+    if (madvise(base, map_size, MADV_HUGEPAGE) != 0) {
+        // 커널이 THP 를 지원하지 않음: 일반 페이지로 쓰도록 돌려줌
+        munmap(base, map_size);
+        return NULL;
+    }
+    return base;
+#else
+    (void)map_size;
+    return NULL;
+#endif
+}
+
+int32_t CFS_Arena_Map(CFS_Arena_t *arena, size_t size) {
+    const size_t huge_size = CFS_ARENA_HUGE_PAGE_SIZE;
+    void *map = NULL;
+
+    memset(arena, 0, sizeof(*arena));
+    arena->size = size;
+
+    // 휴지페이지 하나보다 작은 영역은 일반 페이지로 (올림하면 메모리 낭비)
+    if (size >= huge_size) {
+        size_t huge_map_size = (size + huge_size - 1) & ~(size_t)(huge_size - 1);
+        if (g_arena.huge == CFS_ARENA_HUGE_AUTO || g_arena.huge == CFS_ARENA_HUGE_EXPLICIT) {
+            map = Arena_MapHugetlb(huge_map_size);
+            arena->backing = CFS_ARENA_BACKING_HUGETLB;
+        }
+        if (!map && (g_arena.huge == CFS_ARENA_HUGE_AUTO || g_arena.huge == CFS_ARENA_HUGE_THP)) {
+            map = Arena_MapThp(huge_map_size);
+            arena->backing = CFS_ARENA_BACKING_THP;
+        }
+        if (map) {
+            arena->map_size = huge_map_size;
+        }
+    }
+    if (!map) {
+        arena->map_size = (size + ARENA_PAGE_SIZE - 1) & ~(size_t)(ARENA_PAGE_SIZE - 1);
+        arena->backing = CFS_ARENA_BACKING_PAGES;
+        map = mmap(NULL, arena->map_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (map == MAP_FAILED) {
+            memset(arena, 0, sizeof(*arena));
+            return CFS_MM_ERROR_RESOURCE_LIMIT;
+        }
+    }
+
+    arena->batch_shift = g_arena.batch_shift;
+    if (arena->batch_shift) {
+        size_t batches = ((arena->map_size - 1) >> arena->batch_shift) + 1;
+        arena->faulted = calloc((batches + 63) / 64, sizeof(uint64_t));
+        if (!arena->faulted) {
+            arena->batch_shift = 0;
+        }
+    }
+    arena->base = (uint8_t *)map;
+
+    __atomic_fetch_add(&g_arena_stats.maps[arena->backing], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&g_arena_stats.bytes_mapped, arena->map_size, __ATOMIC_RELAXED);
+    return CFE_SUCCESS;
+}
+
+void CFS_Arena_Unmap(CFS_Arena_t *arena) {
+    if (arena->base) {
+        munmap(arena->base, arena->map_size);
+    }
+    free(arena->faulted);
+    memset(arena, 0, sizeof(*arena));
+}
+
+// 구간을 쓰기 가능하게 채움 (MADV_POPULATE_WRITE 가 없는 커널이면 페이지마다 한 바이트를 다시 씀)
+static void Arena_Populate(uint8_t *start, size_t length) {
+#ifdef MADV_POPULATE_WRITE
+    if (madvise(start, length, MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+#endif
+    volatile uint8_t *p = start;
+    for (size_t i = 0; i < length; i += ARENA_PAGE_SIZE) {
+        p[i] = p[i];
+    }
+}
+
+void CFS_Arena_PrefaultSlow(CFS_Arena_t *arena, size_t offset, size_t size) {
+    const uint32_t shift = arena->batch_shift;
+    size_t first = offset >> shift;
+    size_t last = (offset + size - 1) >> shift;
+    uint64_t batches = 0;
+    uint64_t bytes = 0;
+    uint64_t faults = 0;
+    uint64_t begin = 0;
+
+    if (arena->batch_shift == 0 || size == 0 || offset + size > arena->map_size) {
+        return;
+    }
+
+    // 아직 폴트하지 않은 배치를 연속 구간으로 모아 한 번에 채움
+    size_t b = first;
+    while (b <= last) {
+        if (arena->faulted[b >> 6] & (1ULL << (b & 63))) {
+            b++;
+            continue;
+        }
+        size_t run_end = b;
+        while (run_end + 1 <= last && !(arena->faulted[(run_end + 1) >> 6] & (1ULL << ((run_end + 1) & 63)))) {
+            run_end++;
+        }
+        if (batches == 0) {
+            faults = Arena_ThreadFaults();
+            begin = Arena_NowNs();
+        }
+
+        size_t start = b << shift;
+        size_t end = (run_end + 1) << shift;
+        if (end > arena->map_size) {
+            end = arena->map_size;
+        }
+        Arena_Populate(arena->base + start, end - start);
+        for (size_t k = b; k <= run_end; k++) {
+            arena->faulted[k >> 6] |= 1ULL << (k & 63);
+        }
+        batches += run_end - b + 1;
+        bytes += end - start;
+        b = run_end + 1;
+    }
+
+    if (batches > 0) {
+        __atomic_fetch_add(&g_arena_stats.prefault_ns, Arena_NowNs() - begin, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&g_arena_stats.prefault_faults, Arena_ThreadFaults() - faults, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&g_arena_stats.prefault_batches, batches, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&g_arena_stats.prefault_bytes, bytes, __ATOMIC_RELAXED);
+    }
+}
+
+void CFS_Arena_Zero(CFS_Arena_t *arena, size_t offset, size_t size) {
+    // 마지막 페이지가 영역 끝에서 잘리는 경우 요청 크기까지만
+    if (!arena->base || offset >= arena->size) {
+        return;
+    }
+    if (size > arena->size - offset) {
+        size = arena->size - offset;
+    }
+    memset(arena->base + offset, 0, size);
+}
+
+uint64_t CFS_Arena_ResetBegin(void) {
+    return Arena_NowNs();
+}
+
+void CFS_Arena_ResetEnd(uint64_t begin, uint64_t bytes) {
+    __atomic_fetch_add(&g_arena_stats.resets, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&g_arena_stats.reset_bytes, bytes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&g_arena_stats.reset_ns, Arena_NowNs() - begin, __ATOMIC_RELAXED);
+}
+
+const char* CFS_Arena_BackingName(CFS_ArenaBacking_t backing) {
+    return (backing < CFS_ARENA_BACKING_COUNT) ? g_arena_backing_names[backing] : "unknown";
+}
+
+const CFS_ArenaStats_t* CFS_Arena_GetStats(void) {
+    return &g_arena_stats;
+}
+
+void CFS_Arena_PrintStats(void) {
+    const CFS_ArenaStats_t *stats = CFS_Arena_GetStats();
+    uint64_t maps = 0;
+    struct rusage usage;
+
+    for (int b = 0; b < CFS_ARENA_BACKING_COUNT; b++) {
+        maps += stats->maps[b];
+    }
+    if (maps == 0 && stats->resets == 0) {
+        return;
+    }
+
+    printf("\n=== Simulated Memory Arenas ===\n");
+    printf("Regions Mapped: %lu (%.1f MB;", maps, (double)stats->bytes_mapped / (1024.0 * 1024.0));
+    for (int b = CFS_ARENA_BACKING_COUNT - 1; b >= 0; b--) {
+        printf(" %s %lu%s", g_arena_backing_names[b], stats->maps[b], b > 0 ? "," : ")\n");
+    }
+    printf("Prefault: %lu batches, %.1f MB, %lu page faults, %.2f ms\n", stats->prefault_batches,
+           (double)stats->prefault_bytes / (1024.0 * 1024.0), stats->prefault_faults,
+           (double)stats->prefault_ns / 1e6);
+    printf("Resets: %lu (%.1f MB, avg %.2f us)\n", stats->resets,
+           (double)stats->reset_bytes / (1024.0 * 1024.0),
+           stats->resets > 0 ? (double)stats->reset_ns / 1e3 / (double)stats->resets : 0.0);
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        printf("Process Page Faults: %ld minor, %ld major\n", usage.ru_minflt, usage.ru_majflt);
+    }
+    printf("===============================\n");
+}
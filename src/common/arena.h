@@ -0,0 +1,101 @@
+/*
+ * CFS 시뮬레이션 메모리 아레나 헤더
+ * 시뮬레이션 영역 하나를 호스트 메모리 한 덩어리로 예약하고, 쓰기 전에 배치 단위로 미리 폴트한다.
+ * SDRAM_EXTERNAL (128MB) 처럼 큰 영역을 4KB 페이지로 첫 접근마다 폴트하면
+ * 큰 로드마다 페이지 폴트와 TLB 미스가 쌓이므로
+ *   - 큰 영역 (휴지페이지 크기 이상) 은 명시적 휴지페이지 (MAP_HUGETLB) → 투명 휴지페이지
+ *     (MADV_HUGEPAGE, 2MB 정렬) → 일반 페이지 순으로 시도한다.
+ *   - 쓰기 구간이 걸친 배치 (기본 2MB) 중 아직 폴트하지 않은 것만 MADV_POPULATE_WRITE
+ *     (없으면 페이지마다 한 바이트 쓰기) 로 한 번에 채운다. 배치 비트맵은 아레나마다 둔다.
+ * 되돌리기는 호출자 (sim_mem.c) 의 dirty/touched 페이지 비트맵이 정하고,
+ * 아레나는 매핑을 유지한 채 구간을 0 으로 지워 다시 폴트하지 않게 한다.
+ *
+ * 환경 변수
+ *   CFS_ARENA_HUGEPAGES=auto|explicit|thp|off   휴지페이지 사용 (기본 auto = explicit → thp → off)
+ *   CFS_ARENA_PREFAULT_KB=N                     미리 폴트할 배치 크기 (KB, 2 의 거듭제곱, 기본 2048, 0 = 끔)
+ */
+
+#ifndef CFS_ARENA_H
+#define CFS_ARENA_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+#define CFS_ARENA_HUGE_PAGE_SIZE        (2u * 1024 * 1024)
+#define CFS_ARENA_DEFAULT_PREFAULT_KB   2048
+
+typedef enum {
+    CFS_ARENA_BACKING_PAGES = 0,    // 일반 4KB 페이지 (MAP_NORESERVE)
+    CFS_ARENA_BACKING_THP,          // 투명 휴지페이지 (madvise)
+    CFS_ARENA_BACKING_HUGETLB,      // 명시적 휴지페이지 (예약된 풀에서)
+    CFS_ARENA_BACKING_COUNT
+} CFS_ArenaBacking_t;
+
+typedef enum {
+    CFS_ARENA_HUGE_AUTO = 0,
+    CFS_ARENA_HUGE_EXPLICIT,
+    CFS_ARENA_HUGE_THP,
+    CFS_ARENA_HUGE_OFF
+} CFS_ArenaHugeMode_t;
+
+// 영역 하나의 아레나 (스레드별, 호출자가 소유)
+typedef struct {
+    uint8_t  *base;
+    size_t    size;                 // 요청 크기
+    size_t    map_size;             // 실제 매핑 크기 (휴지페이지면 올림)
+    uint32_t  backing;              // CFS_ArenaBacking_t
+    uint32_t  batch_shift;          // 미리 폴트 배치 크기 (log2, 0 = 끔)
+    uint64_t *faulted;              // 폴트한 배치 비트맵
+} CFS_Arena_t;
+
+// 전체 통계 (모든 스레드 합)
+typedef struct {
+    uint64_t maps[CFS_ARENA_BACKING_COUNT];
+    uint64_t bytes_mapped;
+    uint64_t prefault_batches;
+    uint64_t prefault_bytes;
+    uint64_t prefault_faults;       // 미리 폴트 중 스레드가 받은 페이지 폴트
+    uint64_t prefault_ns;
+    uint64_t resets;                // 영역 되돌리기 (0 으로 지우기 / 이미지 복원)
+    uint64_t reset_bytes;
+    uint64_t reset_ns;
+} CFS_ArenaStats_t;
+
+// 설정 (워커 스레드 시작 전에만)
+void CFS_Arena_Configure(CFS_ArenaHugeMode_t huge, uint32_t prefault_kb);
+void CFS_Arena_ConfigureFromEnv(void);
+
+/*
+ * size 바이트 아레나 예약 (내용은 0)
+ * 반환값: CFE_SUCCESS, CFS_MM_ERROR_RESOURCE_LIMIT (모든 방식 실패)
+ */
+int32_t CFS_Arena_Map(CFS_Arena_t *arena, size_t size);
+void CFS_Arena_Unmap(CFS_Arena_t *arena);
+
+// [offset, offset + size) 에 쓰기 전에 호출: 아직 폴트하지 않은 배치만 채움
+void CFS_Arena_PrefaultSlow(CFS_Arena_t *arena, size_t offset, size_t size);
+
+static inline void CFS_Arena_Prefault(CFS_Arena_t *arena, size_t offset, size_t size) {
+    if (arena->batch_shift == 0 || size == 0) {
+        return;
+    }
+    size_t first = offset >> arena->batch_shift;
+    size_t last = (offset + size - 1) >> arena->batch_shift;
+    if (first == last && (arena->faulted[first >> 6] & (1ULL << (first & 63)))) {
+        return;
+    }
+    CFS_Arena_PrefaultSlow(arena, offset, size);
+}
+
+// [offset, offset + size) 를 0 으로 (매핑과 폴트 상태 유지, 아레나 크기에서 잘림)
+void CFS_Arena_Zero(CFS_Arena_t *arena, size_t offset, size_t size);
+
+// 되돌리기 한 번의 비용 기록 (sim_mem.c 의 이미지 복원/초기화): Begin 값을 End 에 넘김
+uint64_t CFS_Arena_ResetBegin(void);
+void CFS_Arena_ResetEnd(uint64_t begin, uint64_t bytes);
+
+const char* CFS_Arena_BackingName(CFS_ArenaBacking_t backing);
+const CFS_ArenaStats_t* CFS_Arena_GetStats(void);
+void CFS_Arena_PrintStats(void);
+
+#endif // CFS_ARENA_H
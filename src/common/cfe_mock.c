@@ -0,0 +1,72 @@
+/*
+ * CFS CFE Mock 상태
+ * 헤더의 인라인 Mock 함수들이 공유해야 하는 상태를 보관한다.
+ *   - CFE_EVS_SendEvent 이벤트 캡처 (스레드별 고정 크기 버퍼), 호출 기록은 캡처 여부와 무관
+ */
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+typedef struct {
+    boolean         enabled;
+    boolean         with_text;
+    uint32_t        count;
+    uint32_t        dropped;
+    CFS_MockEvent_t events[CFS_MOCK_MAX_EVENTS];
+} MockEventLog_t;
+
+static CFS_THREAD_LOCAL MockEventLog_t t_event_log;
+
+void CFS_MockEvents_Capture(boolean enable, boolean with_text) {
+    t_event_log.enabled = enable;
+    t_event_log.with_text = with_text;
+    t_event_log.count = 0;
+    t_event_log.dropped = 0;
+}
+
+void CFS_MockEvents_Clear(void) {
+    t_event_log.count = 0;
+    t_event_log.dropped = 0;
+}
+
+uint32_t CFS_MockEvents_Count(void) {
+    return t_event_log.count;
+}
+
+uint32_t CFS_MockEvents_Dropped(void) {
+    return t_event_log.dropped;
+}
+
+const CFS_MockEvent_t* CFS_MockEvents_Get(uint32_t index) {
+    if (index >= t_event_log.count) {
+        return NULL;
+    }
+    return &t_event_log.events[index];
+}
+
+void CFS_MockEvents_Record(CFE_EVS_EventID_t EventID, CFE_EVS_EventType_Enum_t EventType,
+                           const char *Spec, va_list Args) {
+    MockEventLog_t *log = &t_event_log;
+    const int64_t in[2] = { EventID, EventType };
+
+    CFS_MockTrace_Record(CFS_MOCK_TRACE_EVENT, in, NULL);
+
+    // 캡처하지 않는 일반 퍼징 경로에서는 포맷팅 비용도 들이지 않는다
+    if (!log->enabled) {
+        return;
+    }
+
+    if (log->count >= CFS_MOCK_MAX_EVENTS) {
+        log->dropped++;
+        return;
+    }
+
+    CFS_MockEvent_t *event = &log->events[log->count++];
+    event->EventID = EventID;
+    event->EventType = EventType;
+    if (Spec && log->with_text) {
+        vsnprintf(event->Text, sizeof(event->Text), Spec, Args);
+    } else {
+        event->Text[0] = '\0';
+    }
+}
@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdarg.h>
 
 // CFS 기본 타입 정의
 typedef uint8_t  uint8;
@@ -46,6 +47,47 @@ typedef uint8 boolean;
 #define CFE_SB_MAX_PIPE_DEPTH        64
 #define CFE_SB_POLL                  0
 #define CFE_SB_PEND_FOREVER         -1
+#define CFE_SB_TIME_OUT             ((int32_t)0xCA000001)
+#define CFE_SB_NO_MESSAGE           ((int32_t)0xCA000002)
+
+// CFE Time Services 관련
+typedef struct {
+    uint32 Seconds;
+    uint32 Subseconds;              // 2^-32 초 단위
+} CFE_TIME_SysTime_t;
+
+// 가상 시계 (스레드별, vclock.c). Mock 의 대기는 실제로 잠들지 않고 이 시계만 앞당긴다
+typedef enum {
+    CFS_VCLOCK_DELAY = 0,           // OS_TaskDelay, 세그먼트 사이 양보
+    CFS_VCLOCK_PEND,                // 소프트웨어 버스 수신 대기
+    CFS_VCLOCK_FILE,                // 파일 열기/전송
+    CFS_VCLOCK_EEPROM,              // EEPROM 페이지 프로그램
+    CFS_VCLOCK_SOURCE_COUNT
+} CFS_VClockSource_t;
+
+void CFS_VClock_Advance(CFS_VClockSource_t source, uint64_t ns);
+uint64_t CFS_VClock_Now(void);
+// 오지 않는 메시지를 timeout_ms 동안 기다림 (음수 = PEND_FOREVER, 설정한 한도까지)
+void CFS_VClock_Pend(int32_t timeout_ms);
+CFE_TIME_SysTime_t CFS_VClock_SysTime(void);
+
+// Mock 호출 기록/재생 (스레드별, mock_trace.c). 종류마다 입력/결과 값 수가 정해져 있다
+typedef enum {
+    CFS_MOCK_TRACE_SYMBOL = 1,      // 심볼 해석 (이름 지문) → 상태, 주소
+    CFS_MOCK_TRACE_REGION,          // 메모리 영역 검증 (주소, 크기, 타입, 쓰기) → 상태
+    CFS_MOCK_TRACE_MEM_VALIDATE,    // OS_MemValidateRange (주소, 크기, 타입) → 상태
+    CFS_MOCK_TRACE_SB_RECEIVE,      // CFE_SB_ReceiveBuffer (파이프, 타임아웃) → 상태
+    CFS_MOCK_TRACE_TIME,            // CFE_TIME_GetTime → 초, 서브초
+    CFS_MOCK_TRACE_DELAY,           // OS_TaskDelay (ms), 비교만
+    CFS_MOCK_TRACE_EVENT,           // CFE_EVS_SendEvent (ID, 타입), 비교만
+    CFS_MOCK_TRACE_FILE_READ,       // VFS 파일 읽기 (경로 지문) → 상태, 크기, 내용 지문, 비교만
+    CFS_MOCK_TRACE_KIND_COUNT
+} CFS_MockTraceKind_t;
+
+// 재생 중이면 같은 종류/입력의 다음 기록에서 결과를 out 에 채우고 TRUE (호출자는 결과 계산을 건너뜀)
+boolean CFS_MockTrace_Feed(CFS_MockTraceKind_t kind, const int64_t *in, int64_t *out);
+// 호출 하나 기록 (재생 중이면 다음 기록과 비교만)
+void CFS_MockTrace_Record(CFS_MockTraceKind_t kind, const int64_t *in, const int64_t *out);
 
 // CFE 메시지 관련 구조체
 typedef struct {
@@ -76,10 +118,56 @@ typedef struct {
     uint64_t Offset;
 } CFS_SymAddr_t;
 
+// CFE 파일 헤더 (CFE_FS_Header_t, 파일에는 빅엔디언으로 기록)
+#define CFE_FS_FILE_CONTENT_ID         0x63464531  // 'cFE1'
+#define CFE_FS_HDR_DESC_MAX_LEN        32
+
+// 모의 미션 식별자 (CFE_FS_WriteHeader 가 채우는 값)
+#define CFS_MOCK_SPACECRAFT_ID         0x42
+#define CFS_MOCK_PROCESSOR_ID          1
+
+typedef struct {
+    uint32 ContentType;
+    uint32 SubType;
+    uint32 Length;
+    uint32 SpacecraftID;
+    uint32 ProcessorID;
+    uint32 ApplicationID;
+    uint32 TimeSeconds;
+    uint32 TimeSubSeconds;
+    char   Description[CFE_FS_HDR_DESC_MAX_LEN];
+} CFE_FS_Header_t;
+
 // CFE Event Services 관련
 typedef uint32_t CFE_EVS_EventType_Enum_t;
 typedef uint16_t CFE_EVS_EventID_t;
 
+#define CFE_EVS_EventType_DEBUG        1
+#define CFE_EVS_EventType_INFORMATION  2
+#define CFE_EVS_EventType_ERROR        3
+#define CFE_EVS_EventType_CRITICAL     4
+
+// 이벤트 메시지 최대 길이 (CFE_MISSION_EVS_MAX_MESSAGE_LENGTH)
+#define CFS_MOCK_EVENT_TEXT_LEN        122
+#define CFS_MOCK_MAX_EVENTS            16
+
+// 캡처된 이벤트 (차분 비교, 디버깅용)
+typedef struct {
+    CFE_EVS_EventID_t        EventID;
+    CFE_EVS_EventType_Enum_t EventType;
+    char                     Text[CFS_MOCK_EVENT_TEXT_LEN];
+} CFS_MockEvent_t;
+
+// 이벤트 캡처 (스레드별, cfe_mock.c). 캡처가 꺼져 있으면 기록하지 않는다
+// with_text 가 FALSE 이면 ID/타입만 기록하고 메시지 포맷팅을 생략한다
+void CFS_MockEvents_Capture(boolean enable, boolean with_text);
+void CFS_MockEvents_Clear(void);
+uint32_t CFS_MockEvents_Count(void);
+uint32_t CFS_MockEvents_Dropped(void);
+const CFS_MockEvent_t* CFS_MockEvents_Get(uint32_t index);
+void CFS_MockEvents_Record(CFE_EVS_EventID_t EventID, CFE_EVS_EventType_Enum_t EventType,
+                           const char *Spec, va_list Args);
+
 // CFE Software Bus 함수들 (Mock)
 static inline void CFE_MSG_SetMsgId(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId) {
     if (MsgPtr) {
@@ -135,10 +223,11 @@ static inline CFE_SB_MsgId_t CFE_SB_ValueToMsgId(uint32_t MsgIdValue) {
 static inline int32_t CFE_EVS_SendEvent(CFE_EVS_EventID_t EventID, 
                                        CFE_EVS_EventType_Enum_t EventType,
                                        const char *Spec, ...) {
-    // Mock implementation - 실제로는 이벤트 메시지 전송
-    (void)EventID;
-    (void)EventType;
-    (void)Spec;
+    // Mock implementation - 실제로는 이벤트 메시지 전송, 여기서는 캡처만
+    va_list args;
+    va_start(args, Spec);
+    CFS_MockEvents_Record(EventID, EventType, Spec, args);
+    va_end(args);
     return CFE_SUCCESS;
 }
 
@@ -152,17 +241,49 @@ static inline int32_t CFE_SB_SendMsg(CFE_MSG_Message_t *MsgPtr) {
 static inline int32_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, 
                                           CFE_SB_PipeId_t PipeId,
                                           int32_t TimeOut) {
-    // Mock implementation - 실제로는 파이프에서 메시지 수신
-    (void)BufPtr;
-    (void)PipeId;
-    (void)TimeOut;
-    return CFE_SUCCESS;
+    // Mock implementation - 모의 파이프는 항상 비어 있으므로 폴링은 즉시 NO_MESSAGE,
+    // 대기는 가상 시계를 타임아웃 시각까지 건너뛴 뒤 TIME_OUT (재생 모드는 기록된 상태)
+    const int64_t in[2] = { PipeId, TimeOut };
+    int64_t out[1] = { (TimeOut == CFE_SB_POLL) ? CFE_SB_NO_MESSAGE : CFE_SB_TIME_OUT };
+    if (BufPtr) {
+        *BufPtr = NULL;
+    }
+    if (TimeOut != CFE_SB_POLL) {
+        CFS_VClock_Pend(TimeOut);
+    }
+    if (!CFS_MockTrace_Feed(CFS_MOCK_TRACE_SB_RECEIVE, in, out)) {
+        CFS_MockTrace_Record(CFS_MOCK_TRACE_SB_RECEIVE, in, out);
+    }
+    return (int32_t)out[0];
 }
 
+// CFE Time Services 함수들 (Mock)
+static inline CFE_TIME_SysTime_t CFE_TIME_GetTime(void) {
+    CFE_TIME_SysTime_t time;
+    int64_t out[2];
+    if (CFS_MockTrace_Feed(CFS_MOCK_TRACE_TIME, NULL, out)) {
+        time.Seconds = (uint32)out[0];
+        time.Subseconds = (uint32)out[1];
+        return time;
+    }
+    time = CFS_VClock_SysTime();
+    out[0] = time.Seconds;
+    out[1] = time.Subseconds;
+    CFS_MockTrace_Record(CFS_MOCK_TRACE_TIME, NULL, out);
+    return time;
+}
+
+// 미션 파일에 주소가 지정된 심볼 조회 (mission.c)
+int32_t CFS_Mission_SymbolAddress(const char *name, uint64_t *address);
+
 // OSAL 함수들 (Mock)
 static inline int32_t OS_SymbolLookup(uint64_t *SymbolAddress, const char *SymbolName) {
     // Mock implementation - 실제로는 심볼 테이블에서 주소 조회
+    // (심볼 캐시 뒤에 있으므로 기록/재생은 MM_ResolveSymAddr 단에서 한다)
     if (SymbolAddress && SymbolName) {
+        if (CFS_Mission_SymbolAddress(SymbolName, SymbolAddress) == OS_SUCCESS) {
+            return OS_SUCCESS;
+        }
         // 시뮬레이션을 위한 더미 주소 반환
         *SymbolAddress = 0x20000000 + strlen(SymbolName) * 0x1000;
         return OS_SUCCESS;
@@ -170,12 +291,22 @@ static inline int32_t OS_SymbolLookup(uint64_t *SymbolAddress, const char *Symbo
     return OS_INVALID_POINTER;
 }
 
+static inline int32_t OS_TaskDelay(uint32_t millisecond) {
+    // Mock implementation - 실제로 잠들지 않고 가상 시간만 흐름
+    const int64_t in[1] = { millisecond };
+    CFS_VClock_Advance(CFS_VCLOCK_DELAY, (uint64_t)millisecond * 1000000ULL);
+    CFS_MockTrace_Record(CFS_MOCK_TRACE_DELAY, in, NULL);
+    return OS_SUCCESS;
+}
+
 static inline int32_t OS_MemValidateRange(uint64_t Address, uint32_t Size, uint32_t MemoryType) {
-    // Mock implementation - 메모리 범위 검증
-    (void)Address;
-    (void)Size;
-    (void)MemoryType;
-    return OS_SUCCESS; // 시뮬레이션에서는 모든 주소 허용
+    // Mock implementation - 메모리 범위 검증 (시뮬레이션에서는 모든 주소 허용, 재생 모드는 기록된 상태)
+    const int64_t in[3] = { (int64_t)Address, Size, MemoryType };
+    int64_t out[1] = { OS_SUCCESS };
+    if (!CFS_MockTrace_Feed(CFS_MOCK_TRACE_MEM_VALIDATE, in, out)) {
+        CFS_MockTrace_Record(CFS_MOCK_TRACE_MEM_VALIDATE, in, out);
+    }
+    return (int32_t)out[0];
 }
 
 // 디버그 매크로
@@ -46,6 +46,10 @@
 #endif
 
 #define MM_MAX_UNINTERRUPTIBLE_DATA 200
+// 중단 불가 구간 사이에 다른 태스크에 양보하는 시간 (OS_TaskDelay, ms)
+#ifndef MM_PROCESSOR_CYCLE
+#define MM_PROCESSOR_CYCLE          1
+#endif
 #define MM_MAX_LOAD_FILE_DATA_RAM   (1024 * 1024)  // 1MB
 #define MM_MAX_LOAD_FILE_DATA_EEPROM (128 * 1024)  // 128KB
 #define MM_MAX_DUMP_FILE_DATA_RAM   (1024 * 1024)  // 1MB
@@ -82,67 +86,14 @@
     #define CFS_MEMORY_ALIGNMENT      4
 #endif
 
-// CFS 심볼들 (플랫폼별로 다를 수 있음)
-static const char* cfs_valid_symbols[] = {
-    // Core Flight Executive 기본 심볼들
-    "CFE_ES_Global",
-    "CFE_TBL_Global",
-    "CFE_EVS_Global", 
-    "CFE_SB_Global",
-    "CFE_TIME_Global",
-    
-    // MM 모듈 관련
-    "MM_AppData",
-    "MM_ResetArea",
-    "MM_CmdCounter",
-    "MM_ErrCounter",
-    
-    // 다른 CFS 앱들
-    "CS_AppData",      // Checksum 앱
-    "DS_AppData",      // Data Storage 앱  
-    "FM_AppData",      // File Manager 앱
-    "HK_AppData",      // Housekeeping 앱
-    "LC_AppData",      // Limit Checker 앱
-    "MD_AppData",      // Memory Dwell 앱
-    "SC_AppData",      // Stored Command 앱
-    "SCH_AppData",     // Scheduler 앱
-    
-    // OSAL/PSP 심볼들
-    "OS_VolumeTable",
-    "PSP_MemoryTable",
-    "CFE_PSP_MemoryTable",
-    
-    // 시스템 심볼들
-    "BSP_RAM_START",
-    "BSP_RAM_END", 
-    "BSP_EEPROM_START",
-    "BSP_EEPROM_END"
-};
-
-#define CFS_NUM_VALID_SYMBOLS (sizeof(cfs_valid_symbols) / sizeof(cfs_valid_symbols[0]))
-
-// CFS 파일 시스템 경로들
-static const char* cfs_valid_paths[] = {
-    "/cf/apps/",           // 애플리케이션 파일들
-    "/cf/download/",       // 다운로드된 파일들
-    "/cf/upload/",         // 업로드할 파일들
-    "/cf/log/",           // 로그 파일들
-    "/cf/tmp/",           // 임시 파일들
-    "/ram/",              // RAM 디스크
-    "/rom/",              // ROM 파일 시스템
-    "/vol/",              // 볼륨 마운트 포인트
-    "/data/tables/",      // 테이블 파일들
-    "/data/scripts/",     // 스크립트 파일들
-    "/data/config/",      // 설정 파일들
-    "/mission/apps/",     // 미션 특화 앱들
-    "/mission/data/",     // 미션 데이터
-    "/platform/boot/",    // 부트 파일들
-    "/platform/config/"   // 플랫폼 설정
-};
-
-#define CFS_NUM_VALID_PATHS (sizeof(cfs_valid_paths) / sizeof(cfs_valid_paths[0]))
-
-// CFS 메모리 맵 (플랫폼별로 다름)
+// 스레드 로컬 저장소 (C99 표준 키워드가 없으므로 컴파일러 확장 사용)
+#if defined(_MSC_VER)
+    #define CFS_THREAD_LOCAL __declspec(thread)
+#else
+    #define CFS_THREAD_LOCAL __thread
+#endif
+
+// CFS 메모리 영역 (미션 프로파일별로 다름)
 typedef struct {
     uint64_t start_addr;
     uint64_t end_addr;
@@ -152,43 +103,11 @@ typedef struct {
     boolean  executable;
 } CFS_MemoryRegion_t;
 
-static const CFS_MemoryRegion_t cfs_memory_regions[] = {
-    // RAM 영역들
-    {0x20000000, 0x2007FFFF, MM_RAM, "SRAM_MAIN", TRUE, TRUE},
-    {0x20080000, 0x200FFFFF, MM_RAM, "SRAM_BACKUP", TRUE, FALSE}, 
-    {0x60000000, 0x67FFFFFF, MM_RAM, "SDRAM_EXTERNAL", TRUE, TRUE},
-    
-    // EEPROM 영역들  
-    {0x08080000, 0x080FFFFF, MM_EEPROM, "EEPROM_CONFIG", TRUE, FALSE},
-    {0x08100000, 0x081FFFFF, MM_EEPROM, "EEPROM_DATA", TRUE, FALSE},
-    
-    // ROM/FLASH 영역들 (읽기 전용)
-    {0x08000000, 0x0807FFFF, 3, "FLASH_BOOT", FALSE, TRUE},
-    {0x08200000, 0x087FFFFF, 3, "FLASH_APP", FALSE, TRUE},
-};
-
-#define CFS_NUM_MEMORY_REGIONS (sizeof(cfs_memory_regions) / sizeof(cfs_memory_regions[0]))
-
-// CFS 유틸리티 함수들
-static inline boolean CFS_IsValidMemoryAddress(uint64_t addr, uint8_t mem_type, uint32_t size) {
-    for (int i = 0; i < CFS_NUM_MEMORY_REGIONS; i++) {
-        const CFS_MemoryRegion_t *region = &cfs_memory_regions[i];
-        if (region->mem_type == mem_type &&
-            addr >= region->start_addr &&
-            (addr + size - 1) <= region->end_addr) {
-            return TRUE;
-        }
-    }
-    return FALSE;
-}
-
-static inline const char* CFS_GetRandomSymbol(uint8_t seed) {
-    return cfs_valid_symbols[seed % CFS_NUM_VALID_SYMBOLS];
-}
-
-static inline const char* CFS_GetRandomPath(uint8_t seed) {
-    return cfs_valid_paths[seed % CFS_NUM_VALID_PATHS];
-}
+// 심볼/경로/메모리 영역 표는 실행 시간 미션 프로파일 (mission.h) 에 있다.
+// 아래 조회 함수들은 현재 미션 표를 기준으로 한다 (mission.c).
+boolean CFS_IsValidMemoryAddress(uint64_t addr, uint8_t mem_type, uint32_t size);
+const char* CFS_GetRandomSymbol(uint8_t seed);
+const char* CFS_GetRandomPath(uint8_t seed);
 
 static inline uint32_t CFS_GetMaxDataSize(uint8_t mem_type) {
     switch (mem_type) {
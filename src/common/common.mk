@@ -0,0 +1,243 @@
+# CFS MM Fuzzer 공통 빌드 규칙
+#
+# 하니스/도구 Makefile에서 include 하여 사용한다.
+#   - 변형(variant)별 오브젝트 디렉토리: build/<type>/obj/<variant>/...
+#   - 변형별 정적 라이브러리: build/<type>/lib/<variant>/libcfs_common.a
+#   - -MMD 의존성 추적, 플래그 변경 감지, ccache 자동 사용
+#   - 타겟별 소요 시간은 build_stats.log 에 기록
+#
+# include 전에 설정하는 변수:
+#   HARNESS      - 하니스 이름 (예: mm_load). 비어 있으면 라이브러리 규칙만 정의
+#   HARNESS_SRC  - 하니스 소스 파일 목록
+#   TOOL         - 도구 이름 (예: cfs_corpus_pack). standalone 변형 라이브러리에 링크
+#   TOOL_SRC     - 도구 소스 파일 목록
+
+CFS_MK_DIR := $(patsubst %/,%,$(dir $(lastword $(MAKEFILE_LIST))))
+ROOT_DIR   := $(abspath $(CFS_MK_DIR)/../..)
+COMMON_DIR := $(ROOT_DIR)/src/common
+
+CC = clang
+CXX = clang++
+AR ?= ar
+
+# 기본 컴파일 플래그
+CFLAGS_BASE = -Wall -Wextra -std=c99 -pthread
+CXXFLAGS_BASE = -Wall -Wextra -std=c++11
+
+# 빌드 타입별 플래그
+ifeq ($(BUILD_TYPE),Debug)
+    CFLAGS = $(CFLAGS_BASE) -g -O0 -DCFS_DEBUG_MODE=1
+    CXXFLAGS = $(CXXFLAGS_BASE) -g -O0 -DCFS_DEBUG_MODE=1
+    BUILD_DIR = $(ROOT_DIR)/build/debug
+    BIN_DIR = $(ROOT_DIR)/bin/debug
+else
+    CFLAGS = $(CFLAGS_BASE) -O2 -DNDEBUG
+    CXXFLAGS = $(CXXFLAGS_BASE) -O2 -DNDEBUG
+    BUILD_DIR = $(ROOT_DIR)/build/release
+    BIN_DIR = $(ROOT_DIR)/bin/release
+endif
+
+# Sanitizer 플래그
+ifeq ($(ENABLE_SANITIZERS),true)
+    SANITIZER_FLAGS = -fsanitize=address,undefined -fno-omit-frame-pointer
+    CFLAGS += $(SANITIZER_FLAGS)
+    CXXFLAGS += $(SANITIZER_FLAGS)
+endif
+
+# Coverage 플래그
+COVERAGE_FLAGS = --coverage
+ifeq ($(ENABLE_COVERAGE),true)
+    CFLAGS += $(COVERAGE_FLAGS)
+    CXXFLAGS += $(COVERAGE_FLAGS)
+endif
+
+# Source-based coverage 플래그 (llvmcov 변형, clang 필요)
+LLVM_COVERAGE_FLAGS = -fprofile-instr-generate -fcoverage-mapping
+LLVM_CC ?= clang
+
+# 프로세스 내 다중 워커 퍼징 (mtfuzz 변형, gcc/clang 의 trace-pc 콜백으로 에지 수집)
+MTFUZZ_FLAGS = -DCFS_FUZZ_TRACE_PC -fsanitize-coverage=trace-pc
+
+# 단계별 프로파일러 (rdtsc 계측, 기본 빌드에서는 제외)
+ifeq ($(ENABLE_PROFILE),true)
+    CFLAGS += -DCFS_PROFILE_STAGES=1
+endif
+
+# 포함 디렉토리 / 라이브러리
+INCLUDES = -I$(COMMON_DIR)
+LIBS = -lm -lrt -pthread
+
+# 의존성 파일 생성 (헤더 변경 시 해당 오브젝트만 재빌드)
+DEPFLAGS = -MMD -MP
+
+# ccache 자동 사용 (CCACHE= 로 비활성화 가능)
+CCACHE ?= $(shell command -v ccache 2>/dev/null)
+export CCACHE_BASEDIR ?= $(ROOT_DIR)
+export CCACHE_NOHASHDIR ?= 1
+
+# 타겟별 소요 시간 기록
+BUILD_STATS_FILE ?= $(ROOT_DIR)/build_stats.log
+TIMED = $(ROOT_DIR)/scripts/timed_build.sh $(BUILD_STATS_FILE)
+
+# 빌드 변형들
+VARIANTS = fuzzer standalone afl coverage llvmcov mtfuzz
+
+AFL_CC := $(shell command -v afl-clang-fast 2>/dev/null)
+
+# 변형별 컴파일러/플래그
+VARIANT_CC_fuzzer         = $(CC)
+VARIANT_CC_standalone     = $(CC)
+VARIANT_CC_afl            = $(AFL_CC)
+VARIANT_CC_coverage       = $(CC)
+VARIANT_CC_llvmcov        = $(LLVM_CC)
+VARIANT_CC_mtfuzz         = $(CC)
+
+VARIANT_CFLAGS_fuzzer     = -fsanitize=fuzzer-no-link,address
+VARIANT_CFLAGS_standalone = -DSTANDALONE_TEST
+VARIANT_CFLAGS_afl        = -DSTANDALONE_TEST
+VARIANT_CFLAGS_coverage   = -DSTANDALONE_TEST $(COVERAGE_FLAGS)
+VARIANT_CFLAGS_llvmcov    = -DSTANDALONE_TEST $(LLVM_COVERAGE_FLAGS)
+VARIANT_CFLAGS_mtfuzz     = -DSTANDALONE_TEST $(MTFUZZ_FLAGS)
+
+VARIANT_LDFLAGS_fuzzer    = -fsanitize=fuzzer,address
+VARIANT_LDFLAGS_standalone =
+VARIANT_LDFLAGS_afl       =
+VARIANT_LDFLAGS_coverage  = $(COVERAGE_FLAGS)
+VARIANT_LDFLAGS_llvmcov   = -fprofile-instr-generate
+VARIANT_LDFLAGS_mtfuzz    =
+
+# 변형별 바이너리 접미사
+VARIANT_SUFFIX_fuzzer     = _fuzzer
+VARIANT_SUFFIX_standalone = _test
+VARIANT_SUFFIX_afl        = _afl
+VARIANT_SUFFIX_coverage   = _test_cov
+VARIANT_SUFFIX_llvmcov    = _test_llvmcov
+VARIANT_SUFFIX_mtfuzz     = _mtfuzz
+
+OBJ_ROOT = $(BUILD_DIR)/obj
+LIB_ROOT = $(BUILD_DIR)/lib
+
+COMMON_SOURCES = $(wildcard $(COMMON_DIR)/*.c)
+
+variant_cflags = $(CFLAGS) $(VARIANT_CFLAGS_$(1)) $(INCLUDES)
+common_objs    = $(patsubst $(COMMON_DIR)/%.c,$(OBJ_ROOT)/$(1)/common/%.o,$(COMMON_SOURCES))
+common_lib     = $(LIB_ROOT)/$(1)/libcfs_common.a
+flags_stamp    = $(OBJ_ROOT)/$(1)/.flags
+
+# 변형별 공통 라이브러리 규칙
+define CFS_VARIANT_RULES
+$(call flags_stamp,$(1)): FORCE
+	@mkdir -p $$(@D)
+	@echo '$$(VARIANT_CC_$(1)) $$(call variant_cflags,$(1))' | cmp -s - $$@ || \
+		echo '$$(VARIANT_CC_$(1)) $$(call variant_cflags,$(1))' > $$@
+
+$(OBJ_ROOT)/$(1)/common/%.o: $(COMMON_DIR)/%.c $(call flags_stamp,$(1))
+	@mkdir -p $$(@D)
+	@echo "  CC      common/$$(notdir $$@) [$(1)]"
+	@$$(TIMED) $(1)/common/$$(notdir $$@) $$(CCACHE) $$(VARIANT_CC_$(1)) \
+		$$(call variant_cflags,$(1)) $$(DEPFLAGS) -c $$< -o $$@
+
+$(call common_lib,$(1)): $(call common_objs,$(1))
+	@mkdir -p $$(@D)
+	@echo "  AR      libcfs_common.a [$(1)]"
+	@rm -f $$@
+	@$$(TIMED) $(1)/libcfs_common.a $$(AR) rcs $$@ $$^
+
+lib-$(1): $(call common_lib,$(1))
+
+-include $(patsubst %.o,%.d,$(call common_objs,$(1)))
+endef
+
+$(foreach v,$(VARIANTS),$(eval $(call CFS_VARIANT_RULES,$(v))))
+
+# 하니스 규칙 (HARNESS 가 설정된 경우)
+ifneq ($(HARNESS),)
+
+harness_objs = $(patsubst %.c,$(OBJ_ROOT)/$(1)/$(HARNESS)/%.o,$(HARNESS_SRC))
+harness_bin  = $(BIN_DIR)/$(HARNESS)$(VARIANT_SUFFIX_$(1))
+
+FUZZER_BIN = $(call harness_bin,fuzzer)
+STANDALONE_BIN = $(call harness_bin,standalone)
+AFL_BIN = $(call harness_bin,afl)
+COVERAGE_BIN = $(call harness_bin,coverage)
+LLVMCOV_BIN = $(call harness_bin,llvmcov)
+MTFUZZ_BIN = $(call harness_bin,mtfuzz)
+
+define CFS_HARNESS_RULES
+$(OBJ_ROOT)/$(1)/$(HARNESS)/%.o: %.c $(call flags_stamp,$(1))
+	@mkdir -p $$(@D)
+	@echo "  CC      $(HARNESS)/$$(notdir $$@) [$(1)]"
+	@$$(TIMED) $(1)/$(HARNESS)/$$(notdir $$@) $$(CCACHE) $$(VARIANT_CC_$(1)) \
+		$$(call variant_cflags,$(1)) $(HARNESS_CFLAGS) $$(DEPFLAGS) -c $$< -o $$@
+
+$(call harness_bin,$(1)): $(call harness_objs,$(1)) $(call common_lib,$(1))
+	@mkdir -p $$(@D)
+	@echo "  LD      $$(notdir $$@)"
+	@$$(TIMED) $$(notdir $$@) $$(VARIANT_CC_$(1)) $$(CFLAGS) $$(VARIANT_LDFLAGS_$(1)) \
+		-o $$@ $(call harness_objs,$(1)) $(call common_lib,$(1)) $$(LIBS) $(HARNESS_LIBS)
+
+-include $(patsubst %.o,%.d,$(call harness_objs,$(1)))
+endef
+
+$(foreach v,$(VARIANTS),$(eval $(call CFS_HARNESS_RULES,$(v))))
+
+directories:
+	@mkdir -p $(BUILD_DIR)
+	@mkdir -p $(BIN_DIR)
+
+# LibFuzzer 빌드
+fuzzer: $(FUZZER_BIN)
+
+# 독립 실행 테스트 빌드
+standalone: $(STANDALONE_BIN)
+
+# AFL++ 빌드 (AFL++가 설치된 경우)
+ifneq ($(AFL_CC),)
+afl: $(AFL_BIN)
+else
+afl:
+	@echo "AFL++ not found, skipping AFL build"
+endif
+
+# Coverage 빌드
+coverage: $(COVERAGE_BIN)
+
+# Source-based coverage 빌드 (대규모 코퍼스 보고서용)
+llvmcov: $(LLVMCOV_BIN)
+
+# 프로세스 내 다중 워커 퍼저 빌드 (-fuzz -workers=N)
+mtfuzz: $(MTFUZZ_BIN)
+
+.PHONY: directories fuzzer standalone afl coverage llvmcov mtfuzz
+
+endif
+
+# 도구 규칙 (TOOL 이 설정된 경우)
+ifneq ($(TOOL),)
+
+tool_objs = $(patsubst %.c,$(OBJ_ROOT)/standalone/$(TOOL)/%.o,$(TOOL_SRC))
+TOOL_BIN = $(BIN_DIR)/$(TOOL)
+
+$(OBJ_ROOT)/standalone/$(TOOL)/%.o: %.c $(call flags_stamp,standalone)
+	@mkdir -p $(@D)
+	@echo "  CC      $(TOOL)/$(notdir $@)"
+	@$(TIMED) $(TOOL)/$(notdir $@) $(CCACHE) $(CC) \
+		$(call variant_cflags,standalone) $(DEPFLAGS) -c $< -o $@
+
+$(TOOL_BIN): $(tool_objs) $(call common_lib,standalone)
+	@mkdir -p $(@D)
+	@echo "  LD      $(notdir $@)"
+	@$(TIMED) $(notdir $@) $(CC) $(CFLAGS) -o $@ $(tool_objs) \
+		$(call common_lib,standalone) $(LIBS) $(TOOL_LIBS)
+
+-include $(patsubst %.o,%.d,$(tool_objs))
+
+tool: $(TOOL_BIN)
+
+.PHONY: tool
+
+endif
+
+FORCE:
+
+.PHONY: FORCE $(foreach v,$(VARIANTS),lib-$(v))
@@ -0,0 +1,497 @@
+/*
+ * CFS 코퍼스 팩 포맷
+ * 디렉토리 코퍼스 <-> 단일 팩 파일 변환과 mmap 기반 무복사 순회
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "corpus_pack.h"
+#include "utils.h"
+
+#include <dirent.h>
+#include <stddef.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define PACK_ALIGN_UP(x) (((x) + CFS_CORPUS_PACK_ALIGN - 1) & ~((uint64_t)CFS_CORPUS_PACK_ALIGN - 1))
+
+static uint32_t Pack_Crc(const void *data, size_t length) {
+    return MM_CalculateCRC32(data, length, 0xFFFFFFFF) ^ 0xFFFFFFFF;
+}
+
+static uint32_t Pack_HeaderCrc(const CFS_CorpusPackHeader_t *header) {
+    return Pack_Crc(header, offsetof(CFS_CorpusPackHeader_t, header_crc));
+}
+
+/*
+ * 팩 파일 열기 (mmap + 헤더/인덱스 검증)
+ * 페이로드 CRC 는 비용이 크므로 CFS_CorpusPack_Verify 에서 별도로 검사한다.
+ */
+int32_t CFS_CorpusPack_Open(CFS_CorpusPack_t *pack, const char *path) {
+    if (!pack || !path) {
+        return OS_INVALID_POINTER;
+    }
+    memset(pack, 0, sizeof(*pack));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        CFS_DEBUG_PRINT("Cannot open corpus pack: %s", path);
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(CFS_CorpusPackHeader_t)) {
+        close(fd);
+        return CFS_MM_ERROR_INVALID_FILE;
+    }
+
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    pack->base = base;
+    pack->size = (size_t)st.st_size;
+    pack->header = (const CFS_CorpusPackHeader_t *)base;
+
+    const CFS_CorpusPackHeader_t *h = pack->header;
+    uint64_t index_bytes = (uint64_t)h->entry_count * sizeof(CFS_CorpusPackEntry_t);
+
+    // 인덱스는 mmap 위에서 엔트리 배열로 직접 읽으므로 엔트리 정렬이어야 한다
+    if (memcmp(h->magic, CFS_CORPUS_PACK_MAGIC, sizeof(h->magic)) != 0 ||
+        h->version != CFS_CORPUS_PACK_VERSION ||
+        h->header_crc != Pack_HeaderCrc(h) ||
+        h->total_size != pack->size ||
+        h->index_offset < sizeof(CFS_CorpusPackHeader_t) ||
+        h->index_offset % __alignof__(CFS_CorpusPackEntry_t) != 0 ||
+        h->index_offset > h->names_offset ||
+        index_bytes > h->names_offset - h->index_offset ||
+        h->names_offset > h->payload_offset ||
+        h->payload_offset > h->total_size) {
+        CFS_DEBUG_PRINT("Corrupt corpus pack header: %s", path);
+        CFS_CorpusPack_Close(pack);
+        return CFS_MM_ERROR_INVALID_FILE;
+    }
+
+    if (h->index_crc != Pack_Crc(pack->base + h->index_offset, h->payload_offset - h->index_offset)) {
+        CFS_DEBUG_PRINT("Corpus pack index CRC mismatch: %s", path);
+        CFS_CorpusPack_Close(pack);
+        return CFS_MM_ERROR_CRC_MISMATCH;
+    }
+
+    pack->entries = (const CFS_CorpusPackEntry_t *)(pack->base + h->index_offset);
+    pack->names = (const char *)(pack->base + h->names_offset);
+    pack->payload = pack->base + h->payload_offset;
+
+    // 엔트리 범위 검사 (이후 Get 은 검사 없이 포인터만 반환)
+    uint64_t payload_size = h->total_size - h->payload_offset;
+    uint64_t names_size = h->payload_offset - h->names_offset;
+    for (uint32_t i = 0; i < h->entry_count; i++) {
+        const CFS_CorpusPackEntry_t *e = &pack->entries[i];
+        if (e->offset > payload_size || e->size > payload_size - e->offset ||
+            (uint64_t)e->name_offset + e->name_length >= names_size ||
+            pack->names[e->name_offset + e->name_length] != '\0') {
+            CFS_DEBUG_PRINT("Corpus pack entry %u out of bounds: %s", i, path);
+            CFS_CorpusPack_Close(pack);
+            return CFS_MM_ERROR_INVALID_FILE;
+        }
+    }
+
+    posix_madvise((void *)pack->payload, (size_t)payload_size, POSIX_MADV_SEQUENTIAL);
+    return CFE_SUCCESS;
+}
+
+void CFS_CorpusPack_Close(CFS_CorpusPack_t *pack) {
+    if (pack && pack->base) {
+        munmap((void *)pack->base, pack->size);
+    }
+    if (pack) {
+        memset(pack, 0, sizeof(*pack));
+    }
+}
+
+/*
+ * 엔트리 조회 (mmap 영역을 직접 가리키는 포인터 반환)
+ */
+int32_t CFS_CorpusPack_Get(const CFS_CorpusPack_t *pack, uint32_t index,
+                           const uint8_t **data, size_t *size) {
+    if (!pack || !pack->header || !data || !size) {
+        return OS_INVALID_POINTER;
+    }
+    if (index >= pack->header->entry_count) {
+        return OS_ERROR;
+    }
+
+    *data = pack->payload + pack->entries[index].offset;
+    *size = pack->entries[index].size;
+    return CFE_SUCCESS;
+}
+
+const char* CFS_CorpusPack_GetName(const CFS_CorpusPack_t *pack, uint32_t index) {
+    if (!pack || !pack->header || index >= pack->header->entry_count) {
+        return NULL;
+    }
+    return pack->names + pack->entries[index].name_offset;
+}
+
+/*
+ * 페이로드 CRC 전체 검증
+ */
+int32_t CFS_CorpusPack_Verify(const CFS_CorpusPack_t *pack, uint32_t *bad_index) {
+    if (!pack || !pack->header) {
+        return OS_INVALID_POINTER;
+    }
+
+    for (uint32_t i = 0; i < pack->header->entry_count; i++) {
+        const CFS_CorpusPackEntry_t *e = &pack->entries[i];
+        if (Pack_Crc(pack->payload + e->offset, e->size) != e->crc) {
+            if (bad_index) {
+                *bad_index = i;
+            }
+            return CFS_MM_ERROR_CRC_MISMATCH;
+        }
+    }
+    return CFE_SUCCESS;
+}
+
+int32_t CFS_CorpusPack_ForEach(const CFS_CorpusPack_t *pack,
+                               CFS_CorpusPackVisitor_t visitor, void *context) {
+    if (!pack || !pack->header || !visitor) {
+        return OS_INVALID_POINTER;
+    }
+
+    for (uint32_t i = 0; i < pack->header->entry_count; i++) {
+        const CFS_CorpusPackEntry_t *e = &pack->entries[i];
+        if (visitor(pack->payload + e->offset, e->size, pack->names + e->name_offset, context) != 0) {
+            break;
+        }
+    }
+    return CFE_SUCCESS;
+}
+
+/*
+ * 파일이 팩 포맷인지 매직으로 확인
+ */
+boolean CFS_CorpusPack_IsPackFile(const char *path) {
+    char magic[8];
+    boolean result = FALSE;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return FALSE;
+    }
+    if (read(fd, magic, sizeof(magic)) == (ssize_t)sizeof(magic) &&
+        memcmp(magic, CFS_CORPUS_PACK_MAGIC, sizeof(magic)) == 0) {
+        result = TRUE;
+    }
+    close(fd);
+    return result;
+}
+
+/*
+ * 팩 작성기
+ */
+void CFS_CorpusPackWriter_Init(CFS_CorpusPackWriter_t *writer) {
+    if (writer) {
+        memset(writer, 0, sizeof(*writer));
+    }
+}
+
+static int32_t Pack_Reserve(void **buf, size_t *capacity, size_t needed, size_t elem_size) {
+    if (needed <= *capacity) {
+        return CFE_SUCCESS;
+    }
+
+    size_t new_capacity = *capacity ? *capacity : 64;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+
+    void *p = realloc(*buf, new_capacity * elem_size);
+    if (!p) {
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+    *buf = p;
+    *capacity = new_capacity;
+    return CFE_SUCCESS;
+}
+
+int32_t CFS_CorpusPackWriter_Add(CFS_CorpusPackWriter_t *writer, const char *name,
+                                 const uint8_t *data, size_t size) {
+    if (!writer || (!data && size > 0)) {
+        return OS_INVALID_POINTER;
+    }
+    if (size > UINT32_MAX || writer->entry_count == UINT32_MAX) {
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+
+    char default_name[32];
+    if (!name || name[0] == '\0') {
+        snprintf(default_name, sizeof(default_name), "input-%08u", writer->entry_count);
+        name = default_name;
+    }
+    size_t name_length = strlen(name);
+
+    size_t entry_capacity = writer->entry_capacity;
+    size_t payload_offset = PACK_ALIGN_UP(writer->payload_size);
+
+    if (Pack_Reserve((void **)&writer->entries, &entry_capacity, writer->entry_count + 1,
+                     sizeof(CFS_CorpusPackEntry_t)) != CFE_SUCCESS ||
+        Pack_Reserve((void **)&writer->names, &writer->names_capacity,
+                     writer->names_size + name_length + 1, 1) != CFE_SUCCESS ||
+        Pack_Reserve((void **)&writer->payload, &writer->payload_capacity,
+                     payload_offset + size, 1) != CFE_SUCCESS) {
+        writer->entry_capacity = (uint32_t)entry_capacity;
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+    writer->entry_capacity = (uint32_t)entry_capacity;
+
+    if (payload_offset > writer->payload_size) {
+        memset(writer->payload + writer->payload_size, 0, payload_offset - writer->payload_size);
+    }
+    if (size > 0) {
+        memcpy(writer->payload + payload_offset, data, size);
+    }
+    memcpy(writer->names + writer->names_size, name, name_length + 1);
+
+    CFS_CorpusPackEntry_t *e = &writer->entries[writer->entry_count++];
+    e->offset = payload_offset;
+    e->size = (uint32_t)size;
+    e->crc = Pack_Crc(data, size);
+    e->name_offset = (uint32_t)writer->names_size;
+    e->name_length = (uint32_t)name_length;
+
+    writer->names_size += name_length + 1;
+    writer->payload_size = payload_offset + size;
+    return CFE_SUCCESS;
+}
+
+static int32_t Pack_WriteAll(int fd, const void *data, size_t size) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return CFS_MM_ERROR_FILE_ACCESS;
+        }
+        p += n;
+        size -= (size_t)n;
+    }
+    return CFE_SUCCESS;
+}
+
+// size 바이트를 모두 읽기 (EINTR 재시도, 오류나 중간 EOF 는 실패)
+static int32_t Pack_ReadAll(int fd, void *data, size_t size) {
+    uint8_t *p = (uint8_t *)data;
+    while (size > 0) {
+        ssize_t n = read(fd, p, size);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return CFS_MM_ERROR_FILE_ACCESS;
+        }
+        if (n == 0) {
+            return CFS_MM_ERROR_FILE_ACCESS;
+        }
+        p += n;
+        size -= (size_t)n;
+    }
+    return CFE_SUCCESS;
+}
+
+/*
+ * 팩 파일 기록 (임시 파일에 쓴 뒤 rename 으로 교체)
+ */
+int32_t CFS_CorpusPackWriter_Finish(CFS_CorpusPackWriter_t *writer, const char *path) {
+    if (!writer || !path) {
+        return OS_INVALID_POINTER;
+    }
+
+    CFS_CorpusPackHeader_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CFS_CORPUS_PACK_MAGIC, sizeof(header.magic));
+    header.version = CFS_CORPUS_PACK_VERSION;
+    header.entry_count = writer->entry_count;
+    header.index_offset = PACK_ALIGN_UP(sizeof(header));
+    header.names_offset = header.index_offset +
+                          (uint64_t)writer->entry_count * sizeof(CFS_CorpusPackEntry_t);
+    header.payload_offset = PACK_ALIGN_UP(header.names_offset + writer->names_size);
+    header.total_size = header.payload_offset + writer->payload_size;
+
+    // 인덱스 CRC 는 이름 테이블 뒤 정렬 패딩까지 포함
+    size_t meta_size = (size_t)(header.payload_offset - header.index_offset);
+    uint8_t *meta = calloc(1, meta_size ? meta_size : 1);
+    if (!meta) {
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+    if (writer->entry_count > 0) {
+        memcpy(meta, writer->entries, writer->entry_count * sizeof(CFS_CorpusPackEntry_t));
+    }
+    if (writer->names_size > 0) {
+        memcpy(meta + (header.names_offset - header.index_offset), writer->names, writer->names_size);
+    }
+    header.index_crc = Pack_Crc(meta, meta_size);
+    header.header_crc = Pack_HeaderCrc(&header);
+
+    char tmp_path[OS_MAX_PATH_LEN * 4];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp.%ld", path, (long)getpid());
+
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        free(meta);
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    uint8_t pad[CFS_CORPUS_PACK_ALIGN] = {0};
+    int32_t status = Pack_WriteAll(fd, &header, sizeof(header));
+    if (status == CFE_SUCCESS) {
+        status = Pack_WriteAll(fd, pad, (size_t)(header.index_offset - sizeof(header)));
+    }
+    if (status == CFE_SUCCESS) {
+        status = Pack_WriteAll(fd, meta, meta_size);
+    }
+    if (status == CFE_SUCCESS && writer->payload_size > 0) {
+        status = Pack_WriteAll(fd, writer->payload, writer->payload_size);
+    }
+    free(meta);
+
+    if (close(fd) != 0 && status == CFE_SUCCESS) {
+        status = CFS_MM_ERROR_FILE_ACCESS;
+    }
+    if (status == CFE_SUCCESS && rename(tmp_path, path) != 0) {
+        status = CFS_MM_ERROR_FILE_ACCESS;
+    }
+    if (status != CFE_SUCCESS) {
+        unlink(tmp_path);
+    }
+    return status;
+}
+
+void CFS_CorpusPackWriter_Free(CFS_CorpusPackWriter_t *writer) {
+    if (!writer) {
+        return;
+    }
+    free(writer->entries);
+    free(writer->names);
+    free(writer->payload);
+    memset(writer, 0, sizeof(*writer));
+}
+
+/*
+ * 디렉토리 -> 팩 (이름 순으로 정렬하여 결과를 재현 가능하게 유지)
+ */
+static int Pack_NameFilter(const struct dirent *entry) {
+    return entry->d_name[0] != '.';
+}
+
+static int Pack_NameCompare(const struct dirent **a, const struct dirent **b) {
+    return strcmp((*a)->d_name, (*b)->d_name);
+}
+
+int32_t CFS_CorpusPack_FromDirectory(const char *dir, const char *pack_path, uint32_t *count) {
+    if (!dir || !pack_path) {
+        return OS_INVALID_POINTER;
+    }
+
+    struct dirent **names = NULL;
+    int n = scandir(dir, &names, Pack_NameFilter, Pack_NameCompare);
+    if (n < 0) {
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    CFS_CorpusPackWriter_t writer;
+    CFS_CorpusPackWriter_Init(&writer);
+
+    int32_t status = CFE_SUCCESS;
+    uint8_t *buffer = NULL;
+    size_t buffer_capacity = 0;
+    char path[4096];
+
+    for (int i = 0; i < n; i++) {
+        if (status == CFE_SUCCESS) {
+            snprintf(path, sizeof(path), "%s/%s", dir, names[i]->d_name);
+
+            struct stat st;
+            int fd = open(path, O_RDONLY);
+            if (fd >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+                size_t size = (size_t)st.st_size;
+                if (Pack_Reserve((void **)&buffer, &buffer_capacity, size ? size : 1, 1) != CFE_SUCCESS) {
+                    status = CFS_MM_ERROR_RESOURCE_LIMIT;
+                } else {
+                    // 잘린 입력을 팩에 넣지 않도록 읽기 실패/파일 축소는 팩 전체 실패로 처리
+                    status = Pack_ReadAll(fd, buffer, size);
+                    if (status == CFE_SUCCESS) {
+                        status = CFS_CorpusPackWriter_Add(&writer, names[i]->d_name, buffer, size);
+                    }
+                }
+            }
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+        free(names[i]);
+    }
+    free(names);
+    free(buffer);
+
+    if (status == CFE_SUCCESS) {
+        status = CFS_CorpusPackWriter_Finish(&writer, pack_path);
+    }
+    if (count) {
+        *count = writer.entry_count;
+    }
+    CFS_CorpusPackWriter_Free(&writer);
+    return status;
+}
+
+/*
+ * 팩 -> 디렉토리 (libFuzzer/AFL 이 기대하는 파일당 입력 하나 레이아웃)
+ */
+int32_t CFS_CorpusPack_ToDirectory(const CFS_CorpusPack_t *pack, const char *dir, uint32_t *count) {
+    if (!pack || !pack->header || !dir) {
+        return OS_INVALID_POINTER;
+    }
+
+    if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    char path[4096];
+    uint32_t written = 0;
+    int32_t status = CFE_SUCCESS;
+
+    for (uint32_t i = 0; i < pack->header->entry_count && status == CFE_SUCCESS; i++) {
+        const CFS_CorpusPackEntry_t *e = &pack->entries[i];
+        const char *name = pack->names + e->name_offset;
+
+        // 경로 구분자가 포함된 이름은 인덱스 기반 이름으로 대체
+        if (e->name_length == 0 || strchr(name, '/') || name[0] == '.') {
+            snprintf(path, sizeof(path), "%s/input-%08u", dir, i);
+        } else {
+            snprintf(path, sizeof(path), "%s/%s", dir, name);
+        }
+
+        int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            status = CFS_MM_ERROR_FILE_ACCESS;
+            break;
+        }
+        status = Pack_WriteAll(fd, pack->payload + e->offset, e->size);
+        close(fd);
+        if (status == CFE_SUCCESS) {
+            written++;
+        }
+    }
+
+    if (count) {
+        *count = written;
+    }
+    return status;
+}
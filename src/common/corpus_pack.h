@@ -0,0 +1,100 @@
+/*
+ * CFS 코퍼스 팩 포맷 헤더
+ *
+ * 수십만 개의 작은 시드 파일을 하나의 파일(헤더 + 인덱스 + 이름 테이블 +
+ * 연속 페이로드)로 묶어 mmap 한 번으로 복사 없이 순회할 수 있게 한다.
+ *
+ * 파일 레이아웃 (리틀 엔디언):
+ *   [CFS_CorpusPackHeader_t]
+ *   [CFS_CorpusPackEntry_t x entry_count]
+ *   [이름 테이블 (NUL 종료 문자열들)]
+ *   [페이로드 (각 엔트리 8바이트 정렬)]
+ */
+
+#ifndef CFS_CORPUS_PACK_H
+#define CFS_CORPUS_PACK_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+#define CFS_CORPUS_PACK_MAGIC       "CFSPACK1"
+#define CFS_CORPUS_PACK_VERSION     1
+#define CFS_CORPUS_PACK_ALIGN       8
+#define CFS_CORPUS_PACK_EXT         ".pack"
+
+// 팩 헤더
+typedef struct {
+    char     magic[8];          // CFS_CORPUS_PACK_MAGIC
+    uint32_t version;           // CFS_CORPUS_PACK_VERSION
+    uint32_t entry_count;       // 엔트리 수
+    uint64_t index_offset;      // 인덱스 시작 위치
+    uint64_t names_offset;      // 이름 테이블 시작 위치
+    uint64_t payload_offset;    // 페이로드 시작 위치
+    uint64_t total_size;        // 전체 파일 크기
+    uint32_t index_crc;         // 인덱스 + 이름 테이블 CRC32
+    uint32_t header_crc;        // header_crc 필드 이전까지의 헤더 CRC32
+} CFS_CorpusPackHeader_t;
+
+// 인덱스 엔트리
+typedef struct {
+    uint64_t offset;            // 페이로드 영역 기준 오프셋
+    uint32_t size;              // 입력 크기
+    uint32_t crc;               // 입력 CRC32
+    uint32_t name_offset;       // 이름 테이블 기준 오프셋
+    uint32_t name_length;       // 이름 길이 (NUL 제외)
+} CFS_CorpusPackEntry_t;
+
+// mmap 된 팩 (읽기 전용)
+typedef struct {
+    const uint8_t                *base;
+    size_t                        size;
+    const CFS_CorpusPackHeader_t *header;
+    const CFS_CorpusPackEntry_t  *entries;
+    const char                   *names;
+    const uint8_t                *payload;
+} CFS_CorpusPack_t;
+
+// 팩 작성기 (메모리에 모은 뒤 한 번에 기록)
+typedef struct {
+    CFS_CorpusPackEntry_t *entries;
+    uint32_t               entry_count;
+    uint32_t               entry_capacity;
+    char                  *names;
+    size_t                 names_size;
+    size_t                 names_capacity;
+    uint8_t               *payload;
+    size_t                 payload_size;
+    size_t                 payload_capacity;
+} CFS_CorpusPackWriter_t;
+
+// 순회 콜백 (0 이외 반환 시 순회 중단)
+typedef int (*CFS_CorpusPackVisitor_t)(const uint8_t *data, size_t size,
+                                       const char *name, void *context);
+
+// 읽기
+int32_t CFS_CorpusPack_Open(CFS_CorpusPack_t *pack, const char *path);
+void    CFS_CorpusPack_Close(CFS_CorpusPack_t *pack);
+int32_t CFS_CorpusPack_Get(const CFS_CorpusPack_t *pack, uint32_t index,
+                           const uint8_t **data, size_t *size);
+const char* CFS_CorpusPack_GetName(const CFS_CorpusPack_t *pack, uint32_t index);
+int32_t CFS_CorpusPack_Verify(const CFS_CorpusPack_t *pack, uint32_t *bad_index);
+int32_t CFS_CorpusPack_ForEach(const CFS_CorpusPack_t *pack,
+                               CFS_CorpusPackVisitor_t visitor, void *context);
+boolean CFS_CorpusPack_IsPackFile(const char *path);
+
+static inline uint32_t CFS_CorpusPack_Count(const CFS_CorpusPack_t *pack) {
+    return (pack && pack->header) ? pack->header->entry_count : 0;
+}
+
+// 쓰기
+void    CFS_CorpusPackWriter_Init(CFS_CorpusPackWriter_t *writer);
+int32_t CFS_CorpusPackWriter_Add(CFS_CorpusPackWriter_t *writer, const char *name,
+                                 const uint8_t *data, size_t size);
+int32_t CFS_CorpusPackWriter_Finish(CFS_CorpusPackWriter_t *writer, const char *path);
+void    CFS_CorpusPackWriter_Free(CFS_CorpusPackWriter_t *writer);
+
+// 디렉토리 레이아웃 (libFuzzer/AFL) 변환
+int32_t CFS_CorpusPack_FromDirectory(const char *dir, const char *pack_path, uint32_t *count);
+int32_t CFS_CorpusPack_ToDirectory(const CFS_CorpusPack_t *pack, const char *dir, uint32_t *count);
+
+#endif // CFS_CORPUS_PACK_H
@@ -0,0 +1,331 @@
+/*
+ * CFS 차분(differential) 실행
+ *
+ * 두 구현은 같은 디코딩된 명령과 같은 시작 상태를 공유한다.
+ *   1. HK 상태 저장, 이벤트 캡처와 메모리 저널 시작
+ *   2. 참조 구현 실행 → 관찰
+ *   3. 저널 되돌림, HK 복원
+ *   4. 시뮬레이션 실행 → 관찰, 저널 확정
+ * 참조 쪽 (와 불일치 보고용 재실행) 의 EEPROM 프로그램은 마모/지연 기록에서 빼고,
+ * 가상 시계는 참조 실행 뒤 되감아 시뮬레이션이 같은 시각에서 시작한다.
+ * 메모리 스냅샷 대신 실제로 쓴 바이트만 저널로 되돌리므로
+ * 추가 비용은 두 번째 실행과 쓴 구간 복사 정도에 그친다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "differential.h"
+#include "eeprom.h"
+#include "sim_mem.h"
+#include "target_san.h"
+#include "utils.h"
+#include "vclock.h"
+
+typedef struct {
+    boolean fatal;
+    boolean loose_errors;
+} DiffConfig_t;
+
+static DiffConfig_t g_diff_config = { TRUE, FALSE };
+static CFS_DiffStats_t g_diff_stats;
+
+// 쓰기 구간 병합용 작업 버퍼 (스레드별)
+static CFS_THREAD_LOCAL CFS_SimMemWrite_t *t_extent_scratch = NULL;
+static CFS_THREAD_LOCAL uint32_t t_extent_capacity = 0;
+
+void CFS_Diff_Configure(boolean fatal, boolean loose_errors) {
+    g_diff_config.fatal = fatal;
+    g_diff_config.loose_errors = loose_errors;
+}
+
+static boolean Diff_EnvFlag(const char *name, boolean default_value) {
+    const char *value = getenv(name);
+    if (!value || value[0] == '\0') {
+        return default_value;
+    }
+    return (value[0] != '0');
+}
+
+void CFS_Diff_ConfigureFromEnv(boolean default_fatal) {
+    CFS_Diff_Configure(Diff_EnvFlag("CFS_DIFF_FATAL", default_fatal),
+                       Diff_EnvFlag("CFS_DIFF_LOOSE", FALSE));
+}
+
+static int Diff_CompareWrites(const void *a, const void *b) {
+    const CFS_SimMemWrite_t *wa = (const CFS_SimMemWrite_t *)a;
+    const CFS_SimMemWrite_t *wb = (const CFS_SimMemWrite_t *)b;
+    if (wa->addr != wb->addr) {
+        return (wa->addr < wb->addr) ? -1 : 1;
+    }
+    return (wa->size < wb->size) ? -1 : (wa->size > wb->size);
+}
+
+static void Diff_AddExtent(CFS_DiffObservation_t *obs, uint64_t addr, uint64_t size) {
+    const uint8_t *data = CFS_SimMem_Translate(addr, (uint32_t)size);
+    uint32_t crc = data ? (MM_CalculateCRC32(data, (size_t)size, 0xFFFFFFFF) ^ 0xFFFFFFFF) : 0;
+
+    if (obs->extent_count < CFS_DIFF_MAX_EXTENTS) {
+        CFS_DiffExtent_t *extent = &obs->extents[obs->extent_count];
+        extent->addr = addr;
+        extent->size = (uint32_t)size;
+        extent->crc = crc;
+    }
+    obs->extent_count++;
+    obs->bytes_written += size;
+
+    uint64_t key[2] = { addr, size };
+    obs->mem_crc = MM_CalculateCRC32(key, sizeof(key), obs->mem_crc);
+    obs->mem_crc = MM_CalculateCRC32(&crc, sizeof(crc), obs->mem_crc);
+}
+
+// 저널의 쓰기들을 주소순으로 병합하여 구간별 CRC 계산
+static void Diff_ObserveMemory(CFS_DiffObservation_t *obs) {
+    uint32_t count = CFS_SimMem_JournalCount();
+
+    obs->extent_count = 0;
+    obs->bytes_written = 0;
+    obs->mem_crc = 0xFFFFFFFF;
+
+    if (count == 0) {
+        return;
+    }
+
+    if (count > t_extent_capacity) {
+        CFS_SimMemWrite_t *scratch = realloc(t_extent_scratch, count * sizeof(*scratch));
+        if (!scratch) {
+            return;
+        }
+        t_extent_scratch = scratch;
+        t_extent_capacity = count;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        t_extent_scratch[i] = *CFS_SimMem_JournalEntry(i);
+    }
+    if (count > 1) {
+        qsort(t_extent_scratch, count, sizeof(*t_extent_scratch), Diff_CompareWrites);
+    }
+
+    uint64_t start = t_extent_scratch[0].addr;
+    uint64_t end = start + t_extent_scratch[0].size;
+    for (uint32_t i = 1; i < count; i++) {
+        const CFS_SimMemWrite_t *w = &t_extent_scratch[i];
+        if (w->addr <= end) {
+            if (w->addr + w->size > end) {
+                end = w->addr + w->size;
+            }
+            continue;
+        }
+        Diff_AddExtent(obs, start, end - start);
+        start = w->addr;
+        end = w->addr + w->size;
+    }
+    Diff_AddExtent(obs, start, end - start);
+}
+
+static void Diff_Observe(CFS_DiffObservation_t *obs, int32_t status, boolean with_text) {
+    obs->status = status;
+    obs->event_count = CFS_MockEvents_Count();
+    for (uint32_t i = 0; i < obs->event_count; i++) {
+        const CFS_MockEvent_t *event = CFS_MockEvents_Get(i);
+        obs->events[i].EventID = event->EventID;
+        obs->events[i].EventType = event->EventType;
+        if (with_text) {
+            memcpy(obs->events[i].Text, event->Text, sizeof(event->Text));
+        }
+    }
+    obs->app = MM_AppData;
+    Diff_ObserveMemory(obs);
+}
+
+static boolean Diff_SameEvents(const CFS_DiffObservation_t *a, const CFS_DiffObservation_t *b) {
+    if (a->event_count != b->event_count) {
+        return FALSE;
+    }
+    for (uint32_t i = 0; i < a->event_count; i++) {
+        if (a->events[i].EventID != b->events[i].EventID ||
+            a->events[i].EventType != b->events[i].EventType) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static boolean Diff_SameState(const MM_AppData_t *a, const MM_AppData_t *b) {
+    return a->CmdCounter == b->CmdCounter &&
+           a->ErrCounter == b->ErrCounter &&
+           a->LastAction == b->LastAction &&
+           a->MemType == b->MemType &&
+           a->Address == b->Address &&
+           a->DataValue == b->DataValue &&
+           a->BytesProcessed == b->BytesProcessed &&
+           strncmp(a->FileName, b->FileName, OS_MAX_PATH_LEN) == 0;
+}
+
+static boolean Diff_SameMemory(const CFS_DiffObservation_t *a, const CFS_DiffObservation_t *b) {
+    return a->extent_count == b->extent_count &&
+           a->bytes_written == b->bytes_written &&
+           a->mem_crc == b->mem_crc;
+}
+
+static void Diff_PrintEvents(const char *label, const CFS_DiffObservation_t *obs) {
+    fprintf(stderr, "  %-10s events:", label);
+    if (obs->event_count == 0) {
+        fprintf(stderr, " (none)");
+    }
+    fprintf(stderr, "\n");
+    for (uint32_t i = 0; i < obs->event_count; i++) {
+        fprintf(stderr, "    [%u/%u] %s\n", obs->events[i].EventID,
+                obs->events[i].EventType, obs->events[i].Text);
+    }
+}
+
+static void Diff_PrintMemory(const char *label, const CFS_DiffObservation_t *obs) {
+    fprintf(stderr, "  %-10s memory: %u extent(s), %lu bytes, crc=0x%08X\n", label,
+            obs->extent_count, (unsigned long)obs->bytes_written, obs->mem_crc);
+    uint32_t shown = obs->extent_count < CFS_DIFF_MAX_EXTENTS ? obs->extent_count : CFS_DIFF_MAX_EXTENTS;
+    for (uint32_t i = 0; i < shown; i++) {
+        fprintf(stderr, "    0x%08lX +%u crc=0x%08X\n", (unsigned long)obs->extents[i].addr,
+                obs->extents[i].size, obs->extents[i].crc);
+    }
+}
+
+static void Diff_Report(const char *name, const CFS_DiffObservation_t *ref,
+                        const CFS_DiffObservation_t *sim, const char *what) {
+    fprintf(stderr, "==CFS== DIFFERENTIAL MISMATCH in %s: %s\n", name, what);
+    fprintf(stderr, "  %-16s %14s %14s\n", "", "reference", "simulation");
+    fprintf(stderr, "  %-16s %14d %14d\n", "status", ref->status, sim->status);
+    fprintf(stderr, "  %-16s %14u %14u\n", "CmdCounter", ref->app.CmdCounter, sim->app.CmdCounter);
+    fprintf(stderr, "  %-16s %14u %14u\n", "ErrCounter", ref->app.ErrCounter, sim->app.ErrCounter);
+    fprintf(stderr, "  %-16s %14u %14u\n", "LastAction", ref->app.LastAction, sim->app.LastAction);
+    fprintf(stderr, "  %-16s %14u %14u\n", "MemType", ref->app.MemType, sim->app.MemType);
+    fprintf(stderr, "  %-16s     0x%08X     0x%08X\n", "Address", ref->app.Address, sim->app.Address);
+    fprintf(stderr, "  %-16s %14u %14u\n", "BytesProcessed", ref->app.BytesProcessed,
+            sim->app.BytesProcessed);
+    fprintf(stderr, "  %-16s %.*s | %.*s\n", "FileName", OS_MAX_PATH_LEN, ref->app.FileName,
+            OS_MAX_PATH_LEN, sim->app.FileName);
+    Diff_PrintEvents("reference", ref);
+    Diff_PrintEvents("simulation", sim);
+    Diff_PrintMemory("reference", ref);
+    Diff_PrintMemory("simulation", sim);
+}
+
+// 같은 시작 상태에서 두 구현을 차례로 실행 (시뮬레이션 쓰기는 저널에 남은 상태로 반환)
+static void Diff_Execute(void *cmd, void *arg, CFS_DiffSide_t reference, CFS_DiffSide_t simulation,
+                         const MM_AppData_t *app_before, boolean with_text,
+                         CFS_DiffObservation_t *ref_obs, CFS_DiffObservation_t *sim_obs) {
+    CFS_VClockState_t clock_before;
+    CFS_VClock_Save(&clock_before);
+    CFS_MockEvents_Capture(TRUE, with_text);
+    CFS_SimMem_JournalBegin();
+    // 참조 실행의 EEPROM 쓰기와 타겟 메모리 위반은 시뮬레이션 쪽에서만 센다
+    CFS_Eeprom_SetAccounting(FALSE);
+    CFS_TargetSan_SetAccounting(FALSE);
+    Diff_Observe(ref_obs, reference(cmd, arg), with_text);
+
+    CFS_SimMem_JournalRollback();
+    MM_AppData = *app_before;
+    CFS_VClock_Restore(&clock_before);
+    CFS_MockEvents_Clear();
+    CFS_Eeprom_SetAccounting(!with_text);
+    CFS_TargetSan_SetAccounting(!with_text);
+    Diff_Observe(sim_obs, simulation(cmd, arg), with_text);
+    CFS_Eeprom_SetAccounting(TRUE);
+    CFS_TargetSan_SetAccounting(TRUE);
+    CFS_MockEvents_Capture(FALSE, FALSE);
+}
+
+static const char* Diff_Compare(const CFS_DiffObservation_t *ref, const CFS_DiffObservation_t *sim,
+                                uint64_t **counter) {
+    boolean both_failed = (ref->status != CFE_SUCCESS && sim->status != CFE_SUCCESS);
+    boolean check_outcome = !(g_diff_config.loose_errors && both_failed);
+
+    if (check_outcome && ref->status != sim->status) {
+        *counter = &g_diff_stats.status_mismatches;
+        return "return code";
+    }
+    if (check_outcome && !Diff_SameEvents(ref, sim)) {
+        *counter = &g_diff_stats.event_mismatches;
+        return "events";
+    }
+    if (!Diff_SameState(&ref->app, &sim->app)) {
+        *counter = &g_diff_stats.state_mismatches;
+        return "housekeeping state";
+    }
+    if (!Diff_SameMemory(ref, sim)) {
+        *counter = &g_diff_stats.memory_mismatches;
+        return "memory contents";
+    }
+    return NULL;
+}
+
+int32_t CFS_Diff_Run(const char *name, void *cmd, void *arg,
+                     CFS_DiffSide_t reference, CFS_DiffSide_t simulation,
+                     boolean *diverged) {
+    static CFS_THREAD_LOCAL CFS_DiffObservation_t ref_obs;
+    static CFS_THREAD_LOCAL CFS_DiffObservation_t sim_obs;
+
+    if (diverged) {
+        *diverged = FALSE;
+    }
+    if (!cmd || !reference || !simulation) {
+        return OS_INVALID_POINTER;
+    }
+
+    MM_AppData_t app_before = MM_AppData;
+
+    // 빠른 경로: 이벤트는 ID/타입만 비교
+    Diff_Execute(cmd, arg, reference, simulation, &app_before, FALSE, &ref_obs, &sim_obs);
+    __atomic_fetch_add(&g_diff_stats.runs, 1, __ATOMIC_RELAXED);
+
+    uint64_t *counter = NULL;
+    const char *what = Diff_Compare(&ref_obs, &sim_obs, &counter);
+
+    if (what) {
+        // 보고서용으로 이벤트 메시지까지 캡처하며 다시 실행 (결정적이므로 같은 결과)
+        CFS_SimMem_JournalRollback();
+        MM_AppData = app_before;
+        Diff_Execute(cmd, arg, reference, simulation, &app_before, TRUE, &ref_obs, &sim_obs);
+
+        __atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&g_diff_stats.divergences, 1, __ATOMIC_RELAXED);
+
+        // 여러 재생 스레드의 보고서가 섞이지 않도록 한 번에 출력
+        flockfile(stderr);
+        Diff_Report(name ? name : "command", &ref_obs, &sim_obs, what);
+        funlockfile(stderr);
+        if (g_diff_config.fatal) {
+            fprintf(stderr, "==CFS== ABORTING on differential mismatch\n");
+            abort();
+        }
+        if (diverged) {
+            *diverged = TRUE;
+        }
+    }
+
+    CFS_SimMem_JournalCommit();
+    return sim_obs.status;
+}
+
+const CFS_DiffStats_t* CFS_Diff_GetStats(void) {
+    return &g_diff_stats;
+}
+
+void CFS_Diff_PrintStats(void) {
+    const CFS_DiffStats_t *stats = CFS_Diff_GetStats();
+
+    printf("\n=== Differential Statistics ===\n");
+    printf("Runs: %lu\n", stats->runs);
+    printf("Divergences: %lu\n", stats->divergences);
+    printf("  return code: %lu\n", stats->status_mismatches);
+    printf("  events: %lu\n", stats->event_mismatches);
+    printf("  HK state: %lu\n", stats->state_mismatches);
+    printf("  memory: %lu\n", stats->memory_mismatches);
+    printf("===============================\n");
+}
+
+void CFS_Diff_Release(void) {
+    free(t_extent_scratch);
+    t_extent_scratch = NULL;
+    t_extent_capacity = 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * CFS 차분(differential) 실행 헤더
+ * 같은 디코딩 결과와 같은 메모리 스냅샷 위에서 참조 구현과 시뮬레이션을
+ * 차례로 실행하고 반환 코드, 이벤트, HK 상태, 메모리 쓰기를 비교한다.
+ */
+
+#ifndef CFS_DIFFERENTIAL_H
+#define CFS_DIFFERENTIAL_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+#include "mm_types.h"
+
+// 보고서에 개별 출력할 메모리 쓰기 구간 수 (비교는 전체 구간 대상)
+#define CFS_DIFF_MAX_EXTENTS    8
+
+// 한 쪽 실행이 만든 메모리 쓰기 구간 (인접/중복 쓰기는 병합)
+typedef struct {
+    uint64_t addr;
+    uint32_t size;
+    uint32_t crc;               // 실행 직후 구간 내용의 CRC32
+} CFS_DiffExtent_t;
+
+// 한 쪽 실행의 관찰 결과
+typedef struct {
+    int32_t          status;
+    uint32_t         event_count;
+    CFS_MockEvent_t  events[CFS_MOCK_MAX_EVENTS];
+    MM_AppData_t     app;
+    uint32_t         extent_count;
+    uint64_t         bytes_written;
+    uint32_t         mem_crc;   // 전체 구간 (주소, 크기, 내용) 누적 CRC
+    CFS_DiffExtent_t extents[CFS_DIFF_MAX_EXTENTS];
+} CFS_DiffObservation_t;
+
+// 비교 대상 구현 (명령을 수정하지 않아야 한다)
+typedef int32_t (*CFS_DiffSide_t)(void *cmd, void *arg);
+
+// 차분 통계
+typedef struct {
+    uint64_t runs;
+    uint64_t divergences;
+    uint64_t status_mismatches;
+    uint64_t event_mismatches;
+    uint64_t state_mismatches;
+    uint64_t memory_mismatches;
+} CFS_DiffStats_t;
+
+/*
+ * 동작 설정
+ *   fatal        - 불일치 시 abort() (퍼저가 입력을 크래시로 저장)
+ *   loose_errors - 양쪽 모두 실패한 경우 상태 코드/이벤트 차이는 무시하고
+ *                  HK/메모리만 비교 (검증 순서 차이로 인한 소음 억제)
+ */
+void CFS_Diff_Configure(boolean fatal, boolean loose_errors);
+
+// 환경 변수로 설정 (CFS_DIFF_FATAL=0|1, CFS_DIFF_LOOSE=0|1, loose 기본값은 0)
+void CFS_Diff_ConfigureFromEnv(boolean default_fatal);
+
+/*
+ * 참조 구현 → 되돌림 → 시뮬레이션 순서로 실행하고 결과 비교
+ * 시뮬레이션의 상태 변화(메모리, HK)만 유지된다.
+ *
+ * @return: 시뮬레이션 상태 코드 (diverged 에 불일치 여부)
+ */
+int32_t CFS_Diff_Run(const char *name, void *cmd, void *arg,
+                     CFS_DiffSide_t reference, CFS_DiffSide_t simulation,
+                     boolean *diverged);
+
+const CFS_DiffStats_t* CFS_Diff_GetStats(void);
+void CFS_Diff_PrintStats(void);
+
+// 현재 스레드의 쓰기 구간 정렬 버퍼 해제 (워커 종료 시)
+void CFS_Diff_Release(void);
+
+#endif // CFS_DIFFERENTIAL_H
@@ -0,0 +1,174 @@
+/*
+ * CFS 메모리 덤프 파일 생성
+ *
+ * 파일 = [CFE_FS_Header_t][MM_LoadDumpFileHeader_t][영역 바이트]
+ * 영역 바이트는 시뮬레이션 메모리에서 바로 읽는다. 보조 헤더의 CRC 는
+ * 데이터를 내보내며 구간마다 누적하므로, 헤더 자리는 먼저 쓰고 마지막에 채운다.
+ *   VFS    - 생성한 VFS 블록에 구간마다 CRC 누적 + 복사, 끝에 보조 헤더 기록
+ *   호스트 - 첫 구간은 헤더와 함께 writev, 이후 구간은 write, 끝에 pwrite 로 보조 헤더 갱신
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "dump.h"
+#include "sim_mem.h"
+#include "target_san.h"
+#include "vfs.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// 호스트 바이트 순서 값을 메모리에 빅엔디언으로 놓이도록 변환
+static uint32_t Dump_BigEndian32(uint32_t value) {
+    const uint8_t bytes[4] = {
+        (uint8_t)(value >> 24), (uint8_t)(value >> 16), (uint8_t)(value >> 8), (uint8_t)value
+    };
+    uint32_t encoded;
+    memcpy(&encoded, bytes, sizeof(encoded));
+    return encoded;
+}
+
+int32_t CFS_Dump_Prepare(CFS_DumpFile_t *dump, const MM_SymAddr_t *sym, uint64_t addr,
+                         uint8_t mem_type, uint32_t size) {
+    if (!dump || !sym) {
+        return OS_INVALID_POINTER;
+    }
+
+    (void)CFS_TargetSan_Check(addr, size, FALSE);
+    uint8_t *src = CFS_SimMem_Translate(addr, size);
+    if (!src) {
+        return CFS_MM_ERROR_INVALID_ADDR;
+    }
+
+    memset(dump, 0, sizeof(*dump));
+
+    CFE_FS_Header_t *fs = &dump->FsHeader;
+    fs->ContentType = Dump_BigEndian32(CFE_FS_FILE_CONTENT_ID);
+    fs->SubType = Dump_BigEndian32(MM_CFE_HDR_SUBTYPE);
+    fs->Length = Dump_BigEndian32((uint32_t)sizeof(CFE_FS_Header_t));
+    fs->SpacecraftID = Dump_BigEndian32(CFS_MOCK_SPACECRAFT_ID);
+    fs->ProcessorID = Dump_BigEndian32(CFS_MOCK_PROCESSOR_ID);
+    CFE_TIME_SysTime_t now = CFE_TIME_GetTime();
+    fs->TimeSeconds = Dump_BigEndian32(now.Seconds);
+    fs->TimeSubSeconds = Dump_BigEndian32(now.Subseconds);
+    strncpy(fs->Description, MM_CFE_HDR_DESCRIPTION, CFE_FS_HDR_DESC_MAX_LEN - 1);
+
+    dump->MmHeader.MemType = mem_type;
+    dump->MmHeader.NumOfBytes = size;
+    dump->MmHeader.SymAddress = *sym;
+
+    dump->iov[CFS_DUMP_IOV_FS_HEADER].iov_base = &dump->FsHeader;
+    dump->iov[CFS_DUMP_IOV_FS_HEADER].iov_len = sizeof(dump->FsHeader);
+    dump->iov[CFS_DUMP_IOV_MM_HEADER].iov_base = &dump->MmHeader;
+    dump->iov[CFS_DUMP_IOV_MM_HEADER].iov_len = sizeof(dump->MmHeader);
+    dump->iov[CFS_DUMP_IOV_DATA].iov_base = src;
+    dump->iov[CFS_DUMP_IOV_DATA].iov_len = size;
+    dump->FileSize = (uint32_t)(sizeof(dump->FsHeader) + sizeof(dump->MmHeader)) + size;
+    return CFE_SUCCESS;
+}
+
+int32_t CFS_Dump_WriteVfs(CFS_DumpFile_t *dump, const char *path) {
+    if (!dump || !path) {
+        return OS_INVALID_POINTER;
+    }
+
+    uint8_t *out = NULL;
+    int32_t status = CFS_Vfs_CreateFile(path, dump->FileSize, &out);
+    if (status != CFE_SUCCESS) {
+        return status;
+    }
+
+    const struct iovec *fs = &dump->iov[CFS_DUMP_IOV_FS_HEADER];
+    const struct iovec *mm = &dump->iov[CFS_DUMP_IOV_MM_HEADER];
+    const struct iovec *data = &dump->iov[CFS_DUMP_IOV_DATA];
+    const uint8_t *src = (const uint8_t *)data->iov_base;
+    uint8_t *dst = out + fs->iov_len + mm->iov_len;
+    uint32_t crc = 0xFFFFFFFF;
+
+    memcpy(out, fs->iov_base, fs->iov_len);
+    for (size_t done = 0; done < data->iov_len; done += CFS_DUMP_EMIT_CHUNK) {
+        size_t length = data->iov_len - done;
+        if (length > CFS_DUMP_EMIT_CHUNK) {
+            length = CFS_DUMP_EMIT_CHUNK;
+        }
+        crc = MM_CalculateCRC32(src + done, length, crc);
+        memcpy(dst + done, src + done, length);
+    }
+
+    dump->MmHeader.Crc = crc ^ 0xFFFFFFFF;
+    memcpy(out + fs->iov_len, mm->iov_base, mm->iov_len);
+    return CFE_SUCCESS;
+}
+
+// iovec 목록을 끝까지 쓰기 (부분 쓰기/EINTR 재시도, iov 는 진행에 따라 수정됨)
+static int32_t Dump_WritevAll(int fd, struct iovec *iov, int count) {
+    while (count > 0) {
+        ssize_t written = writev(fd, iov, count);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return CFS_MM_ERROR_FILE_ACCESS;
+        }
+        while (count > 0 && (size_t)written >= iov->iov_len) {
+            written -= (ssize_t)iov->iov_len;
+            iov++;
+            count--;
+        }
+        if (count > 0) {
+            iov->iov_base = (uint8_t *)iov->iov_base + written;
+            iov->iov_len -= (size_t)written;
+        }
+    }
+    return CFE_SUCCESS;
+}
+
+int32_t CFS_Dump_WriteHost(CFS_DumpFile_t *dump, const char *host_path) {
+    if (!dump || !host_path) {
+        return OS_INVALID_POINTER;
+    }
+
+    int fd = open(host_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    const uint8_t *src = (const uint8_t *)dump->iov[CFS_DUMP_IOV_DATA].iov_base;
+    size_t size = dump->iov[CFS_DUMP_IOV_DATA].iov_len;
+    uint32_t crc = 0xFFFFFFFF;
+    int32_t status = CFE_SUCCESS;
+
+    // 첫 구간은 헤더 두 개와 함께 (보조 헤더의 CRC 는 아직 0)
+    size_t first = (size < CFS_DUMP_EMIT_CHUNK) ? size : CFS_DUMP_EMIT_CHUNK;
+    struct iovec batch[CFS_DUMP_IOV_COUNT];
+    memcpy(batch, dump->iov, sizeof(batch));
+    batch[CFS_DUMP_IOV_DATA].iov_len = first;
+    crc = MM_CalculateCRC32(src, first, crc);
+    status = Dump_WritevAll(fd, batch, CFS_DUMP_IOV_COUNT);
+
+    for (size_t done = first; status == CFE_SUCCESS && done < size; done += CFS_DUMP_EMIT_CHUNK) {
+        size_t length = size - done;
+        if (length > CFS_DUMP_EMIT_CHUNK) {
+            length = CFS_DUMP_EMIT_CHUNK;
+        }
+        struct iovec chunk = { (void *)(src + done), length };
+        crc = MM_CalculateCRC32(src + done, length, crc);
+        status = Dump_WritevAll(fd, &chunk, 1);
+    }
+
+    // 보조 헤더에 최종 CRC 기록
+    if (status == CFE_SUCCESS) {
+        dump->MmHeader.Crc = crc ^ 0xFFFFFFFF;
+        ssize_t written = pwrite(fd, &dump->MmHeader, sizeof(dump->MmHeader),
+                                 (off_t)sizeof(dump->FsHeader));
+        if (written != (ssize_t)sizeof(dump->MmHeader)) {
+            status = CFS_MM_ERROR_FILE_ACCESS;
+        }
+    }
+
+    if (close(fd) != 0 && status == CFE_SUCCESS) {
+        status = CFS_MM_ERROR_FILE_ACCESS;
+    }
+    return status;
+}
@@ -0,0 +1,51 @@
+/*
+ * CFS 메모리 덤프 파일 생성 헤더
+ * MM_DumpMemToFileCmd 시뮬레이션용: cFE 파일 헤더 + MM 보조 헤더 + 영역 바이트
+ * 파일 내용은 시뮬레이션 메모리를 직접 가리키는 iovec 으로 표현하며 (중간 버퍼 없음),
+ * 데이터 CRC 는 내보내는 동안 구간마다 누적해 보조 헤더에 기록한다.
+ */
+
+#ifndef CFS_DUMP_H
+#define CFS_DUMP_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+#include "mm_types.h"
+
+#include <sys/uio.h>
+
+// CRC 누적과 내보내기 단위 (구간이 캐시에 있는 동안 CRC 와 쓰기를 함께 수행)
+#ifndef CFS_DUMP_EMIT_CHUNK
+#define CFS_DUMP_EMIT_CHUNK         (16 * 1024)
+#endif
+
+// iovec 구성: cFE 파일 헤더, MM 보조 헤더, 영역 바이트
+enum {
+    CFS_DUMP_IOV_FS_HEADER = 0,
+    CFS_DUMP_IOV_MM_HEADER,
+    CFS_DUMP_IOV_DATA,
+    CFS_DUMP_IOV_COUNT
+};
+
+/*
+ * 덤프 파일 (iov 가 구조체 안의 헤더를 가리키므로 준비 후 복사하지 말 것)
+ * FsHeader 는 빅엔디언으로 인코딩된 상태, MmHeader.Crc 는 쓰기 후 채워진다.
+ */
+typedef struct {
+    CFE_FS_Header_t         FsHeader;
+    MM_LoadDumpFileHeader_t MmHeader;
+    struct iovec            iov[CFS_DUMP_IOV_COUNT];
+    uint32_t                FileSize;
+} CFS_DumpFile_t;
+
+// 헤더를 만들고 addr 부터 size 바이트의 시뮬레이션 메모리를 iovec 으로 참조
+int32_t CFS_Dump_Prepare(CFS_DumpFile_t *dump, const MM_SymAddr_t *sym, uint64_t addr,
+                         uint8_t mem_type, uint32_t size);
+
+// VFS 파일로 내보내기 (VFS 블록으로 바로 모아 씀)
+int32_t CFS_Dump_WriteVfs(CFS_DumpFile_t *dump, const char *path);
+
+// 호스트 파일로 내보내기 (writev, 통합 실행에서 tmpfs 대상으로 사용)
+int32_t CFS_Dump_WriteHost(CFS_DumpFile_t *dump, const char *host_path);
+
+#endif // CFS_DUMP_H
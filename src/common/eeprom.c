@@ -0,0 +1,320 @@
+/*
+ * CFS EEPROM 장치 모델
+ *
+ * 스레드마다 EEPROM 영역별 페이지 카운터를 첫 프로그램 때 만든다.
+ *   lifetime - 페이지별 누적 프로그램 횟수 (스레드 수명 동안)
+ *   count    - 페이지별 이번 입력의 프로그램 횟수, epoch 가 현재 입력 번호와
+ *              다르면 0 으로 본다 (입력마다 배열을 지우지 않음)
+ * 프로그램 시간은 가상 시계 (vclock.h) 에만 더하므로 지연 모델이 처리량을 깎지 않는다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "eeprom.h"
+#include "mission.h"
+#include "utils.h"
+#include "vclock.h"
+
+typedef struct {
+    uint32_t *lifetime;
+    uint32_t *epoch;
+    uint16_t *count;
+    uint32_t  pages;
+} EepromBank_t;
+
+typedef struct {
+    EepromBank_t      banks[CFS_MISSION_MAX_REGIONS];   // 영역 번호로 색인
+    uint64_t          write_disabled;                   // 영역 번호 비트
+    uint32_t          input;
+    uint32_t          max_lifetime;
+    boolean           accounting_off;
+    CFS_EepromInput_t current;
+} Eeprom_t;
+
+typedef struct {
+    uint32_t page_shift;
+    uint64_t program_ns;
+    uint32_t wear_limit;
+    boolean  fatal;
+} EepromConfig_t;
+
+static EepromConfig_t g_eeprom_config = {
+    8, CFS_EEPROM_DEFAULT_PROGRAM_US * 1000ULL, CFS_EEPROM_DEFAULT_WEAR_LIMIT, FALSE
+};
+static CFS_EepromStats_t g_eeprom_stats;
+static CFS_THREAD_LOCAL Eeprom_t t_eeprom = { .current = { .worst_region = -1 } };
+
+void CFS_Eeprom_Configure(uint32_t page_size, uint32_t program_us, uint32_t wear_limit, boolean fatal) {
+    if (page_size == 0 || (page_size & (page_size - 1)) != 0) {
+        page_size = CFS_EEPROM_DEFAULT_PAGE_SIZE;
+    }
+    g_eeprom_config.page_shift = (uint32_t)__builtin_ctz(page_size);
+    g_eeprom_config.program_ns = (uint64_t)program_us * 1000ULL;
+    g_eeprom_config.wear_limit = wear_limit;
+    g_eeprom_config.fatal = fatal;
+}
+
+static uint32_t Eeprom_EnvNumber(const char *name, uint32_t default_value) {
+    const char *value = getenv(name);
+    if (!value || value[0] == '\0') {
+        return default_value;
+    }
+    return (uint32_t)strtoul(value, NULL, 0);
+}
+
+void CFS_Eeprom_ConfigureFromEnv(boolean default_fatal) {
+    const char *fatal = getenv("CFS_EEPROM_FATAL");
+    uint32_t page_size = Eeprom_EnvNumber("CFS_EEPROM_PAGE", CFS_EEPROM_DEFAULT_PAGE_SIZE);
+
+    if (page_size == 0 || (page_size & (page_size - 1)) != 0) {
+        fprintf(stderr, "CFS_EEPROM_PAGE must be a power of two, using %u\n",
+                CFS_EEPROM_DEFAULT_PAGE_SIZE);
+    }
+    CFS_Eeprom_Configure(page_size,
+                         Eeprom_EnvNumber("CFS_EEPROM_PROGRAM_US", CFS_EEPROM_DEFAULT_PROGRAM_US),
+                         Eeprom_EnvNumber("CFS_EEPROM_WEAR_LIMIT", CFS_EEPROM_DEFAULT_WEAR_LIMIT),
+                         (fatal && fatal[0] != '\0') ? (fatal[0] != '0') : default_fatal);
+}
+
+// 뱅크 번호 → 영역 번호 (없으면 -1)
+static int Eeprom_BankRegion(uint32_t bank) {
+    const CFS_Mission_t *mission = CFS_Mission_Get();
+
+    for (uint32_t i = 0; i < mission->region_count; i++) {
+        if (mission->regions[i].mem_type == MM_EEPROM && bank-- == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+uint32_t CFS_Eeprom_BankCount(void) {
+    const CFS_Mission_t *mission = CFS_Mission_Get();
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < mission->region_count; i++) {
+        count += (mission->regions[i].mem_type == MM_EEPROM);
+    }
+    return count;
+}
+
+int32_t CFS_Eeprom_SetWriteEnable(uint32_t bank, boolean enable) {
+    int region = Eeprom_BankRegion(bank);
+    if (region < 0) {
+        return CFS_MM_ERROR_INVALID_ADDR;
+    }
+
+    uint64_t bit = 1ULL << region;
+    t_eeprom.write_disabled = enable ? (t_eeprom.write_disabled & ~bit) : (t_eeprom.write_disabled | bit);
+    return CFE_SUCCESS;
+}
+
+void CFS_Eeprom_Reset(boolean write_enabled) {
+    t_eeprom.write_disabled = write_enabled ? 0 : UINT64_MAX;
+}
+
+uint64_t CFS_Eeprom_GetWriteMask(void) {
+    return t_eeprom.write_disabled;
+}
+
+void CFS_Eeprom_SetWriteMask(uint64_t write_disabled) {
+    t_eeprom.write_disabled = write_disabled;
+}
+
+void CFS_Eeprom_SetAccounting(boolean enabled) {
+    t_eeprom.accounting_off = !enabled;
+}
+
+// 영역의 페이지 카운터 (첫 사용 시 할당, 실패하면 NULL 이고 기록만 건너뛴다)
+static EepromBank_t* Eeprom_Bank(size_t region) {
+    EepromBank_t *bank = &t_eeprom.banks[region];
+
+    if (bank->lifetime) {
+        return bank;
+    }
+
+    const CFS_MemoryRegion_t *r = &CFS_Mission_Get()->regions[region];
+    uint64_t size = r->end_addr - r->start_addr + 1;
+    uint32_t pages = (uint32_t)((size + (1ULL << g_eeprom_config.page_shift) - 1) >> g_eeprom_config.page_shift);
+
+    bank->lifetime = calloc(pages, sizeof(uint32_t));
+    bank->epoch = calloc(pages, sizeof(uint32_t));
+    bank->count = calloc(pages, sizeof(uint16_t));
+    if (!bank->lifetime || !bank->epoch || !bank->count) {
+        free(bank->lifetime);
+        free(bank->epoch);
+        free(bank->count);
+        memset(bank, 0, sizeof(*bank));
+        return NULL;
+    }
+    bank->pages = pages;
+    return bank;
+}
+
+static inline void Eeprom_ProgramPage(Eeprom_t *e, EepromBank_t *bank, size_t region, uint32_t page) {
+    if (bank->lifetime[page] != UINT32_MAX && ++bank->lifetime[page] > e->max_lifetime) {
+        e->max_lifetime = bank->lifetime[page];
+    }
+    if (bank->epoch[page] != e->input) {
+        bank->epoch[page] = e->input;
+        bank->count[page] = 0;
+    }
+    if (bank->count[page] != UINT16_MAX) {
+        bank->count[page]++;
+    }
+    if (bank->count[page] > e->current.worst_count) {
+        e->current.worst_count = bank->count[page];
+        e->current.worst_region = (int32_t)region;
+        e->current.worst_page = page;
+    }
+}
+
+int32_t CFS_Eeprom_Program(size_t region, uint64_t offset, uint32_t size, uint32_t chunk) {
+    Eeprom_t *e = &t_eeprom;
+
+    if ((e->write_disabled >> region) & 1) {
+        if (!e->accounting_off) {
+            e->current.rejected_writes++;
+        }
+        return CFS_MM_ERROR_PERMISSION;
+    }
+    if (size == 0 || e->accounting_off) {
+        return CFE_SUCCESS;
+    }
+
+    EepromBank_t *bank = Eeprom_Bank(region);
+    if (!bank) {
+        return CFE_SUCCESS;
+    }
+
+    // 중단 불가 구간마다 걸친 페이지 전체를 한 번씩 프로그램 (구간이 페이지를 나누면 같은 페이지를 다시 씀)
+    uint32_t shift = g_eeprom_config.page_shift;
+    uint64_t pages = 0;
+    if (chunk == 0 || chunk > size) {
+        chunk = size;
+    }
+    for (uint32_t done = 0; done < size; done += chunk) {
+        uint32_t length = (size - done < chunk) ? size - done : chunk;
+        uint32_t first = (uint32_t)((offset + done) >> shift);
+        uint32_t last = (uint32_t)((offset + done + length - 1) >> shift);
+        for (uint32_t page = first; page <= last; page++) {
+            Eeprom_ProgramPage(e, bank, region, page);
+        }
+        pages += (uint64_t)(last - first + 1);
+    }
+
+    e->current.bytes_requested += size;
+    e->current.pages_programmed += pages;
+    e->current.virtual_ns += pages * g_eeprom_config.program_ns;
+    CFS_VClock_Advance(CFS_VCLOCK_EEPROM, pages * g_eeprom_config.program_ns);
+    return CFE_SUCCESS;
+}
+
+void CFS_Eeprom_BeginInput(void) {
+    Eeprom_t *e = &t_eeprom;
+
+    // 입력 번호가 한 바퀴 돌면 남은 epoch 와 겹치지 않도록 모두 지운다
+    if (++e->input == 0) {
+        for (size_t i = 0; i < CFS_MISSION_MAX_REGIONS; i++) {
+            if (e->banks[i].epoch) {
+                memset(e->banks[i].epoch, 0, e->banks[i].pages * sizeof(uint32_t));
+            }
+        }
+        e->input = 1;
+    }
+    memset(&e->current, 0, sizeof(e->current));
+    e->current.worst_region = -1;
+}
+
+static void Eeprom_StoreMax(uint64_t *target, uint64_t value) {
+    uint64_t max = __atomic_load_n(target, __ATOMIC_RELAXED);
+    while (value > max &&
+           !__atomic_compare_exchange_n(target, &max, value, TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+static void Eeprom_Report(const CFS_EepromInput_t *in) {
+    const CFS_MemoryRegion_t *region = &CFS_Mission_Get()->regions[in->worst_region];
+    uint64_t page_size = 1ULL << g_eeprom_config.page_shift;
+    uint64_t page_addr = region->start_addr + (uint64_t)in->worst_page * page_size;
+
+    flockfile(stderr);
+    fprintf(stderr, "==CFS== EEPROM wear: page 0x%08lX (%s) programmed %u times in one input (limit %u)\n",
+            (unsigned long)page_addr, region->name, in->worst_count, g_eeprom_config.wear_limit);
+    fprintf(stderr, "==CFS==   %lu bytes requested, %lu pages programmed (%.2fx), %.3f ms virtual\n",
+            (unsigned long)in->bytes_requested, (unsigned long)in->pages_programmed,
+            in->bytes_requested ? (double)(in->pages_programmed * page_size) / (double)in->bytes_requested : 0.0,
+            (double)in->virtual_ns / 1e6);
+    funlockfile(stderr);
+}
+
+boolean CFS_Eeprom_EndInput(void) {
+    const CFS_EepromInput_t *in = &t_eeprom.current;
+    CFS_EepromStats_t *stats = &g_eeprom_stats;
+
+    __atomic_fetch_add(&stats->inputs, 1, __ATOMIC_RELAXED);
+    if (in->pages_programmed == 0 && in->rejected_writes == 0) {
+        return FALSE;
+    }
+    __atomic_fetch_add(&stats->bytes_requested, in->bytes_requested, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->pages_programmed, in->pages_programmed, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->virtual_ns, in->virtual_ns, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&stats->rejected_writes, in->rejected_writes, __ATOMIC_RELAXED);
+
+    Eeprom_StoreMax(&stats->max_page_programs, in->worst_count);
+    Eeprom_StoreMax(&stats->max_lifetime_programs, t_eeprom.max_lifetime);
+
+    if (g_eeprom_config.wear_limit == 0 || in->worst_count <= g_eeprom_config.wear_limit) {
+        return FALSE;
+    }
+    __atomic_fetch_add(&stats->wear_findings, 1, __ATOMIC_RELAXED);
+    Eeprom_Report(in);
+    if (g_eeprom_config.fatal) {
+        fprintf(stderr, "==CFS== ABORTING on EEPROM wear finding\n");
+        abort();
+    }
+    return TRUE;
+}
+
+const CFS_EepromInput_t* CFS_Eeprom_GetInput(void) {
+    return &t_eeprom.current;
+}
+
+const CFS_EepromStats_t* CFS_Eeprom_GetStats(void) {
+    return &g_eeprom_stats;
+}
+
+void CFS_Eeprom_PrintStats(void) {
+    const CFS_EepromStats_t *stats = CFS_Eeprom_GetStats();
+    uint64_t page_size = 1ULL << g_eeprom_config.page_shift;
+
+    if (stats->pages_programmed == 0 && stats->rejected_writes == 0) {
+        return;
+    }
+
+    printf("\n=== EEPROM Statistics ===\n");
+    printf("Page size: %lu bytes, program time: %lu us (virtual)\n",
+           (unsigned long)page_size, (unsigned long)(g_eeprom_config.program_ns / 1000));
+    printf("Bytes requested: %lu\n", stats->bytes_requested);
+    printf("Pages programmed: %lu (write amplification %.2fx)\n", stats->pages_programmed,
+           stats->bytes_requested ? (double)(stats->pages_programmed * page_size) / (double)stats->bytes_requested : 0.0);
+    printf("Virtual program time: %.3f s\n", (double)stats->virtual_ns / 1e9);
+    printf("Rejected writes (bank disabled): %lu\n", stats->rejected_writes);
+    printf("Max programs of one page per input: %lu (limit %u)\n", stats->max_page_programs,
+           g_eeprom_config.wear_limit);
+    printf("Max lifetime programs of one page: %lu\n", stats->max_lifetime_programs);
+    printf("Wear findings: %lu\n", stats->wear_findings);
+    printf("=========================\n");
+}
+
+void CFS_Eeprom_Release(void) {
+    Eeprom_t *e = &t_eeprom;
+
+    for (size_t i = 0; i < CFS_MISSION_MAX_REGIONS; i++) {
+        free(e->banks[i].lifetime);
+        free(e->banks[i].epoch);
+        free(e->banks[i].count);
+        memset(&e->banks[i], 0, sizeof(e->banks[i]));
+    }
+    e->max_lifetime = 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * CFS EEPROM 장치 모델 헤더
+ * 현재 미션의 EEPROM 영역 (mem_type == MM_EEPROM) 하나가 뱅크 하나이며,
+ * 뱅크 번호는 미션 영역 표 (시작 주소 순) 에서 EEPROM 영역의 순번이다.
+ * 기본 미션: 0 = EEPROM_CONFIG, 1 = EEPROM_DATA.
+ *
+ * 시뮬레이션 메모리 (sim_mem.c) 가 EEPROM 영역에 쓰기 전에 CFS_Eeprom_Program 을 부른다.
+ *   - 뱅크 쓰기 허용이 꺼져 있으면 쓰기를 거부한다 (CFS_MM_ERROR_PERMISSION, 내용 불변).
+ *   - 쓰기는 호출자의 중단 불가 구간 (chunk) 마다 걸친 페이지를 통째로 프로그램한다.
+ *     페이지마다 누적 / 입력별 프로그램 횟수를 세고, 페이지당 프로그램 시간을
+ *     가상 시계 (vclock.h) 에만 더한다 (실제로 기다리지 않음).
+ *   - 입력 하나가 같은 페이지를 wear_limit 번 넘게 프로그램하면 마모 발견 사항이다.
+ *
+ * 환경 변수
+ *   CFS_EEPROM_PAGE=N         페이지 크기 (바이트, 2 의 거듭제곱, 기본 256)
+ *   CFS_EEPROM_PROGRAM_US=N   페이지 프로그램 시간 (가상 마이크로초, 기본 5000)
+ *   CFS_EEPROM_WEAR_LIMIT=N   입력당 같은 페이지 프로그램 횟수 한도 (기본 16, 0 = 검사 안 함)
+ *   CFS_EEPROM_FATAL=0|1      마모 발견 시 abort (퍼저가 입력을 크래시로 저장)
+ */
+
+#ifndef CFS_EEPROM_H
+#define CFS_EEPROM_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+#define CFS_EEPROM_DEFAULT_PAGE_SIZE    256
+#define CFS_EEPROM_DEFAULT_PROGRAM_US   5000
+#define CFS_EEPROM_DEFAULT_WEAR_LIMIT   16
+
+// 입력 하나의 EEPROM 활동 (BeginInput 이후)
+typedef struct {
+    uint64_t bytes_requested;       // 호출자가 쓴 바이트
+    uint64_t pages_programmed;      // 실제로 프로그램한 페이지 수
+    uint64_t virtual_ns;            // 프로그램 시간 합 (가상)
+    uint32_t rejected_writes;       // 쓰기 허용이 꺼져 거부된 쓰기
+    uint32_t worst_count;           // 가장 많이 프로그램한 페이지의 횟수
+    int32_t  worst_region;          // 그 페이지의 영역 번호 (-1 = 없음)
+    uint32_t worst_page;
+} CFS_EepromInput_t;
+
+// 전체 통계 (모든 스레드 합)
+typedef struct {
+    uint64_t inputs;
+    uint64_t bytes_requested;
+    uint64_t pages_programmed;
+    uint64_t virtual_ns;
+    uint64_t rejected_writes;
+    uint64_t wear_findings;
+    uint64_t max_page_programs;     // 입력 하나에서 한 페이지를 프로그램한 최대 횟수
+    uint64_t max_lifetime_programs; // 스레드 하나에서 한 페이지의 누적 프로그램 최대 횟수
+} CFS_EepromStats_t;
+
+/*
+ * 동작 설정 (워커 스레드 시작 전에만)
+ *   page_size   - 2 의 거듭제곱, 0 이면 기본값
+ *   wear_limit  - 0 이면 마모 검사 안 함
+ */
+void CFS_Eeprom_Configure(uint32_t page_size, uint32_t program_us, uint32_t wear_limit, boolean fatal);
+void CFS_Eeprom_ConfigureFromEnv(boolean default_fatal);
+
+// 현재 미션의 뱅크 수
+uint32_t CFS_Eeprom_BankCount(void);
+
+/*
+ * 뱅크 쓰기 허용 (CFE_PSP_EepromWriteEnable / Disable 에 해당)
+ * 반환값: CFE_SUCCESS, CFS_MM_ERROR_INVALID_ADDR (없는 뱅크)
+ */
+int32_t CFS_Eeprom_SetWriteEnable(uint32_t bank, boolean enable);
+
+// 현재 스레드의 모든 뱅크 쓰기 허용 상태 설정 (처음 상태는 모두 허용)
+void CFS_Eeprom_Reset(boolean write_enabled);
+
+// 스냅샷용 쓰기 금지 마스크 (영역 번호 비트)
+uint64_t CFS_Eeprom_GetWriteMask(void);
+void CFS_Eeprom_SetWriteMask(uint64_t write_disabled);
+
+/*
+ * EEPROM 영역 쓰기 (sim_mem.c 전용)
+ * region 영역의 offset 부터 size 바이트를 chunk 단위 (0 = 한 번에) 로 프로그램한다고 기록한다.
+ * 반환값: CFE_SUCCESS, CFS_MM_ERROR_PERMISSION (뱅크 쓰기 금지)
+ */
+int32_t CFS_Eeprom_Program(size_t region, uint64_t offset, uint32_t size, uint32_t chunk);
+
+// 마모/지연/거부 기록 여부 (차분 실행의 참조 쪽처럼 되돌릴 쓰기는 세지 않는다, 허용 검사는 유지)
+void CFS_Eeprom_SetAccounting(boolean enabled);
+
+// 입력 경계: Begin 은 입력별 기록을 비우고, End 는 마모 발견 여부를 반환 (fatal 이면 abort)
+void CFS_Eeprom_BeginInput(void);
+boolean CFS_Eeprom_EndInput(void);
+
+const CFS_EepromInput_t* CFS_Eeprom_GetInput(void);
+const CFS_EepromStats_t* CFS_Eeprom_GetStats(void);
+void CFS_Eeprom_PrintStats(void);
+
+// 현재 스레드의 페이지 카운터 반환
+void CFS_Eeprom_Release(void);
+
+#endif // CFS_EEPROM_H
@@ -0,0 +1,110 @@
+/*
+ * CFS 메모리 채우기 엔진
+ *
+ * 바이트 루프 대신 memset 과 같은 방식으로 채운다.
+ *   1. 시작 위치에 위상을 맞춘 패턴으로 정렬되지 않은 16 바이트 저장 (머리)
+ *   2. 다음 16 바이트 경계부터 정렬된 저장 (SSE2, 64 바이트씩 펼침)
+ *   3. 끝에서 16 바이트 앞 위치에 정렬되지 않은 저장 (꼬리)
+ * 머리/꼬리 저장은 본문과 겹치지만 같은 값을 쓰므로 결과는 같다.
+ * 16 바이트 미만은 8 바이트 겹침 저장 또는 바이트 단위로 처리하며,
+ * SSE2 가 없는 타겟은 8 바이트 저장으로 같은 과정을 거친다.
+ */
+
+#include "fill.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define FILL_VECTOR_SIZE    16
+#else
+#define FILL_VECTOR_SIZE    8
+#endif
+
+// 위상 phase 에서 시작하는 패턴 (메모리에 놓았을 때 첫 바이트가 패턴 바이트[phase % 4])
+static inline uint32_t Fill_Rotate(const uint8_t doubled[8], uint32_t phase) {
+    uint32_t word;
+    memcpy(&word, doubled + (phase & 3), sizeof(word));
+    return word;
+}
+
+#if defined(__SSE2__)
+static inline void Fill_StoreUnaligned(uint8_t *dst, uint32_t word) {
+    _mm_storeu_si128((__m128i *)(void *)dst, _mm_set1_epi32((int)word));
+}
+#else
+static inline void Fill_StoreUnaligned(uint8_t *dst, uint32_t word) {
+    const uint64_t v = ((uint64_t)word << 32) | word;
+    memcpy(dst, &v, sizeof(v));
+}
+#endif
+
+static inline void Fill_Store8(uint8_t *dst, uint32_t word) {
+    memcpy(dst, &word, sizeof(word));
+    memcpy(dst + 4, &word, sizeof(word));
+}
+
+uint32_t CFS_Fill_ExpandPattern(uint32_t pattern, uint8_t mem_type) {
+    switch (mem_type) {
+        case MM_MEM8:
+            return (pattern & 0xFFu) * 0x01010101u;
+        case MM_MEM16: {
+            uint16_t half = (uint16_t)pattern;
+            uint8_t bytes[4];
+            memcpy(bytes, &half, sizeof(half));
+            memcpy(bytes + 2, &half, sizeof(half));
+            memcpy(&pattern, bytes, sizeof(pattern));
+            return pattern;
+        }
+        default:
+            return pattern;
+    }
+}
+
+void CFS_Fill_Pattern32(uint8_t *dst, size_t size, uint32_t pattern, uint32_t phase) {
+    uint8_t doubled[8];
+    memcpy(doubled, &pattern, sizeof(pattern));
+    memcpy(doubled + 4, &pattern, sizeof(pattern));
+
+    if (size < FILL_VECTOR_SIZE) {
+        if (size >= 8) {
+            Fill_Store8(dst, Fill_Rotate(doubled, phase));
+            Fill_Store8(dst + size - 8, Fill_Rotate(doubled, phase + (uint32_t)(size - 8)));
+            return;
+        }
+        for (size_t i = 0; i < size; i++) {
+            dst[i] = doubled[(phase + i) & 3];
+        }
+        return;
+    }
+
+    uint8_t *end = dst + size;
+
+    // 머리와 꼬리
+    Fill_StoreUnaligned(dst, Fill_Rotate(doubled, phase));
+    Fill_StoreUnaligned(end - FILL_VECTOR_SIZE,
+                        Fill_Rotate(doubled, phase + (uint32_t)(size - FILL_VECTOR_SIZE)));
+
+    // 본문: 다음 경계부터 정렬 저장
+    size_t head = FILL_VECTOR_SIZE - ((uintptr_t)dst & (FILL_VECTOR_SIZE - 1));
+    uint8_t *p = dst + head;
+    uint32_t word = Fill_Rotate(doubled, phase + (uint32_t)head);
+
+#if defined(__SSE2__)
+    const __m128i v = _mm_set1_epi32((int)word);
+    while (end - p >= 64) {
+        _mm_store_si128((__m128i *)(void *)(p +  0), v);
+        _mm_store_si128((__m128i *)(void *)(p + 16), v);
+        _mm_store_si128((__m128i *)(void *)(p + 32), v);
+        _mm_store_si128((__m128i *)(void *)(p + 48), v);
+        p += 64;
+    }
+    while (end - p >= 16) {
+        _mm_store_si128((__m128i *)(void *)p, v);
+        p += 16;
+    }
+#else
+    while (end - p >= 8) {
+        Fill_Store8(p, word);
+        p += 8;
+    }
+#endif
+}
@@ -0,0 +1,27 @@
+/*
+ * CFS 메모리 채우기 엔진 헤더
+ * MM_FillMemCmd 시뮬레이션용 32비트 패턴 채우기 (SIMD 저장, 정렬되지 않은 머리/꼬리 처리)
+ */
+
+#ifndef CFS_FILL_H
+#define CFS_FILL_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+/*
+ * 메모리 타입별 접근 폭을 적용한 32비트 패턴
+ *   MM_MEM8  - 하위 8비트를 4번 반복
+ *   MM_MEM16 - 하위 16비트를 2번 반복 (호스트 바이트 순서)
+ *   그 외    - 패턴 그대로
+ */
+uint32_t CFS_Fill_ExpandPattern(uint32_t pattern, uint8_t mem_type);
+
+/*
+ * dst 를 패턴으로 채움
+ * dst[i] = 패턴 바이트[(phase + i) % 4] (패턴은 호스트 바이트 순서로 메모리에 놓인 uint32)
+ * phase 는 채우기 시작점으로부터의 오프셋으로, 구간을 나눠 채워도 결과가 이어지게 한다.
+ */
+void CFS_Fill_Pattern32(uint8_t *dst, size_t size, uint32_t pattern, uint32_t phase);
+
+#endif // CFS_FILL_H
@@ -0,0 +1,883 @@
+/*
+ * CFS 프로세스 내 다중 워커 퍼징 루프
+ *
+ * 워커 N 개가 한 프로세스에서 같은 코퍼스 색인을 공유한다.
+ *   - 코퍼스 색인: 시드(파일은 한 번 읽고, 팩은 mmap 그대로) + 새 입력을 뒤에 추가.
+ *     항목 배열은 처음에 최대 크기로 잡아 두므로 워커는 잠금 없이 읽는다.
+ *   - 커버리지: 스레드별 에지 카운트 맵 (trace-pc 콜백) 을 실행마다 구간 비트로 바꿔
+ *     전역 virgin 맵과 비교하고, 새 비트가 있으면 입력을 색인에 추가한다.
+ *     실행 중 건드린 칸 목록만 훑으므로 맵 전체를 매번 지우지 않는다.
+ *   - 통계: 워커별 캐시 라인에 실행 수를 두고 보고 스레드(main)가 합산한다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "fuzz_loop.h"
+#include "corpus_pack.h"
+#include "hexdump.h"
+#include "mock_trace.h"
+#include "rng.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define FUZZ_MAP_SIZE           (1u << 16)
+#define FUZZ_MAX_WORKERS        256
+#define FUZZ_MAX_PACKS          64
+#define FUZZ_MAX_ENTRIES        (1u << 20)  // 시드 + 새 입력 상한
+#define FUZZ_DEFAULT_MAX_LEN    4096
+#define FUZZ_MAX_STACK          5           // 한 입력에 쌓는 변이 수 상한
+#define FUZZ_REPORT_NS          2000000000ULL
+
+// sanitizer 런타임이 링크된 경우에만 존재
+extern void __sanitizer_set_death_callback(void (*callback)(void)) __attribute__((weak));
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t       size;
+    boolean        owned;
+} FuzzEntry_t;
+
+typedef struct {
+    FuzzEntry_t      *entries;
+    uint32_t          count;            // 게시된 항목 수 (release 저장, acquire 읽기)
+    uint32_t          seed_count;
+    uint64_t          bytes;
+    pthread_mutex_t   lock;             // 추가와 저장만 보호
+    CFS_CorpusPack_t  packs[FUZZ_MAX_PACKS];
+    uint32_t          pack_count;
+    const char       *out_dir;          // 새 입력 저장 디렉토리 (NULL = 메모리에만)
+} FuzzCorpus_t;
+
+// 스레드별 커버리지 (trace-pc 콜백이 채운다)
+typedef struct {
+    uint8_t   counts[FUZZ_MAP_SIZE];
+    uint16_t  touched[FUZZ_MAP_SIZE];   // 이번 실행에서 0 -> 1 이 된 칸
+    uint32_t  touched_count;
+    uintptr_t prev;
+} FuzzCoverage_t;
+
+typedef struct {
+    uint64_t execs;
+    uint64_t new_inputs;
+} __attribute__((aligned(64))) FuzzWorkerStats_t;
+
+typedef struct {
+    FuzzCorpus_t        corpus;
+    CFS_ReplayTarget_t  target;
+    uint32_t            workers;
+    uint64_t            max_runs;
+    uint64_t            max_time_ns;
+    uint32_t            max_len;
+    uint64_t            seed;
+    const char         *artifact_prefix;
+
+    volatile int        stop;
+    uint32_t            finished;
+    uint64_t            start_ns;
+
+    // 시드 실행 관문: 만들어진 워커가 모두 도착하면 보고 스레드가 연다
+    pthread_mutex_t     init_lock;
+    pthread_cond_t      init_cond;
+    uint32_t            init_arrived;
+    boolean             init_open;
+
+    uint8_t             virgin[FUZZ_MAP_SIZE];  // 칸별로 본 적 있는 카운트 구간 비트
+    uint64_t            edges;                  // cov: 한 번이라도 실행된 칸
+    uint64_t            features;               // ft: (칸, 구간) 조합
+    FuzzWorkerStats_t   stats[FUZZ_MAX_WORKERS];
+
+    // 크래시 보고용 워커별 실행 중 입력
+    const uint8_t *volatile current_data[FUZZ_MAX_WORKERS];
+    volatile size_t         current_size[FUZZ_MAX_WORKERS];
+} FuzzRun_t;
+
+typedef struct {
+    FuzzRun_t *run;
+    uint32_t   id;
+} FuzzWorker_t;
+
+static FuzzRun_t *volatile g_fuzz_run = NULL;
+static CFS_THREAD_LOCAL int t_fuzz_worker = -1;
+static CFS_THREAD_LOCAL FuzzCoverage_t *t_fuzz_cov = NULL;
+
+/*
+ * 커버리지 콜백 (mtfuzz 변형: -fsanitize-coverage=trace-pc)
+ * 기본 블록마다 호출되며 (이전 pc, 현재 pc) 쌍을 맵 칸으로 해시한다.
+ * 퍼징 워커가 대상 함수를 실행하는 동안에만 기록한다.
+ */
+#ifdef CFS_FUZZ_TRACE_PC
+#if defined(__clang__)
+#define FUZZ_NO_COVERAGE __attribute__((no_sanitize("coverage")))
+#else
+#define FUZZ_NO_COVERAGE __attribute__((no_sanitize_coverage))
+#endif
+
+void __sanitizer_cov_trace_pc(void);
+
+FUZZ_NO_COVERAGE void __sanitizer_cov_trace_pc(void) {
+    FuzzCoverage_t *cov = t_fuzz_cov;
+    if (!cov) {
+        return;
+    }
+
+    uintptr_t pc = (uintptr_t)__builtin_return_address(0);
+    uint32_t idx = ((uint32_t)(pc ^ cov->prev) * 0x9E3779B1u) >> 16;
+    uint8_t count = cov->counts[idx];
+
+    cov->prev = pc >> 1;
+    if (count == 0) {
+        cov->touched[cov->touched_count++] = (uint16_t)idx;
+    }
+    if (count != 0xFF) {
+        cov->counts[idx] = count + 1;
+    }
+}
+
+static const boolean g_fuzz_instrumented = TRUE;
+#else
+static const boolean g_fuzz_instrumented = FALSE;
+#endif
+
+static uint64_t Fuzz_NowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t Fuzz_Hash(const uint8_t *data, size_t size) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+// "<prefix><kind>-<16 hex>" (async-signal-safe, snprintf 없이)
+static void Fuzz_ArtifactName(char *out, size_t out_size, const char *prefix, const char *kind,
+                              uint64_t hash) {
+    static const char hex[] = "0123456789abcdef";
+    size_t n = 0;
+
+    for (const char *p = prefix; p && *p && n + 1 < out_size; p++) {
+        out[n++] = *p;
+    }
+    for (const char *p = kind; *p && n + 1 < out_size; p++) {
+        out[n++] = *p;
+    }
+    if (n + 1 < out_size) {
+        out[n++] = '-';
+    }
+    for (int shift = 60; shift >= 0 && n + 1 < out_size; shift -= 4) {
+        out[n++] = hex[(hash >> shift) & 0xF];
+    }
+    out[n] = '\0';
+}
+
+static boolean Fuzz_WriteFile(const char *path, const uint8_t *data, size_t size) {
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return FALSE;
+    }
+    size_t done = 0;
+    while (done < size) {
+        ssize_t w = write(fd, data + done, size - done);
+        if (w < 0 && errno == EINTR) {
+            continue;
+        }
+        if (w <= 0) {
+            break;
+        }
+        done += (size_t)w;
+    }
+    close(fd);
+    return done == size;
+}
+
+/*
+ * 크래시 보고: 죽는 워커의 입력을 artifact 로 저장 (async-signal-safe 한 호출만)
+ */
+static void Fuzz_WriteStr(const char *s) {
+    ssize_t r = write(STDERR_FILENO, s, strlen(s));
+    (void)r;
+}
+
+static void Fuzz_SaveInFlight(void) {
+    FuzzRun_t *run = g_fuzz_run;
+    int id = t_fuzz_worker;
+    if (!run || id < 0 || !run->current_data[id]) {
+        return;
+    }
+
+    char path[1024];
+    const uint8_t *data = run->current_data[id];
+    size_t size = run->current_size[id];
+    Fuzz_ArtifactName(path, sizeof(path), run->artifact_prefix, "crash", Fuzz_Hash(data, size));
+    if (Fuzz_WriteFile(path, data, size)) {
+        Fuzz_WriteStr("==CFS_FUZZ== crashing input saved: ");
+        Fuzz_WriteStr(path);
+        Fuzz_WriteStr("\n");
+    }
+    const CFS_HexDumpOptions_t opts = { "  ", 0, NULL, CFS_HEXDUMP_ELIDE };
+    (void)CFS_HexDump_Write(STDERR_FILENO, data, size < CFS_HEXDUMP_CRASH_BYTES ? size : CFS_HEXDUMP_CRASH_BYTES, &opts);
+    // 같은 해시 이름으로 Mock 호출 기록도 남긴다 (<prefix>mocktrace-<hash>)
+    CFS_MockTrace_Flush(run->artifact_prefix);
+    run->current_data[id] = NULL;
+}
+
+static void Fuzz_CrashHandler(int signo) {
+    Fuzz_SaveInFlight();
+    signal(signo, SIG_DFL);
+    raise(signo);
+}
+
+static void Fuzz_StopHandler(int signo) {
+    (void)signo;
+    FuzzRun_t *run = g_fuzz_run;
+    if (run) {
+        run->stop = 1;
+    }
+}
+
+static void Fuzz_InstallHandlers(void) {
+    static const int crash_signals[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+
+    for (size_t i = 0; i < sizeof(crash_signals) / sizeof(crash_signals[0]); i++) {
+        signal(crash_signals[i], Fuzz_CrashHandler);
+    }
+    signal(SIGINT, Fuzz_StopHandler);
+    signal(SIGTERM, Fuzz_StopHandler);
+    if (__sanitizer_set_death_callback) {
+        __sanitizer_set_death_callback(Fuzz_SaveInFlight);
+    }
+}
+
+/*
+ * 코퍼스 색인
+ */
+static boolean Fuzz_AddEntry(FuzzCorpus_t *corpus, const uint8_t *data, size_t size, boolean copy) {
+    pthread_mutex_lock(&corpus->lock);
+    uint32_t count = corpus->count;
+    if (count >= FUZZ_MAX_ENTRIES) {
+        pthread_mutex_unlock(&corpus->lock);
+        return FALSE;
+    }
+
+    const uint8_t *stored = data;
+    if (copy) {
+        uint8_t *p = malloc(size ? size : 1);
+        if (!p) {
+            pthread_mutex_unlock(&corpus->lock);
+            return FALSE;
+        }
+        memcpy(p, data, size);
+        stored = p;
+    }
+    corpus->entries[count].data = stored;
+    corpus->entries[count].size = (uint32_t)size;
+    corpus->entries[count].owned = copy;
+    corpus->bytes += size;
+    __atomic_store_n(&corpus->count, count + 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&corpus->lock);
+    return TRUE;
+}
+
+static int32_t Fuzz_LoadPath(FuzzRun_t *run, const char *path);
+
+static int32_t Fuzz_LoadDirectory(FuzzRun_t *run, const char *dir) {
+    DIR *d = opendir(dir);
+    if (!d) {
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    int32_t status = CFE_SUCCESS;
+    struct dirent *entry;
+    while (status == CFE_SUCCESS && (entry = readdir(d)) != NULL) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        size_t len = strlen(dir) + strlen(entry->d_name) + 2;
+        char *child = malloc(len);
+        if (!child) {
+            status = CFS_MM_ERROR_RESOURCE_LIMIT;
+            break;
+        }
+        snprintf(child, len, "%s/%s", dir, entry->d_name);
+        status = Fuzz_LoadPath(run, child);
+        free(child);
+    }
+    closedir(d);
+    return status;
+}
+
+// 시드 파일은 max_len 까지만 읽는다 (libFuzzer 와 같음)
+static int32_t Fuzz_LoadFile(FuzzRun_t *run, const char *path, size_t file_size) {
+    size_t size = file_size < run->max_len ? file_size : run->max_len;
+    uint8_t *data = malloc(size ? size : 1);
+    FILE *f = fopen(path, "rb");
+
+    if (!data || !f || fread(data, 1, size, f) != size) {
+        fprintf(stderr, "Cannot read input: %s\n", path);
+        free(data);
+        if (f) {
+            fclose(f);
+        }
+        return CFE_SUCCESS;
+    }
+    fclose(f);
+
+    FuzzCorpus_t *corpus = &run->corpus;
+    uint32_t count = corpus->count;
+    if (count >= FUZZ_MAX_ENTRIES) {
+        free(data);
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+    corpus->entries[count].data = data;
+    corpus->entries[count].size = (uint32_t)size;
+    corpus->entries[count].owned = TRUE;
+    corpus->bytes += size;
+    corpus->count = count + 1;
+    return CFE_SUCCESS;
+}
+
+static int32_t Fuzz_LoadPath(FuzzRun_t *run, const char *path) {
+    FuzzCorpus_t *corpus = &run->corpus;
+    struct stat st;
+
+    if (stat(path, &st) != 0) {
+        fprintf(stderr, "Cannot access input: %s\n", path);
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+    if (S_ISDIR(st.st_mode)) {
+        return Fuzz_LoadDirectory(run, path);
+    }
+    if (!S_ISREG(st.st_mode)) {
+        return CFE_SUCCESS;
+    }
+    if (!CFS_CorpusPack_IsPackFile(path)) {
+        return Fuzz_LoadFile(run, path, (size_t)st.st_size);
+    }
+
+    // 팩 항목은 mmap 된 데이터를 그대로 색인에 넣는다
+    if (corpus->pack_count >= FUZZ_MAX_PACKS) {
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+    CFS_CorpusPack_t *pack = &corpus->packs[corpus->pack_count];
+    int32_t status = CFS_CorpusPack_Open(pack, path);
+    if (status != CFE_SUCCESS) {
+        fprintf(stderr, "Failed to open corpus pack: %s (status %d)\n", path, status);
+        return status;
+    }
+    corpus->pack_count++;
+    for (uint32_t i = 0; i < CFS_CorpusPack_Count(pack) && corpus->count < FUZZ_MAX_ENTRIES; i++) {
+        const uint8_t *data;
+        size_t size;
+        CFS_CorpusPack_Get(pack, i, &data, &size);
+        corpus->entries[corpus->count].data = data;
+        corpus->entries[corpus->count].size = (uint32_t)(size < run->max_len ? size : run->max_len);
+        corpus->entries[corpus->count].owned = FALSE;
+        corpus->bytes += corpus->entries[corpus->count].size;
+        corpus->count++;
+    }
+    return CFE_SUCCESS;
+}
+
+/*
+ * 변이 (워커별 rng.h 난수)
+ */
+static const uint32_t fuzz_interesting[] = {
+    0, 1, 0x7F, 0x80, 0xFF, 0x100, 0x7FFF, 0x8000, 0xFFFF, 0x10000,
+    0x7FFFFFFF, 0x80000000u, 0xFFFFFFFFu
+};
+
+static size_t Fuzz_Mutate(FuzzRun_t *run, uint8_t *buf, size_t size, CFS_Rng_t *rng) {
+    size_t max_len = run->max_len;
+    uint32_t op = CFS_Rng_Below(rng, 8);
+
+    // 빈 입력에는 바이트 삽입만 의미가 있다
+    if (size == 0) {
+        op = 4;
+    }
+
+    switch (op) {
+        case 0: {   // 비트 뒤집기
+            uint32_t bit = CFS_Rng_Below(rng, (uint32_t)size * 8);
+            buf[bit >> 3] ^= (uint8_t)(1u << (bit & 7));
+            break;
+        }
+        case 1:     // 임의 바이트
+            buf[CFS_Rng_Below(rng, (uint32_t)size)] = (uint8_t)CFS_Rng_Next(rng);
+            break;
+        case 2: {   // 경계값 (1/2/4 바이트, 리틀엔디언)
+            uint32_t value = fuzz_interesting[CFS_Rng_Below(rng, sizeof(fuzz_interesting) / sizeof(fuzz_interesting[0]))];
+            size_t width = (size_t)1 << CFS_Rng_Below(rng, 3);
+            size_t pos = CFS_Rng_Below(rng, (uint32_t)size);
+            for (size_t i = 0; i < width && pos + i < size; i++) {
+                buf[pos + i] = (uint8_t)(value >> (8 * i));
+            }
+            break;
+        }
+        case 3: {   // 작은 증감
+            size_t pos = CFS_Rng_Below(rng, (uint32_t)size);
+            buf[pos] = (uint8_t)(buf[pos] + CFS_Rng_Below(rng, 33) - 16);
+            break;
+        }
+        case 4: {   // 바이트 삽입
+            size_t n = 1 + CFS_Rng_Below(rng, 8);
+            if (size + n > max_len) {
+                break;
+            }
+            size_t pos = CFS_Rng_Below(rng, (uint32_t)size + 1);
+            memmove(buf + pos + n, buf + pos, size - pos);
+            for (size_t i = 0; i < n; i++) {
+                buf[pos + i] = (uint8_t)CFS_Rng_Next(rng);
+            }
+            size += n;
+            break;
+        }
+        case 5: {   // 바이트 삭제
+            size_t n = 1 + CFS_Rng_Below(rng, 8);
+            if (n >= size) {
+                break;
+            }
+            size_t pos = CFS_Rng_Below(rng, (uint32_t)(size - n + 1));
+            memmove(buf + pos, buf + pos + n, size - pos - n);
+            size -= n;
+            break;
+        }
+        case 6: {   // 입력 안 구간 복사
+            size_t len = 1 + CFS_Rng_Below(rng, (uint32_t)size);
+            size_t src = CFS_Rng_Below(rng, (uint32_t)(size - len + 1));
+            size_t dst = CFS_Rng_Below(rng, (uint32_t)(size - len + 1));
+            memmove(buf + dst, buf + src, len);
+            break;
+        }
+        default: {  // 다른 코퍼스 항목의 구간으로 덮어쓰기
+            uint32_t count = __atomic_load_n(&run->corpus.count, __ATOMIC_ACQUIRE);
+            const FuzzEntry_t *other = &run->corpus.entries[CFS_Rng_Below(rng, count)];
+            if (other->size == 0) {
+                break;
+            }
+            size_t len = 1 + CFS_Rng_Below(rng, other->size < size ? other->size : (uint32_t)size);
+            size_t src = CFS_Rng_Below(rng, (uint32_t)(other->size - len + 1));
+            size_t dst = CFS_Rng_Below(rng, (uint32_t)(size - len + 1));
+            memcpy(buf + dst, other->data + src, len);
+            break;
+        }
+    }
+    return size;
+}
+
+/*
+ * 실행과 평가
+ */
+static inline uint8_t Fuzz_Bucket(uint8_t count) {
+    if (count <= 3) {
+        return (uint8_t)(1u << (count - 1));
+    }
+    if (count <= 7) {
+        return 8;
+    }
+    if (count <= 15) {
+        return 16;
+    }
+    if (count <= 31) {
+        return 32;
+    }
+    return (count <= 127) ? 64 : 128;
+}
+
+// 이번 실행이 전역 맵에 처음 더한 (칸, 구간) 수
+static uint32_t Fuzz_Evaluate(FuzzRun_t *run, FuzzCoverage_t *cov) {
+    uint32_t new_features = 0;
+
+    for (uint32_t i = 0; i < cov->touched_count; i++) {
+        uint16_t idx = cov->touched[i];
+        uint8_t bit = Fuzz_Bucket(cov->counts[idx]);
+        cov->counts[idx] = 0;
+
+        if (__atomic_load_n(&run->virgin[idx], __ATOMIC_RELAXED) & bit) {
+            continue;
+        }
+        uint8_t old = __atomic_fetch_or(&run->virgin[idx], bit, __ATOMIC_RELAXED);
+        if (!(old & bit)) {
+            new_features++;
+            __atomic_fetch_add(&run->features, 1, __ATOMIC_RELAXED);
+            if (old == 0) {
+                __atomic_fetch_add(&run->edges, 1, __ATOMIC_RELAXED);
+            }
+        }
+    }
+    cov->touched_count = 0;
+    cov->prev = 0;
+    return new_features;
+}
+
+static uint32_t Fuzz_Execute(FuzzRun_t *run, FuzzCoverage_t *cov, uint32_t id,
+                             const uint8_t *data, size_t size) {
+    FuzzWorkerStats_t *stats = &run->stats[id];
+
+    run->current_size[id] = size;
+    run->current_data[id] = data;
+    t_fuzz_cov = cov;
+    (void)run->target(data, size);
+    t_fuzz_cov = NULL;
+    run->current_data[id] = NULL;
+
+    __atomic_store_n(&stats->execs, stats->execs + 1, __ATOMIC_RELAXED);
+    return Fuzz_Evaluate(run, cov);
+}
+
+/*
+ * 진행 줄 (libFuzzer 형식)
+ */
+static uint64_t Fuzz_TotalExecs(FuzzRun_t *run) {
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < run->workers; i++) {
+        total += __atomic_load_n(&run->stats[i].execs, __ATOMIC_RELAXED);
+    }
+    return total;
+}
+
+static long Fuzz_PeakRssMb(void) {
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss / 1024 : 0;
+}
+
+static void Fuzz_PrintStatus(FuzzRun_t *run, const char *event) {
+    uint64_t execs = Fuzz_TotalExecs(run);
+    uint64_t elapsed_s = (Fuzz_NowNs() - run->start_ns) / 1000000000ULL;
+    uint64_t bytes = __atomic_load_n(&run->corpus.bytes, __ATOMIC_RELAXED);
+    char corp_bytes[32];
+
+    if (bytes < (1u << 14)) {
+        snprintf(corp_bytes, sizeof(corp_bytes), "%lub", (unsigned long)bytes);
+    } else if (bytes < (1u << 24)) {
+        snprintf(corp_bytes, sizeof(corp_bytes), "%luKb", (unsigned long)(bytes >> 10));
+    } else {
+        snprintf(corp_bytes, sizeof(corp_bytes), "%luMb", (unsigned long)(bytes >> 20));
+    }
+
+    printf("#%lu\t%-6s cov: %lu ft: %lu corp: %u/%s exec/s: %lu rss: %ldMb\n",
+           (unsigned long)execs, event,
+           (unsigned long)__atomic_load_n(&run->edges, __ATOMIC_RELAXED),
+           (unsigned long)__atomic_load_n(&run->features, __ATOMIC_RELAXED),
+           __atomic_load_n(&run->corpus.count, __ATOMIC_RELAXED), corp_bytes,
+           (unsigned long)(elapsed_s ? execs / elapsed_s : execs), Fuzz_PeakRssMb());
+    fflush(stdout);
+}
+
+// 새 입력을 색인에 추가하고 코퍼스 디렉토리에 저장
+static void Fuzz_Keep(FuzzRun_t *run, uint32_t id, const uint8_t *data, size_t size) {
+    FuzzCorpus_t *corpus = &run->corpus;
+
+    if (!Fuzz_AddEntry(corpus, data, size, TRUE)) {
+        return;
+    }
+    __atomic_store_n(&run->stats[id].new_inputs, run->stats[id].new_inputs + 1, __ATOMIC_RELAXED);
+    if (corpus->out_dir) {
+        char path[1024];
+        char prefix[1000];
+        snprintf(prefix, sizeof(prefix), "%s/", corpus->out_dir);
+        Fuzz_ArtifactName(path, sizeof(path), prefix, "cfs", Fuzz_Hash(data, size));
+        if (!Fuzz_WriteFile(path, data, size)) {
+            fprintf(stderr, "Cannot save input: %s\n", path);
+        }
+    }
+    Fuzz_PrintStatus(run, "NEW");
+}
+
+// 시드 실행을 마친 워커가 관문이 열릴 때까지 대기
+static void Fuzz_InitGateWait(FuzzRun_t *run) {
+    pthread_mutex_lock(&run->init_lock);
+    run->init_arrived++;
+    pthread_cond_broadcast(&run->init_cond);
+    while (!run->init_open) {
+        pthread_cond_wait(&run->init_cond, &run->init_lock);
+    }
+    pthread_mutex_unlock(&run->init_lock);
+}
+
+// 시작한 워커 started 개가 모두 도착하면 관문을 연다
+static void Fuzz_InitGateOpen(FuzzRun_t *run, uint32_t started) {
+    pthread_mutex_lock(&run->init_lock);
+    while (run->init_arrived < started) {
+        pthread_cond_wait(&run->init_cond, &run->init_lock);
+    }
+    run->init_open = TRUE;
+    pthread_cond_broadcast(&run->init_cond);
+    pthread_mutex_unlock(&run->init_lock);
+}
+
+static void* Fuzz_Worker(void *arg) {
+    FuzzWorker_t *worker = (FuzzWorker_t *)arg;
+    FuzzRun_t *run = worker->run;
+    uint32_t id = worker->id;
+    FuzzCoverage_t *cov = calloc(1, sizeof(FuzzCoverage_t));
+    uint8_t *buf = malloc(run->max_len);
+    CFS_Rng_t rng;
+
+    // 워커마다 다른 수열 (같은 -seed 와 워커 수면 같은 변이)
+    CFS_Rng_Seed(&rng, run->seed ^ ((uint64_t)(id + 1) * 0x9E3779B97F4A7C15ULL));
+    t_fuzz_worker = (int)id;
+
+    // 워커마다 나눠 받은 실행 횟수 (0 = 무제한)
+    uint64_t quota = 0;
+    if (run->max_runs) {
+        quota = run->max_runs / run->workers + (id < run->max_runs % run->workers ? 1 : 0);
+    }
+
+    // 시드를 워커 수로 나눠 한 번씩 실행해 전역 맵을 채운다 (시드는 모두 색인에 남는다)
+    uint32_t seeds = run->corpus.seed_count;
+    for (uint32_t i = id; cov && buf && i < seeds && !run->stop; i += run->workers) {
+        const FuzzEntry_t *entry = &run->corpus.entries[i];
+        memcpy(buf, entry->data, entry->size);
+        (void)Fuzz_Execute(run, cov, id, buf, entry->size);
+    }
+    Fuzz_InitGateWait(run);
+
+    while (cov && buf && !run->stop && (!quota || run->stats[id].execs < quota)) {
+        uint32_t count = __atomic_load_n(&run->corpus.count, __ATOMIC_ACQUIRE);
+        const FuzzEntry_t *entry = &run->corpus.entries[CFS_Rng_Below(&rng, count)];
+        size_t size = entry->size;
+
+        memcpy(buf, entry->data, size);
+        for (uint32_t k = 1 + CFS_Rng_Below(&rng, FUZZ_MAX_STACK); k > 0; k--) {
+            size = Fuzz_Mutate(run, buf, size, &rng);
+        }
+        if (Fuzz_Execute(run, cov, id, buf, size) > 0) {
+            Fuzz_Keep(run, id, buf, size);
+        }
+    }
+
+    // 스레드와 함께 사라질 모듈 상태 (아레나, 캐시, 기록 버퍼) 해제
+    CFS_Replay_ReleaseThread();
+    __atomic_fetch_add(&run->finished, 1, __ATOMIC_RELEASE);
+    free(buf);
+    free(cov);
+    return NULL;
+}
+
+/*
+ * 명령행
+ */
+boolean CFS_FuzzLoop_Requested(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-fuzz") == 0) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static boolean Fuzz_Flag(const char *arg, const char *name, const char **value) {
+    size_t len = strlen(name);
+    if (strncmp(arg, name, len) == 0 && arg[len] == '=') {
+        *value = arg + len + 1;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+static void Fuzz_Usage(const char *prog) {
+    fprintf(stderr, "Usage: %s -fuzz [-workers=N] [-runs=N] [-max_total_time=S] [-max_len=N]\n"
+                    "          [-seed=N] [-artifact_prefix=P] <corpus dir|pack>...\n", prog);
+}
+
+static void Fuzz_FreeRun(FuzzRun_t *run) {
+    FuzzCorpus_t *corpus = &run->corpus;
+
+    if (corpus->entries) {
+        for (uint32_t i = 0; i < corpus->count; i++) {
+            if (corpus->entries[i].owned) {
+                free((void *)corpus->entries[i].data);
+            }
+        }
+        free(corpus->entries);
+    }
+    for (uint32_t i = 0; i < corpus->pack_count; i++) {
+        CFS_CorpusPack_Close(&corpus->packs[i]);
+    }
+    pthread_mutex_destroy(&corpus->lock);
+    free(run);
+}
+
+int CFS_FuzzLoop_Main(int argc, char **argv, CFS_ReplayTarget_t target) {
+    FuzzRun_t *run = calloc(1, sizeof(FuzzRun_t));
+    const char **paths = calloc((size_t)argc, sizeof(char *));
+    int path_count = 0;
+    uint64_t max_time_s = 0;
+
+    if (!run || !paths) {
+        free(run);
+        free(paths);
+        return 1;
+    }
+    pthread_mutex_init(&run->corpus.lock, NULL);
+    run->target = target;
+    run->max_len = FUZZ_DEFAULT_MAX_LEN;
+    run->seed = (uint64_t)time(NULL) ^ ((uint64_t)getpid() << 32);
+    run->artifact_prefix = "./";
+
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    run->workers = ncpu > 0 ? (uint32_t)ncpu : 1;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value;
+
+        if (strcmp(arg, "-fuzz") == 0) {
+            continue;
+        } else if (Fuzz_Flag(arg, "-workers", &value) || Fuzz_Flag(arg, "-jobs", &value)) {
+            run->workers = (uint32_t)strtoul(value, NULL, 10);
+        } else if (Fuzz_Flag(arg, "-runs", &value)) {
+            long long runs = strtoll(value, NULL, 10);
+            run->max_runs = runs > 0 ? (uint64_t)runs : 0;
+        } else if (Fuzz_Flag(arg, "-max_total_time", &value)) {
+            max_time_s = strtoull(value, NULL, 10);
+        } else if (Fuzz_Flag(arg, "-max_len", &value)) {
+            run->max_len = (uint32_t)strtoul(value, NULL, 10);
+        } else if (Fuzz_Flag(arg, "-seed", &value)) {
+            run->seed = strtoull(value, NULL, 10);
+        } else if (Fuzz_Flag(arg, "-artifact_prefix", &value)) {
+            run->artifact_prefix = value;
+        } else if (arg[0] == '-') {
+            // libFuzzer 전용 옵션 (-rss_limit_mb, -dict 등) 은 무시
+            fprintf(stderr, "WARNING: ignoring unsupported flag %s\n", arg);
+        } else {
+            paths[path_count++] = arg;
+        }
+    }
+
+    if (run->workers == 0 || run->max_len == 0) {
+        Fuzz_Usage(argv[0]);
+        free(paths);
+        Fuzz_FreeRun(run);
+        return 2;
+    }
+    if (run->workers > FUZZ_MAX_WORKERS) {
+        run->workers = FUZZ_MAX_WORKERS;
+    }
+    run->max_time_ns = max_time_s * 1000000000ULL;
+
+    // 색인 배열은 최대 크기로 한 번 잡는다 (쓰지 않은 뒤쪽은 물리 메모리를 쓰지 않음)
+    run->corpus.entries = calloc(FUZZ_MAX_ENTRIES, sizeof(FuzzEntry_t));
+    if (!run->corpus.entries) {
+        free(paths);
+        Fuzz_FreeRun(run);
+        return 1;
+    }
+    for (int i = 0; i < path_count; i++) {
+        struct stat st;
+        if (!run->corpus.out_dir && stat(paths[i], &st) == 0 && S_ISDIR(st.st_mode)) {
+            run->corpus.out_dir = paths[i];
+        }
+        if (Fuzz_LoadPath(run, paths[i]) == CFS_MM_ERROR_RESOURCE_LIMIT) {
+            fprintf(stderr, "WARNING: corpus index full, remaining seeds skipped\n");
+            break;
+        }
+    }
+    if (run->corpus.count == 0) {
+        static const uint8_t empty[1] = { 0 };
+        Fuzz_AddEntry(&run->corpus, empty, 0, FALSE);
+    }
+    run->corpus.seed_count = run->corpus.count;
+    free(paths);
+
+    printf("INFO: in-process fuzzing, %u workers, seed %lu, %u seed inputs (%lu bytes)\n",
+           run->workers, (unsigned long)run->seed, run->corpus.seed_count,
+           (unsigned long)run->corpus.bytes);
+    if (!g_fuzz_instrumented) {
+        printf("INFO: no coverage instrumentation (build the mtfuzz variant), mutating blindly\n");
+    }
+    printf("INFO: new inputs -> %s\n", run->corpus.out_dir ? run->corpus.out_dir : "(memory only)");
+
+    pthread_mutex_init(&run->init_lock, NULL);
+    pthread_cond_init(&run->init_cond, NULL);
+    g_fuzz_run = run;
+    Fuzz_InstallHandlers();
+    run->start_ns = Fuzz_NowNs();
+
+    FuzzWorker_t workers[FUZZ_MAX_WORKERS];
+    pthread_t tids[FUZZ_MAX_WORKERS];
+    uint32_t started = 0;
+    for (uint32_t t = 0; t < run->workers; t++) {
+        workers[t].run = run;
+        workers[t].id = t;
+        if (pthread_create(&tids[t], NULL, Fuzz_Worker, &workers[t]) != 0) {
+            break;
+        }
+        started++;
+    }
+    if (started < run->workers) {
+        // 시드 분배와 실행 몫이 워커 수 기준이므로 시작한 워커만 멈추고 끝낸다
+        fprintf(stderr, "Cannot start %u workers (started %u)\n", run->workers, started);
+        run->stop = 1;
+        Fuzz_InitGateOpen(run, started);
+        for (uint32_t t = 0; t < started; t++) {
+            pthread_join(tids[t], NULL);
+        }
+        g_fuzz_run = NULL;
+        pthread_cond_destroy(&run->init_cond);
+        pthread_mutex_destroy(&run->init_lock);
+        Fuzz_FreeRun(run);
+        return 1;
+    }
+
+    Fuzz_InitGateOpen(run, started);
+    Fuzz_PrintStatus(run, "INITED");
+
+    // 보고 스레드: 시간 제한, 종료 신호, 주기적 진행 줄
+    uint64_t next_report = Fuzz_NowNs() + FUZZ_REPORT_NS;
+    while (__atomic_load_n(&run->finished, __ATOMIC_ACQUIRE) < run->workers) {
+        struct timespec nap = { 0, 100000000L };
+        nanosleep(&nap, NULL);
+
+        uint64_t now = Fuzz_NowNs();
+        if (run->max_time_ns && now - run->start_ns >= run->max_time_ns) {
+            run->stop = 1;
+        }
+        if (now >= next_report) {
+            Fuzz_PrintStatus(run, "pulse");
+            next_report = now + FUZZ_REPORT_NS;
+        }
+    }
+    for (uint32_t t = 0; t < run->workers; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    g_fuzz_run = NULL;
+    pthread_cond_destroy(&run->init_cond);
+    pthread_mutex_destroy(&run->init_lock);
+
+    uint64_t execs = Fuzz_TotalExecs(run);
+    uint64_t elapsed_ns = Fuzz_NowNs() - run->start_ns;
+    uint64_t new_inputs = 0;
+    for (uint32_t t = 0; t < run->workers; t++) {
+        new_inputs += run->stats[t].new_inputs;
+    }
+    Fuzz_PrintStatus(run, "DONE");
+    printf("Done %lu runs in %lu second(s)\n", (unsigned long)execs,
+           (unsigned long)(elapsed_ns / 1000000000ULL));
+    printf("stat::number_of_executed_units: %lu\n", (unsigned long)execs);
+    printf("stat::average_exec_per_sec:     %lu\n",
+           (unsigned long)(elapsed_ns ? execs * 1000000000ULL / elapsed_ns : 0));
+    printf("stat::new_units_added:          %lu\n", (unsigned long)new_inputs);
+    printf("stat::peak_rss_mb:              %ld\n", Fuzz_PeakRssMb());
+    for (uint32_t t = 0; t < run->workers; t++) {
+        printf("stat::worker_%u_execs:          %lu\n", t, (unsigned long)run->stats[t].execs);
+    }
+
+    Fuzz_FreeRun(run);
+    return 0;
+}
@@ -0,0 +1,34 @@
+/*
+ * CFS 프로세스 내 다중 워커 퍼징 루프 헤더
+ * libFuzzer -workers=N 처럼 프로세스를 N 개 띄우지 않고 한 프로세스 안에서
+ * N 스레드가 같은 코퍼스 색인을 읽으며 변이/실행한다.
+ *   - 하니스 상태(시뮬레이션 메모리, VFS, MM_AppData 등)는 이미 스레드별이므로
+ *     워커는 재생 러너와 같은 대상 함수를 그대로 호출한다.
+ *   - 코퍼스 색인은 읽기 전용 항목 배열이며 새 입력은 뒤에 추가만 한다.
+ *   - 커버리지 피드백은 mtfuzz 변형 (-fsanitize-coverage=trace-pc) 에서만 있고,
+ *     다른 변형에서는 무작위 변이만 한다.
+ *
+ * 진행 줄은 libFuzzer 형식 (#N ... cov: X ft: Y corp: C/Bb exec/s: E rss: RMb) 이라
+ * scripts/fuzz_stats.sh record 로 그대로 시계열을 만들 수 있다.
+ */
+
+#ifndef CFS_FUZZ_LOOP_H
+#define CFS_FUZZ_LOOP_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+#include "replay.h"
+
+// 명령행에 -fuzz 가 있는지 (하니스 main 이 재생 대신 퍼징 루프로 갈지 결정)
+boolean CFS_FuzzLoop_Requested(int argc, char **argv);
+
+/*
+ * 명령행 인수 파싱 후 퍼징
+ *   -fuzz [-workers=N] [-runs=N] [-max_total_time=S] [-max_len=N] [-seed=N]
+ *   [-artifact_prefix=P] <코퍼스 디렉토리|팩>...
+ * 새 입력은 첫 번째 디렉토리에 저장하고, 크래시 입력은 <artifact_prefix>crash-<해시> 로 남긴다.
+ * 반환값: 0 = 정상 종료, 2 = 인수 오류
+ */
+int CFS_FuzzLoop_Main(int argc, char **argv, CFS_ReplayTarget_t target);
+
+#endif // CFS_FUZZ_LOOP_H
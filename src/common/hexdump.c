@@ -0,0 +1,216 @@
+/*
+ * CFS 헥스 덤프 포매터
+ *
+ * 16 바이트 줄 하나를 니블 변환 (SSE2 는 16 바이트를 한 번에, 아니면 표 조회) 과
+ * 출력 가능 문자 마스크로 만들고, 블록 버퍼가 차면 write 한 번으로 내보낸다.
+ * 바이트마다 printf 를 부르던 방식보다 1MB 영역 덤프가 수십 배 빠르다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <unistd.h>
+
+#include "hexdump.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define HEXDUMP_LINE_BYTES  16
+#define HEXDUMP_LINE_MAX    (CFS_HEXDUMP_PREFIX_MAX + 1 + 16 + 2 + HEXDUMP_LINE_BYTES * 3 + 1 + HEXDUMP_LINE_BYTES + 1)
+#define HEXDUMP_BLOCK_LINES 32
+
+static const char g_hexdump_digits[] = "0123456789ABCDEF";
+
+typedef struct {
+    int     fd;
+    size_t  used;
+    boolean failed;
+    char    buf[HEXDUMP_BLOCK_LINES * HEXDUMP_LINE_MAX];
+} HexDumpSink_t;
+
+static void HexDump_Flush(HexDumpSink_t *sink) {
+    size_t done = 0;
+    while (!sink->failed && done < sink->used) {
+        ssize_t w = write(sink->fd, sink->buf + done, sink->used - done);
+        if (w < 0 && errno == EINTR) {
+            continue;
+        }
+        if (w <= 0) {
+            sink->failed = TRUE;
+            break;
+        }
+        done += (size_t)w;
+    }
+    sink->used = 0;
+}
+
+// 줄 하나를 쓸 자리 (모자라면 블록을 먼저 내보냄)
+static char* HexDump_Reserve(HexDumpSink_t *sink) {
+    if (sink->used + HEXDUMP_LINE_MAX > sizeof(sink->buf)) {
+        HexDump_Flush(sink);
+    }
+    return sink->buf + sink->used;
+}
+
+/*
+ * 16 바이트 → 32 자리 16 진수와 16 자 ASCII (출력 불가 문자는 '.')
+ */
+#if defined(__SSE2__)
+static inline __m128i HexDump_NibbleChars(__m128i nibbles) {
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('A' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+
+static inline void HexDump_Convert(const uint8_t bytes[HEXDUMP_LINE_BYTES], char digits[32], char ascii[16]) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)(const void *)bytes);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i hi = HexDump_NibbleChars(_mm_and_si128(_mm_srli_epi16(v, 4), mask));
+    const __m128i lo = HexDump_NibbleChars(_mm_and_si128(v, mask));
+    _mm_storeu_si128((__m128i *)(void *)digits, _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128((__m128i *)(void *)(digits + 16), _mm_unpackhi_epi8(hi, lo));
+
+    // 부호 있는 비교: 0x80 이상은 음수라 31 보다 크지 않다
+    const __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(31)),
+                                            _mm_cmplt_epi8(v, _mm_set1_epi8(127)));
+    _mm_storeu_si128((__m128i *)(void *)ascii,
+                     _mm_or_si128(_mm_and_si128(printable, v), _mm_andnot_si128(printable, _mm_set1_epi8('.'))));
+}
+#else
+static inline void HexDump_Convert(const uint8_t bytes[HEXDUMP_LINE_BYTES], char digits[32], char ascii[16]) {
+    for (size_t i = 0; i < HEXDUMP_LINE_BYTES; i++) {
+        uint8_t c = bytes[i];
+        digits[2 * i] = g_hexdump_digits[c >> 4];
+        digits[2 * i + 1] = g_hexdump_digits[c & 0xF];
+        ascii[i] = (c >= 32 && c <= 126) ? (char)c : '.';
+    }
+}
+#endif
+
+typedef struct {
+    const char *prefix;
+    size_t      prefix_len;
+    uint32_t    addr_digits;
+    boolean     marked;         // 비교 모드 (표시 열 있음)
+} HexDumpLayout_t;
+
+static char* HexDump_Head(char *p, const HexDumpLayout_t *layout, char marker) {
+    memcpy(p, layout->prefix, layout->prefix_len);
+    p += layout->prefix_len;
+    if (layout->marked) {
+        *p++ = marker;
+    }
+    return p;
+}
+
+static void HexDump_Line(HexDumpSink_t *sink, const HexDumpLayout_t *layout, char marker,
+                         uint64_t addr, const uint8_t *bytes, size_t n) {
+    uint8_t line[HEXDUMP_LINE_BYTES] = { 0 };
+    char digits[32];
+    char ascii[16];
+    char *p = HexDump_Head(HexDump_Reserve(sink), layout, marker);
+
+    for (uint32_t d = layout->addr_digits; d > 0; d--) {
+        *p++ = g_hexdump_digits[(addr >> (4 * (d - 1))) & 0xF];
+    }
+    *p++ = ':';
+    *p++ = ' ';
+
+    if (n < HEXDUMP_LINE_BYTES) {
+        memcpy(line, bytes, n);
+        bytes = line;
+    }
+    HexDump_Convert(bytes, digits, ascii);
+    for (size_t i = 0; i < HEXDUMP_LINE_BYTES; i++) {
+        if (i < n) {
+            p[0] = digits[2 * i];
+            p[1] = digits[2 * i + 1];
+        } else {
+            p[0] = ' ';
+            p[1] = ' ';
+        }
+        p[2] = ' ';
+        p += 3;
+    }
+    *p++ = ' ';
+    memcpy(p, ascii, n);
+    p += n;
+    *p++ = '\n';
+    sink->used = (size_t)(p - sink->buf);
+}
+
+static void HexDump_Elided(HexDumpSink_t *sink, const HexDumpLayout_t *layout) {
+    char *p = HexDump_Head(HexDump_Reserve(sink), layout, ' ');
+    *p++ = '*';
+    *p++ = '\n';
+    sink->used = (size_t)(p - sink->buf);
+}
+
+int32_t CFS_HexDump_Write(int fd, const void *data, size_t length, const CFS_HexDumpOptions_t *opts) {
+    static const CFS_HexDumpOptions_t defaults = { NULL, 0, NULL, 0 };
+    const uint8_t *bytes = data;
+    HexDumpSink_t sink;
+    HexDumpLayout_t layout;
+
+    if (length == 0) {
+        return CFE_SUCCESS;
+    }
+    if (!data) {
+        return OS_INVALID_POINTER;
+    }
+    if (!opts) {
+        opts = &defaults;
+    }
+
+    sink.fd = fd;
+    sink.used = 0;
+    sink.failed = FALSE;
+
+    layout.prefix = opts->prefix ? opts->prefix : "";
+    layout.prefix_len = strnlen(layout.prefix, CFS_HEXDUMP_PREFIX_MAX);
+    layout.marked = (opts->compare != NULL);
+
+    // 주소 폭은 마지막 주소에 맞춰 고정 (최소 4 자리)
+    uint64_t last = opts->base + length - 1;
+    layout.addr_digits = 4;
+    while (layout.addr_digits < 16 && (last >> (4 * layout.addr_digits)) != 0) {
+        layout.addr_digits++;
+    }
+
+    const boolean elide = (opts->flags & CFS_HEXDUMP_ELIDE) != 0;
+    boolean in_run = FALSE;
+    for (size_t offset = 0; offset < length; offset += HEXDUMP_LINE_BYTES) {
+        size_t n = (length - offset < HEXDUMP_LINE_BYTES) ? length - offset : HEXDUMP_LINE_BYTES;
+        const uint8_t *line = bytes + offset;
+        uint64_t addr = opts->base + offset;
+
+        if (opts->compare) {
+            const uint8_t *other = opts->compare + offset;
+            if (memcmp(line, other, n) != 0) {
+                HexDump_Line(&sink, &layout, '-', addr, other, n);
+                HexDump_Line(&sink, &layout, '+', addr, line, n);
+                in_run = FALSE;
+                continue;
+            }
+            if (elide) {
+                if (!in_run) {
+                    HexDump_Elided(&sink, &layout);
+                    in_run = TRUE;
+                }
+                continue;
+            }
+        } else if (elide && offset > 0 && n == HEXDUMP_LINE_BYTES &&
+                   memcmp(line, line - HEXDUMP_LINE_BYTES, HEXDUMP_LINE_BYTES) == 0) {
+            if (!in_run) {
+                HexDump_Elided(&sink, &layout);
+                in_run = TRUE;
+            }
+            continue;
+        }
+        in_run = FALSE;
+        HexDump_Line(&sink, &layout, ' ', addr, line, n);
+    }
+    HexDump_Flush(&sink);
+    return sink.failed ? CFS_MM_ERROR_FILE_ACCESS : CFE_SUCCESS;
+}
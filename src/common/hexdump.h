@@ -0,0 +1,40 @@
+/*
+ * CFS 헥스 덤프 포매터 헤더
+ * 줄 형식은 CFS_HexDump 와 같다: "<접두><주소>: XX XX .. XX  ASCII"
+ * 줄들을 고정 크기 블록 버퍼에 만들어 블록마다 write 한 번으로 내보낸다.
+ * malloc/stdio 를 쓰지 않으므로 크래시 보고 (시그널 핸들러) 에서도 부를 수 있다.
+ *
+ *   - base:    첫 바이트의 주소 (영역 기준 주소를 주면 시뮬레이션 주소로 표시)
+ *   - compare: 같은 길이의 비교 버퍼. 다른 줄은 '-' (compare) / '+' (data) 두 줄,
+ *              같은 줄은 ' ' 로 표시한다
+ *   - CFS_HEXDUMP_ELIDE: 앞 줄과 같은 줄 (비교 모드면 두 버퍼가 같은 줄) 이 이어지면 "*" 한 줄
+ */
+
+#ifndef CFS_HEXDUMP_H
+#define CFS_HEXDUMP_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+#define CFS_HEXDUMP_ELIDE           0x1u
+
+// 줄 머리 접두어 최대 길이 (넘으면 자름)
+#define CFS_HEXDUMP_PREFIX_MAX      64
+
+// 크래시 보고에 싣는 입력 앞부분 바이트 수
+#define CFS_HEXDUMP_CRASH_BYTES     256
+
+typedef struct {
+    const char    *prefix;      // NULL = 없음
+    uint64_t       base;
+    const uint8_t *compare;     // NULL = 비교 안 함
+    uint32_t       flags;
+} CFS_HexDumpOptions_t;
+
+/*
+ * fd 로 헥스 덤프 출력 (opts 가 NULL 이면 접두어 없음, 주소 0 부터)
+ * 반환값: CFE_SUCCESS, OS_INVALID_POINTER, CFS_MM_ERROR_FILE_ACCESS (쓰기 실패)
+ */
+int32_t CFS_HexDump_Write(int fd, const void *data, size_t length, const CFS_HexDumpOptions_t *opts);
+
+#endif // CFS_HEXDUMP_H
@@ -0,0 +1,137 @@
+/*
+ * CFS 퍼징 입력 소비기
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "input.h"
+
+void CFS_Input_Init(CFS_Input_t *in, const uint8_t *data, size_t size) {
+    in->data = data;
+    in->size = data ? size : 0;
+    in->offset = 0;
+}
+
+// width 바이트를 리틀엔디언으로 읽고 위치를 항상 width 만큼 옮긴다
+static inline uint64_t Input_Take(CFS_Input_t *in, size_t width) {
+    uint64_t value = 0;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    // 필드가 입력 안에 모두 있으면 (대부분의 실행) 한 번에 읽는다
+    if (in->offset + width <= in->size) {
+        memcpy(&value, in->data + in->offset, width);
+        in->offset += width;
+        return value;
+    }
+#endif
+
+    for (size_t i = 0; i < width; i++) {
+        size_t pos = in->offset + i;
+        if (pos < in->size) {
+            value |= (uint64_t)in->data[pos] << (8 * i);
+        }
+    }
+    in->offset += width;
+    return value;
+}
+
+uint8_t CFS_Input_U8(CFS_Input_t *in) {
+    return (uint8_t)Input_Take(in, 1);
+}
+
+uint16_t CFS_Input_U16(CFS_Input_t *in) {
+    return (uint16_t)Input_Take(in, 2);
+}
+
+uint32_t CFS_Input_U32(CFS_Input_t *in) {
+    return (uint32_t)Input_Take(in, 4);
+}
+
+uint64_t CFS_Input_U64(CFS_Input_t *in) {
+    return Input_Take(in, 8);
+}
+
+boolean CFS_Input_Bool(CFS_Input_t *in) {
+    return (CFS_Input_U8(in) & 1) ? TRUE : FALSE;
+}
+
+uint32_t CFS_Input_Range32(CFS_Input_t *in, uint32_t min, uint32_t max) {
+    uint32_t value = CFS_Input_U32(in);
+
+    if (max <= min) {
+        return min;
+    }
+    uint64_t span = (uint64_t)max - min + 1;
+    return min + (uint32_t)(value % span);
+}
+
+size_t CFS_Input_Index(CFS_Input_t *in, size_t count) {
+    size_t value = (count <= 256) ? CFS_Input_U8(in) : CFS_Input_U16(in);
+    return count > 0 ? value % count : 0;
+}
+
+void CFS_Divisor_Init(CFS_Divisor_t *div, uint32_t divisor) {
+    div->divisor = divisor ? divisor : 1;
+    div->magic = UINT64_C(0xFFFFFFFFFFFFFFFF) / div->divisor + 1;
+}
+
+uint32_t CFS_Input_RangeDiv(CFS_Input_t *in, uint32_t min, const CFS_Divisor_t *span) {
+    return min + CFS_Divisor_Mod(span, CFS_Input_U32(in));
+}
+
+void CFS_Selector_Init(CFS_Selector_t *sel, uint32_t count) {
+    sel->count = count;
+    CFS_Divisor_Init(&sel->wide, count);
+    for (uint32_t b = 0; b < 256; b++) {
+        sel->narrow[b] = (uint16_t)(count ? b % count : 0);
+    }
+}
+
+size_t CFS_Input_Select(CFS_Input_t *in, const CFS_Selector_t *sel) {
+    if (sel->count <= 256) {
+        return sel->narrow[CFS_Input_U8(in)];
+    }
+    return CFS_Divisor_Mod(&sel->wide, CFS_Input_U16(in));
+}
+
+int32_t CFS_NameTable_Build(CFS_NameTable_t *table, const char *const *prefixes, uint32_t count,
+                            const char *suffix, uint32_t width) {
+    memset(table, 0, sizeof(*table));
+    table->records = calloc(count ? count : 1, width);
+    table->lengths = calloc(count ? count : 1, sizeof(uint16_t));
+    if (!table->records || !table->lengths || width == 0) {
+        CFS_NameTable_Free(table);
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+
+    table->count = count;
+    table->width = width;
+    for (uint32_t i = 0; i < count; i++) {
+        char *record = table->records + (size_t)i * width;
+        snprintf(record, width, "%s%s", prefixes[i], suffix);
+        table->lengths[i] = (uint16_t)strlen(record);
+    }
+    CFS_Selector_Init(&table->select, count);
+    return CFE_SUCCESS;
+}
+
+void CFS_NameTable_Free(CFS_NameTable_t *table) {
+    free(table->records);
+    free(table->lengths);
+    memset(table, 0, sizeof(*table));
+}
+
+boolean CFS_Input_Complete(const CFS_Input_t *in) {
+    return in->offset <= in->size;
+}
+
+const uint8_t* CFS_Input_Tail(const CFS_Input_t *in, size_t *length) {
+    if (in->offset >= in->size) {
+        *length = 0;
+        return in->data ? in->data + in->size : NULL;
+    }
+    *length = in->size - in->offset;
+    return in->data + in->offset;
+}
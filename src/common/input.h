@@ -0,0 +1,110 @@
+/*
+ * CFS 퍼징 입력 소비기 헤더
+ * 퍼징 입력을 타입이 있는 필드로 읽는다 (FuzzedDataProvider 방식).
+ *
+ * 배치 규칙
+ *   - 필드는 앞에서부터 고정 폭으로 읽는다. 폭은 값과 무관하므로
+ *     한 필드를 변이해도 뒤 필드의 위치가 바뀌지 않는다.
+ *   - 입력이 모자라면 남은 필드는 0 바이트로 채운 것처럼 읽는다.
+ *   - 가변 길이 내용(페이로드)은 모든 필드 뒤의 꼬리 바이트로 받는다.
+ *     필드 영역이 고정 크기이므로 페이로드 안의 삽입/삭제는 필드에 영향이 없다.
+ */
+
+#ifndef CFS_INPUT_H
+#define CFS_INPUT_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+typedef struct {
+    const uint8_t *data;
+    size_t         size;
+    size_t         offset;      // 다음 필드 위치 (size 를 넘을 수 있음)
+} CFS_Input_t;
+
+void CFS_Input_Init(CFS_Input_t *in, const uint8_t *data, size_t size);
+
+// 고정 폭 정수 (리틀엔디언)
+uint8_t  CFS_Input_U8(CFS_Input_t *in);
+uint16_t CFS_Input_U16(CFS_Input_t *in);
+uint32_t CFS_Input_U32(CFS_Input_t *in);
+uint64_t CFS_Input_U64(CFS_Input_t *in);
+boolean  CFS_Input_Bool(CFS_Input_t *in);
+
+// [min, max] 범위 정수 (4 바이트)
+uint32_t CFS_Input_Range32(CFS_Input_t *in, uint32_t min, uint32_t max);
+
+// count 개 중 하나의 인덱스 (count 가 256 이하면 1 바이트, 아니면 2 바이트)
+size_t CFS_Input_Index(CFS_Input_t *in, size_t count);
+
+// 표에서 하나 선택 (예: CFS_INPUT_PICK(&in, mm_load_mem_types))
+#define CFS_INPUT_PICK(in, table) \
+    ((table)[CFS_Input_Index((in), sizeof(table) / sizeof((table)[0]))])
+
+/*
+ * 나눗셈 없는 나머지 (곱셈 두 번, 32 비트 값에 대해 % 와 같은 결과)
+ * magic = ceil(2^64 / divisor), 상수 제수는 CFS_DIVISOR 로 컴파일 시간에 만든다.
+ */
+typedef struct {
+    uint64_t magic;
+    uint32_t divisor;
+} CFS_Divisor_t;
+
+#define CFS_DIVISOR(d)  { UINT64_C(0xFFFFFFFFFFFFFFFF) / (d) + 1, (d) }
+
+void CFS_Divisor_Init(CFS_Divisor_t *div, uint32_t divisor);
+
+static inline uint32_t CFS_Divisor_Mod(const CFS_Divisor_t *div, uint32_t value) {
+#ifdef __SIZEOF_INT128__
+    uint64_t low = div->magic * value;
+    return (uint32_t)(((unsigned __int128)low * div->divisor) >> 64);
+#else
+    return value % div->divisor;
+#endif
+}
+
+// CFS_Input_Range32 과 같은 값, span = max - min + 1 을 미리 만든 제수로
+uint32_t CFS_Input_RangeDiv(CFS_Input_t *in, uint32_t min, const CFS_Divisor_t *span);
+
+/*
+ * count 개 중 하나를 고르는 선택기 (CFS_Input_Index 와 같은 폭/결과)
+ * 1 바이트 선택값은 표 조회, 2 바이트 선택값은 CFS_Divisor_Mod.
+ */
+typedef struct {
+    uint32_t      count;
+    CFS_Divisor_t wide;
+    uint16_t      narrow[256];  // 바이트 % count (count 0 이면 0)
+} CFS_Selector_t;
+
+void CFS_Selector_Init(CFS_Selector_t *sel, uint32_t count);
+size_t CFS_Input_Select(CFS_Input_t *in, const CFS_Selector_t *sel);
+
+/*
+ * 미리 조립한 이름 표: 항목마다 "<접두><접미>" 를 width 바이트 레코드로
+ * (NUL 포함, 넘치면 snprintf 처럼 자르고 나머지는 0) 저장한다.
+ * 패킷의 고정 크기 이름 필드에 memcpy 한 번으로 복사할 수 있다.
+ */
+typedef struct {
+    uint32_t        count;
+    uint32_t        width;
+    char           *records;    // count * width
+    uint16_t       *lengths;    // 레코드의 문자열 길이
+    CFS_Selector_t  select;
+} CFS_NameTable_t;
+
+// 반환값: CFE_SUCCESS, CFS_MM_ERROR_RESOURCE_LIMIT
+int32_t CFS_NameTable_Build(CFS_NameTable_t *table, const char *const *prefixes, uint32_t count,
+                            const char *suffix, uint32_t width);
+void CFS_NameTable_Free(CFS_NameTable_t *table);
+
+static inline const char* CFS_NameTable_Get(const CFS_NameTable_t *table, size_t index) {
+    return table->records + index * table->width;
+}
+
+// 필드 영역이 입력 안에 모두 들어 있는지
+boolean CFS_Input_Complete(const CFS_Input_t *in);
+
+// 필드 뒤의 꼬리 바이트 (페이로드), 없으면 길이 0
+const uint8_t* CFS_Input_Tail(const CFS_Input_t *in, size_t *length);
+
+#endif // CFS_INPUT_H
@@ -0,0 +1,613 @@
+/*
+ * CFS 미션 프로파일
+ *
+ * 표 세 개와 색인을 malloc 한 번으로 잡은 아레나에 차례로 놓는다.
+ *   [CFS_Mission_t][영역][심볼 주소][심볼 포인터][경로 포인터]
+ *   [심볼 해시 색인][경로 길이][경로 순서][문자열]
+ * 조회는 모두 이 아레나 안에서 끝난다.
+ *   - 영역: 시작 주소 순 정렬 + 이분 탐색 (겹침은 읽을 때 거부)
+ *   - 심볼: 이름 FNV-1a 해시의 열린 주소 표 (주소가 지정된 심볼 조회용)
+ *   - 경로: 두 번째 바이트로 묶은 구간만 길이를 미리 잰 접두 비교
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "mission.h"
+#include "sym_cache.h"
+
+#include <pthread.h>
+#include <time.h>
+
+// 기본 심볼 (플랫폼별로 다를 수 있음)
+static const char *const mission_default_symbols[] = {
+    // Core Flight Executive 기본 심볼들
+    "CFE_ES_Global",
+    "CFE_TBL_Global",
+    "CFE_EVS_Global",
+    "CFE_SB_Global",
+    "CFE_TIME_Global",
+
+    // MM 모듈 관련
+    "MM_AppData",
+    "MM_ResetArea",
+    "MM_CmdCounter",
+    "MM_ErrCounter",
+
+    // 다른 CFS 앱들
+    "CS_AppData",      // Checksum 앱
+    "DS_AppData",      // Data Storage 앱
+    "FM_AppData",      // File Manager 앱
+    "HK_AppData",      // Housekeeping 앱
+    "LC_AppData",      // Limit Checker 앱
+    "MD_AppData",      // Memory Dwell 앱
+    "SC_AppData",      // Stored Command 앱
+    "SCH_AppData",     // Scheduler 앱
+
+    // OSAL/PSP 심볼들
+    "OS_VolumeTable",
+    "PSP_MemoryTable",
+    "CFE_PSP_MemoryTable",
+
+    // 시스템 심볼들
+    "BSP_RAM_START",
+    "BSP_RAM_END",
+    "BSP_EEPROM_START",
+    "BSP_EEPROM_END"
+};
+
+// 기본 파일 시스템 경로
+static const char *const mission_default_paths[] = {
+    "/cf/apps/",           // 애플리케이션 파일들
+    "/cf/download/",       // 다운로드된 파일들
+    "/cf/upload/",         // 업로드할 파일들
+    "/cf/log/",            // 로그 파일들
+    "/cf/tmp/",            // 임시 파일들
+    "/ram/",               // RAM 디스크
+    "/rom/",               // ROM 파일 시스템
+    "/vol/",               // 볼륨 마운트 포인트
+    "/data/tables/",       // 테이블 파일들
+    "/data/scripts/",      // 스크립트 파일들
+    "/data/config/",       // 설정 파일들
+    "/mission/apps/",      // 미션 특화 앱들
+    "/mission/data/",      // 미션 데이터
+    "/platform/boot/",     // 부트 파일들
+    "/platform/config/"    // 플랫폼 설정
+};
+
+// 기본 메모리 맵
+static const CFS_MemoryRegion_t mission_default_regions[] = {
+    // RAM 영역들
+    {0x20000000, 0x2007FFFF, MM_RAM, "SRAM_MAIN", TRUE, TRUE},
+    {0x20080000, 0x200FFFFF, MM_RAM, "SRAM_BACKUP", TRUE, FALSE},
+    {0x60000000, 0x67FFFFFF, MM_RAM, "SDRAM_EXTERNAL", TRUE, TRUE},
+
+    // EEPROM 영역들
+    {0x08080000, 0x080FFFFF, MM_EEPROM, "EEPROM_CONFIG", TRUE, FALSE},
+    {0x08100000, 0x081FFFFF, MM_EEPROM, "EEPROM_DATA", TRUE, FALSE},
+
+    // ROM/FLASH 영역들 (읽기 전용)
+    {0x08000000, 0x0807FFFF, 3, "FLASH_BOOT", FALSE, TRUE},
+    {0x08200000, 0x087FFFFF, 3, "FLASH_APP", FALSE, TRUE},
+};
+
+#define MISSION_COUNT(table)    (sizeof(table) / sizeof((table)[0]))
+#define MISSION_ALIGN(n)        (((n) + 7) & ~(size_t)7)
+
+// 영역의 시작과 끝 + 1 이 페이지 경계인지
+static boolean Mission_RegionAligned(const CFS_MemoryRegion_t *r) {
+    const uint64_t mask = CFS_MISSION_REGION_ALIGN - 1;
+    return (r->start_addr & mask) == 0 && ((r->end_addr + 1) & mask) == 0;
+}
+
+const CFS_Mission_t *cfs_mission_active = NULL;
+
+static pthread_once_t g_mission_once = PTHREAD_ONCE_INIT;
+static CFS_Mission_t *g_mission_default = NULL;
+static CFS_Mission_t *g_mission_loaded = NULL;
+
+// 아레나를 만들 원본 표 (읽는 동안에는 파일 버퍼를 가리킨다)
+typedef struct {
+    const char               *name;
+    const char *const        *symbols;
+    const uint64_t           *addresses;       // NULL 이면 모두 미지정
+    uint32_t                  symbol_count;
+    const char *const        *paths;
+    uint32_t                  path_count;
+    const CFS_MemoryRegion_t *regions;
+    uint32_t                  region_count;
+} MissionSource_t;
+
+static uint64_t Mission_NowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int Mission_CompareRegions(const void *a, const void *b) {
+    const CFS_MemoryRegion_t *ra = (const CFS_MemoryRegion_t *)a;
+    const CFS_MemoryRegion_t *rb = (const CFS_MemoryRegion_t *)b;
+    return (ra->start_addr > rb->start_addr) - (ra->start_addr < rb->start_addr);
+}
+
+static uint32_t Mission_PathKey(const char *path) {
+    return path[0] != '\0' && path[1] != '\0' ? (uint8_t)path[1] : 256;
+}
+
+/*
+ * 원본 표로 아레나 만들기
+ * 영역은 정렬해서 복사하고 겹치면 NULL 을 반환한다.
+ */
+static CFS_Mission_t* Mission_Build(const MissionSource_t *src) {
+    uint64_t start_ns = Mission_NowNs();
+
+    uint32_t index_size = 2;
+    while (index_size < src->symbol_count * 2) {
+        index_size <<= 1;
+    }
+
+    size_t string_bytes = 0;
+    for (uint32_t i = 0; i < src->symbol_count; i++) {
+        string_bytes += strlen(src->symbols[i]) + 1;
+    }
+    for (uint32_t i = 0; i < src->path_count; i++) {
+        string_bytes += strlen(src->paths[i]) + 1;
+    }
+
+    size_t off_regions = MISSION_ALIGN(sizeof(CFS_Mission_t));
+    size_t off_addresses = MISSION_ALIGN(off_regions + src->region_count * sizeof(CFS_MemoryRegion_t));
+    size_t off_symbols = off_addresses + src->symbol_count * sizeof(uint64_t);
+    size_t off_paths = off_symbols + src->symbol_count * sizeof(char *);
+    size_t off_index = off_paths + src->path_count * sizeof(char *);
+    size_t off_lengths = off_index + index_size * sizeof(uint32_t);
+    size_t off_order = off_lengths + src->path_count * sizeof(uint16_t);
+    size_t off_strings = off_order + src->path_count * sizeof(uint16_t);
+    size_t total = off_strings + string_bytes;
+
+    uint8_t *arena = calloc(1, total);
+    if (!arena) {
+        return NULL;
+    }
+
+    CFS_Mission_t *m = (CFS_Mission_t *)arena;
+    CFS_MemoryRegion_t *regions = (CFS_MemoryRegion_t *)(arena + off_regions);
+    uint64_t *addresses = (uint64_t *)(arena + off_addresses);
+    const char **symbols = (const char **)(arena + off_symbols);
+    const char **paths = (const char **)(arena + off_paths);
+    uint32_t *index = (uint32_t *)(arena + off_index);
+    uint16_t *lengths = (uint16_t *)(arena + off_lengths);
+    uint16_t *order = (uint16_t *)(arena + off_order);
+    char *strings = (char *)(arena + off_strings);
+
+    snprintf(m->name, sizeof(m->name), "%s", src->name);
+    m->symbol_count = src->symbol_count;
+    m->path_count = src->path_count;
+    m->region_count = src->region_count;
+
+    // 영역: 시작 주소 순, 겹침/비정렬 거부
+    memcpy(regions, src->regions, src->region_count * sizeof(CFS_MemoryRegion_t));
+    qsort(regions, src->region_count, sizeof(CFS_MemoryRegion_t), Mission_CompareRegions);
+    for (uint32_t i = 0; i < src->region_count; i++) {
+        if (regions[i].end_addr < regions[i].start_addr ||
+            (i > 0 && regions[i].start_addr <= regions[i - 1].end_addr)) {
+            fprintf(stderr, "Mission %s: region %s overlaps or is empty\n", m->name, regions[i].name);
+            free(arena);
+            return NULL;
+        }
+        if (!Mission_RegionAligned(&regions[i])) {
+            fprintf(stderr, "Mission %s: region %s is not %u-byte aligned\n",
+                    m->name, regions[i].name, CFS_MISSION_REGION_ALIGN);
+            free(arena);
+            return NULL;
+        }
+    }
+
+    // 심볼: 문자열 복사 + 해시 색인
+    char *cursor = strings;
+    for (uint32_t i = 0; i < src->symbol_count; i++) {
+        size_t len = strlen(src->symbols[i]);
+        memcpy(cursor, src->symbols[i], len + 1);
+        symbols[i] = cursor;
+        cursor += len + 1;
+
+        addresses[i] = src->addresses ? src->addresses[i] : CFS_MISSION_NO_ADDRESS;
+        if (addresses[i] != CFS_MISSION_NO_ADDRESS) {
+            m->has_addresses = TRUE;
+        }
+
+        uint32_t slot = (uint32_t)CFS_SymCache_Hash(symbols[i], NULL) & (index_size - 1);
+        while (index[slot] != 0) {
+            slot = (slot + 1) & (index_size - 1);
+        }
+        index[slot] = i + 1;
+    }
+
+    // 경로: 문자열 복사 + 두 번째 바이트별 구간 (계수 정렬)
+    for (uint32_t i = 0; i < src->path_count; i++) {
+        size_t len = strlen(src->paths[i]);
+        memcpy(cursor, src->paths[i], len + 1);
+        paths[i] = cursor;
+        lengths[i] = (uint16_t)len;
+        cursor += len + 1;
+        m->path_bucket[Mission_PathKey(paths[i]) + 1]++;
+    }
+    for (uint32_t k = 1; k < 258; k++) {
+        m->path_bucket[k] += m->path_bucket[k - 1];
+    }
+    uint32_t fill[257];
+    memcpy(fill, m->path_bucket, sizeof(fill));
+    for (uint32_t i = 0; i < src->path_count; i++) {
+        order[fill[Mission_PathKey(paths[i])]++] = (uint16_t)i;
+    }
+
+    m->symbols = symbols;
+    m->symbol_addresses = addresses;
+    m->symbol_index = index;
+    m->symbol_index_mask = index_size - 1;
+    m->paths = paths;
+    m->path_lengths = lengths;
+    m->path_order = order;
+    m->regions = regions;
+    m->arena_bytes = total;
+    m->build_ns = Mission_NowNs() - start_ns;
+    return m;
+}
+
+static void Mission_BuildDefault(void) {
+    const MissionSource_t src = {
+        .name = "default",
+        .symbols = mission_default_symbols,
+        .symbol_count = MISSION_COUNT(mission_default_symbols),
+        .paths = mission_default_paths,
+        .path_count = MISSION_COUNT(mission_default_paths),
+        .regions = mission_default_regions,
+        .region_count = MISSION_COUNT(mission_default_regions),
+    };
+
+    g_mission_default = Mission_Build(&src);
+    if (!g_mission_default) {
+        fprintf(stderr, "Failed to build default mission tables\n");
+        abort();
+    }
+
+    const CFS_Mission_t *expected = NULL;
+    __atomic_compare_exchange_n(&cfs_mission_active, &expected, g_mission_default, FALSE,
+                                __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+}
+
+const CFS_Mission_t* CFS_Mission_Default(void) {
+    pthread_once(&g_mission_once, Mission_BuildDefault);
+    return g_mission_default;
+}
+
+static boolean Mission_ParseU64(const char *text, uint64_t *value) {
+    char *end;
+    if (!text) {
+        return FALSE;
+    }
+    *value = strtoull(text, &end, 0);
+    return end != text && *end == '\0';
+}
+
+static boolean Mission_ParseMemType(const char *text, uint8_t *mem_type) {
+    static const struct { const char *name; uint8_t type; } types[] = {
+        { "ram", MM_RAM }, { "eeprom", MM_EEPROM }, { "flash", 3 }, { "io", 4 },
+    };
+    uint64_t value;
+
+    for (size_t i = 0; i < MISSION_COUNT(types); i++) {
+        if (text && strcmp(text, types[i].name) == 0) {
+            *mem_type = types[i].type;
+            return TRUE;
+        }
+    }
+    if (Mission_ParseU64(text, &value) && value > 0 && value <= 0xFF) {
+        *mem_type = (uint8_t)value;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+// 공백으로 나눈 토큰 (제자리에서 NUL 종료)
+static int Mission_Tokenize(char *line, char **tokens, int max_tokens) {
+    int count = 0;
+    char *p = line;
+
+    while (*p != '\0' && count < max_tokens) {
+        while (*p == ' ' || *p == '\t' || *p == '\r') {
+            p++;
+        }
+        if (*p == '\0' || *p == '#') {
+            break;
+        }
+        tokens[count++] = p;
+        while (*p != '\0' && *p != ' ' && *p != '\t' && *p != '\r' && *p != '#') {
+            p++;
+        }
+        if (*p == '#') {
+            *p = '\0';
+            break;
+        }
+        if (*p != '\0') {
+            *p++ = '\0';
+        }
+    }
+    return count;
+}
+
+/*
+ * 미션 파일 읽기
+ */
+int32_t CFS_Mission_Load(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "Cannot open mission file: %s\n", path);
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long file_size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *text = (file_size >= 0) ? malloc((size_t)file_size + 1) : NULL;
+    if (!text || fread(text, 1, (size_t)file_size, f) != (size_t)file_size) {
+        fprintf(stderr, "Cannot read mission file: %s\n", path);
+        free(text);
+        fclose(f);
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+    fclose(f);
+    text[file_size] = '\0';
+
+    // 줄 수가 항목 수의 상한
+    size_t max_entries = 1;
+    for (long i = 0; i < file_size; i++) {
+        max_entries += (text[i] == '\n');
+    }
+
+    const char **symbols = malloc(max_entries * sizeof(char *));
+    uint64_t *addresses = malloc(max_entries * sizeof(uint64_t));
+    const char **paths = malloc(max_entries * sizeof(char *));
+    CFS_MemoryRegion_t *regions = calloc(max_entries, sizeof(CFS_MemoryRegion_t));
+    MissionSource_t src = {
+        .name = "unnamed",
+        .symbols = symbols,
+        .addresses = addresses,
+        .paths = paths,
+        .regions = regions,
+    };
+    int32_t status = CFE_SUCCESS;
+    uint32_t line_no = 0;
+
+    if (!symbols || !addresses || !paths || !regions) {
+        status = CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+
+    char *line = text;
+    while (status == CFE_SUCCESS && line) {
+        char *next = strchr(line, '\n');
+        if (next) {
+            *next++ = '\0';
+        }
+        line_no++;
+
+        char *tok[8];
+        int n = Mission_Tokenize(line, tok, 8);
+        line = next;
+        if (n == 0) {
+            continue;
+        }
+
+        boolean ok = FALSE;
+        if (strcmp(tok[0], "mission") == 0 && n == 2) {
+            src.name = tok[1];
+            ok = TRUE;
+        } else if (strcmp(tok[0], "symbol") == 0 && (n == 2 || n == 3) &&
+                   strlen(tok[1]) < OS_MAX_API_NAME && src.symbol_count < CFS_MISSION_MAX_SYMBOLS) {
+            addresses[src.symbol_count] = CFS_MISSION_NO_ADDRESS;
+            ok = (n == 2) || Mission_ParseU64(tok[2], &addresses[src.symbol_count]);
+            symbols[src.symbol_count++] = tok[1];
+        } else if (strcmp(tok[0], "path") == 0 && n == 2 && tok[1][0] == '/' &&
+                   strlen(tok[1]) < OS_MAX_PATH_LEN && src.path_count < CFS_MISSION_MAX_PATHS) {
+            paths[src.path_count++] = tok[1];
+            ok = TRUE;
+        } else if (strcmp(tok[0], "region") == 0 && n >= 5 &&
+                   strlen(tok[1]) < sizeof(regions[0].name) && src.region_count < CFS_MISSION_MAX_REGIONS) {
+            CFS_MemoryRegion_t *r = &regions[src.region_count++];
+            snprintf(r->name, sizeof(r->name), "%s", tok[1]);
+            r->writable = TRUE;
+            ok = Mission_ParseU64(tok[2], &r->start_addr) &&
+                 Mission_ParseU64(tok[3], &r->end_addr) &&
+                 Mission_ParseMemType(tok[4], &r->mem_type);
+            for (int i = 5; ok && i < n; i++) {
+                if (strcmp(tok[i], "ro") == 0) {
+                    r->writable = FALSE;
+                } else if (strcmp(tok[i], "x") == 0) {
+                    r->executable = TRUE;
+                } else if (strcmp(tok[i], "rw") != 0) {
+                    ok = FALSE;
+                }
+            }
+            if (ok && !Mission_RegionAligned(r)) {
+                fprintf(stderr, "%s:%u: region %s start and end + 1 must be %u-byte aligned\n",
+                        path, line_no, r->name, CFS_MISSION_REGION_ALIGN);
+                status = CFS_MM_ERROR_INVALID_FILE;
+                continue;
+            }
+        }
+
+        if (!ok) {
+            fprintf(stderr, "%s:%u: invalid mission entry '%s'\n", path, line_no, tok[0]);
+            status = CFS_MM_ERROR_INVALID_FILE;
+        }
+    }
+
+    if (status == CFE_SUCCESS &&
+        (src.symbol_count == 0 || src.path_count == 0 || src.region_count == 0)) {
+        fprintf(stderr, "%s: mission needs at least one symbol, path and region\n", path);
+        status = CFS_MM_ERROR_INVALID_FILE;
+    }
+
+    CFS_Mission_t *mission = NULL;
+    if (status == CFE_SUCCESS) {
+        mission = Mission_Build(&src);
+        if (!mission) {
+            status = CFS_MM_ERROR_INVALID_FILE;
+        }
+    }
+
+    free(symbols);
+    free(addresses);
+    free(paths);
+    free(regions);
+    free(text);
+
+    if (mission) {
+        // 이전에 읽은 미션은 워커가 시작되기 전이므로 바로 해제
+        (void)CFS_Mission_Default();
+        __atomic_store_n(&cfs_mission_active, mission, __ATOMIC_RELEASE);
+        free(g_mission_loaded);
+        g_mission_loaded = mission;
+        // 심볼 테이블이 바뀌었으므로 이전 미션으로 해석한 결과는 버린다
+        CFS_SymCache_Invalidate();
+    }
+    return status;
+}
+
+void CFS_Mission_ConfigureFromEnv(void) {
+    const char *path = getenv("CFS_MISSION");
+    if (path && path[0] != '\0') {
+        if (CFS_Mission_Load(path) != CFE_SUCCESS) {
+            exit(2);
+        }
+        CFS_Mission_Print();
+    }
+}
+
+/*
+ * 시작 주소가 addr 이하인 마지막 영역 (없으면 -1)
+ */
+static int Mission_RegionAtOrBelow(const CFS_Mission_t *m, uint64_t addr) {
+    int lo = 0;
+    int hi = (int)m->region_count - 1;
+    int found = -1;
+
+    while (lo <= hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (m->regions[mid].start_addr <= addr) {
+            found = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return found;
+}
+
+int CFS_Mission_FindRegion(uint64_t addr, uint32_t size) {
+    const CFS_Mission_t *m = CFS_Mission_Get();
+
+    if (size == 0) {
+        return -1;
+    }
+
+    int index = Mission_RegionAtOrBelow(m, addr);
+    if (index >= 0) {
+        const CFS_MemoryRegion_t *region = &m->regions[index];
+        if (addr <= region->end_addr && (uint64_t)size - 1 <= region->end_addr - addr) {
+            return index;
+        }
+    }
+    return -1;
+}
+
+const CFS_MemoryRegion_t* CFS_Mission_MatchRegion(uint64_t addr, uint8_t mem_type, uint32_t size) {
+    const CFS_Mission_t *m = CFS_Mission_Get();
+    uint64_t last = addr + size - 1;
+
+    // size 0 이나 주소 넘침은 기존 비교식 그대로 전체 탐색
+    if (size == 0 || last < addr) {
+        for (uint32_t i = 0; i < m->region_count; i++) {
+            const CFS_MemoryRegion_t *region = &m->regions[i];
+            if (region->mem_type == mem_type && addr >= region->start_addr && last <= region->end_addr) {
+                return region;
+            }
+        }
+        return NULL;
+    }
+
+    int index = Mission_RegionAtOrBelow(m, addr);
+    if (index >= 0) {
+        const CFS_MemoryRegion_t *region = &m->regions[index];
+        if (region->mem_type == mem_type && last <= region->end_addr) {
+            return region;
+        }
+    }
+    return NULL;
+}
+
+boolean CFS_Mission_PathAllowed(const char *file_name) {
+    const CFS_Mission_t *m = CFS_Mission_Get();
+    uint32_t key = Mission_PathKey(file_name);
+
+    // 같은 두 번째 바이트로 시작하는 경로와 한 글자 경로만 비교
+    for (uint32_t pass = 0; pass < 2; pass++) {
+        uint32_t bucket = pass == 0 ? key : 256;
+        if (pass == 1 && key == 256) {
+            break;
+        }
+        for (uint32_t i = m->path_bucket[bucket]; i < m->path_bucket[bucket + 1]; i++) {
+            uint16_t p = m->path_order[i];
+            if (strncmp(file_name, m->paths[p], m->path_lengths[p]) == 0) {
+                return TRUE;
+            }
+        }
+    }
+    return FALSE;
+}
+
+/*
+ * 미션 파일에 주소가 지정된 심볼 조회 (OS_SymbolLookup mock 에서 사용)
+ */
+int32_t CFS_Mission_SymbolAddress(const char *name, uint64_t *address) {
+    const CFS_Mission_t *m = CFS_Mission_Get();
+    if (!m->has_addresses) {
+        return OS_ERROR;
+    }
+
+    uint32_t slot = (uint32_t)CFS_SymCache_Hash(name, NULL) & m->symbol_index_mask;
+    while (m->symbol_index[slot] != 0) {
+        uint32_t i = m->symbol_index[slot] - 1;
+        if (strncmp(m->symbols[i], name, OS_MAX_API_NAME) == 0) {
+            if (m->symbol_addresses[i] == CFS_MISSION_NO_ADDRESS) {
+                return OS_ERROR;
+            }
+            *address = m->symbol_addresses[i];
+            return OS_SUCCESS;
+        }
+        slot = (slot + 1) & m->symbol_index_mask;
+    }
+    return OS_ERROR;
+}
+
+void CFS_Mission_Print(void) {
+    const CFS_Mission_t *m = CFS_Mission_Get();
+    printf("Mission: %s (%u symbols, %u paths, %u regions, %zu byte arena, built in %.1f us)\n",
+           m->name, m->symbol_count, m->path_count, m->region_count,
+           m->arena_bytes, m->build_ns / 1000.0);
+}
+
+/*
+ * cfs_config.h 의 표 조회 함수들 (현재 미션 기준)
+ */
+boolean CFS_IsValidMemoryAddress(uint64_t addr, uint8_t mem_type, uint32_t size) {
+    return CFS_Mission_MatchRegion(addr, mem_type, size) != NULL;
+}
+
+const char* CFS_GetRandomSymbol(uint8_t seed) {
+    const CFS_Mission_t *m = CFS_Mission_Get();
+    return m->symbols[seed % m->symbol_count];
+}
+
+const char* CFS_GetRandomPath(uint8_t seed) {
+    const CFS_Mission_t *m = CFS_Mission_Get();
+    return m->paths[seed % m->path_count];
+}
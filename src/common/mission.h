@@ -0,0 +1,91 @@
+/*
+ * CFS 미션 프로파일 헤더
+ * 심볼/경로/메모리 영역 표와 조회 색인을 실행 시간에 연속된 아레나 하나로 만든다.
+ * 미션 파일이 없으면 기본 표 (시뮬레이션 환경) 로 같은 아레나를 만든다.
+ *
+ * 미션 파일 (텍스트, 한 줄에 항목 하나, '#' 뒤는 주석)
+ *   mission <이름>
+ *   symbol  <이름> [주소]        주소가 있으면 OS_SymbolLookup 이 그 주소를 돌려준다
+ *   path    <허용 접두 경로>
+ *   region  <이름> <시작> <끝> <ram|eeprom|flash|io|번호> [rw|ro] [x]
+ * symbol/path 는 파일 순서를 유지한다 (입력 디코더가 번호로 고르므로).
+ * region 은 시작 주소 순으로 정렬되며 서로 겹칠 수 없다. 시작 주소와 끝 + 1 은
+ * CFS_MISSION_REGION_ALIGN (4KB) 의 배수여야 한다 (시뮬레이션 메모리가 페이지 단위로 추적).
+ * 심볼/경로가 256 개를 넘으면 디코더의 선택 필드가 2 바이트가 된다 (CFS_Input_Index).
+ *
+ * 환경 변수
+ *   CFS_MISSION=FILE      하니스 초기화 시 읽을 미션 파일
+ */
+
+#ifndef CFS_MISSION_H
+#define CFS_MISSION_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+#define CFS_MISSION_NAME_LEN        32
+#define CFS_MISSION_MAX_SYMBOLS     65535
+#define CFS_MISSION_MAX_PATHS       65535
+
+// 시뮬레이션 메모리의 영역별 상태 배열 크기
+#define CFS_MISSION_MAX_REGIONS     64
+
+// 영역 시작/끝 + 1 정렬 (sim_mem.c 의 페이지 비트맵 단위)
+#define CFS_MISSION_REGION_ALIGN    4096
+
+// symbol_addresses 에서 주소가 지정되지 않은 심볼
+#define CFS_MISSION_NO_ADDRESS      UINT64_MAX
+
+// 미션 표 (아레나 앞머리, 모든 포인터는 같은 아레나 안을 가리킨다)
+typedef struct {
+    char                      name[CFS_MISSION_NAME_LEN];
+    uint32_t                  symbol_count;
+    uint32_t                  path_count;
+    uint32_t                  region_count;
+    boolean                   has_addresses;    // 주소가 지정된 심볼이 하나라도 있는지
+    const char *const        *symbols;          // 파일 순서
+    const uint64_t           *symbol_addresses;
+    const uint32_t           *symbol_index;     // 이름 해시 → 심볼 번호 + 1 (0 = 빈 칸)
+    uint32_t                  symbol_index_mask;
+    const char *const        *paths;            // 파일 순서
+    const uint16_t           *path_lengths;
+    const uint16_t           *path_order;       // path[1] 바이트로 묶은 경로 번호
+    uint32_t                  path_bucket[258]; // path[1] 바이트별 path_order 구간 (256 = 한 글자 경로)
+    const CFS_MemoryRegion_t *regions;          // 시작 주소 순
+    size_t                    arena_bytes;
+    uint64_t                  build_ns;
+} CFS_Mission_t;
+
+extern const CFS_Mission_t *cfs_mission_active;
+
+// 기본 표로 만든 미션 (처음 호출 시 한 번 만든다)
+const CFS_Mission_t* CFS_Mission_Default(void);
+
+// 현재 미션
+static inline const CFS_Mission_t* CFS_Mission_Get(void) {
+    const CFS_Mission_t *mission = __atomic_load_n(&cfs_mission_active, __ATOMIC_ACQUIRE);
+    return mission ? mission : CFS_Mission_Default();
+}
+
+/*
+ * 미션 파일을 읽어 현재 미션으로 교체
+ * 워커 스레드가 표를 쓰기 전 (하니스 초기화) 에만 호출한다.
+ * 반환값: CFE_SUCCESS, CFS_MM_ERROR_FILE_ACCESS, CFS_MM_ERROR_INVALID_FILE (줄 번호는 stderr)
+ */
+int32_t CFS_Mission_Load(const char *path);
+
+// CFS_MISSION 이 있으면 읽는다 (실패 시 메시지 출력 후 종료)
+void CFS_Mission_ConfigureFromEnv(void);
+
+// [addr, addr + size) 를 모두 포함하는 영역 번호 (없거나 size 0 이면 -1)
+int CFS_Mission_FindRegion(uint64_t addr, uint32_t size);
+
+// mem_type 이 같고 addr..addr + size - 1 을 포함하는 영역 (없으면 NULL)
+const CFS_MemoryRegion_t* CFS_Mission_MatchRegion(uint64_t addr, uint8_t mem_type, uint32_t size);
+
+// 파일 이름이 허용된 경로 중 하나로 시작하는지
+boolean CFS_Mission_PathAllowed(const char *file_name);
+
+void CFS_Mission_Print(void);
+
+#endif // CFS_MISSION_H
@@ -47,6 +47,17 @@ typedef struct {
     char                    FileName[OS_MAX_PATH_LEN]; // 목적지 파일 이름
 } MM_DumpMemToFileCmd_t;
 
+// MM 로드/덤프 파일 보조 헤더 (cFE 파일 헤더 바로 뒤, 호스트 바이트 순서)
+typedef struct {
+    uint32                  MemType;       // 메모리 타입
+    uint32                  NumOfBytes;    // 데이터 바이트 수
+    uint32                  Crc;           // 데이터 CRC32
+    MM_SymAddr_t            SymAddress;    // 덤프한 심볼 주소
+} MM_LoadDumpFileHeader_t;
+
+#define MM_CFE_HDR_SUBTYPE              0x4D4D5354  // 'MMST'
+#define MM_CFE_HDR_DESCRIPTION          "Memory Dump"
+
 // MM Peek 명령 구조체
 typedef struct {
     CFE_MSG_CommandHeader_t CmdHeader;     // 표준 cFE 명령 헤더
@@ -134,6 +145,10 @@ typedef struct {
 #define MM_FILENAME_ERR_EID             70
 #define MM_FILESIZE_ERR_EID             71
 #define MM_FILE_ACCESS_ERR_EID          72
+#define MM_EEPROM_WRITE_ENA_INF_EID     80
+#define MM_EEPROM_WRITE_ENA_ERR_EID     81
+#define MM_EEPROM_WRITE_DIS_INF_EID     82
+#define MM_EEPROM_WRITE_DIS_ERR_EID     83
 
 // MM 액션 타입 정의
 #define MM_NOACTION                     0
@@ -143,6 +158,8 @@ typedef struct {
 #define MM_DUMP_TO_FILE                 4
 #define MM_FILL                         5
 #define MM_LOOKUP_SYM                   6
+#define MM_EEPROMWRITE_ENA              7
+#define MM_EEPROMWRITE_DIS              8
 
 // 유틸리티 매크로들
 #define MM_CMD_HEADER_SIZE              sizeof(CFE_MSG_CommandHeader_t)
@@ -175,7 +192,7 @@ typedef struct {
     uint32_t max_eeprom_dump_size;
     uint32_t max_fill_size;
     boolean  enable_crc_check;
-    boolean  enable_eeprom_write;
+    boolean  enable_eeprom_write;      // 시퀀스 시작 시 EEPROM 뱅크 쓰기 허용 (단일 명령 입력은 항상 허용)
     MM_CRC_Function_t crc_function;
     MM_FileLoadCallback_t file_load_callback;
     MM_FileDumpCallback_t file_dump_callback;
@@ -184,12 +201,18 @@ typedef struct {
 // 기본 MM 설정
 extern const MM_Config_t MM_DefaultConfig;
 
+// MM 앱 상태 (HK 텔레메트리 원본, 스레드별)
+extern CFS_THREAD_LOCAL MM_AppData_t MM_AppData;
+void MM_ResetAppData(void);
+
 // MM 유틸리티 함수 프로토타입
 int32_t MM_ResolveSymAddr(MM_SymAddr_t *SymAddr, uint64_t *ResolvedAddr);
+int32_t MM_ResolveSymAddrHashed(MM_SymAddr_t *SymAddr, uint64_t NameHash, uint64_t *ResolvedAddr);
 int32_t MM_VerifyMemType(uint8_t MemType);
 int32_t MM_VerifyDataSize(uint8_t DataSize);
 int32_t MM_VerifyFileName(const char *FileName);
 int32_t MM_CalculateCRC(const void *data, size_t length, uint32_t *crc);
+uint32_t MM_CalculateCRC32(const void *data, size_t length, uint32_t initial_crc);
 boolean MM_IsValidAlignment(uint64_t addr, uint8_t data_size);
 
 #endif // MM_TYPES_H
\ No newline at end of file
@@ -0,0 +1,503 @@
+/*
+ * CFS Mock 호출 기록/재생
+ *
+ * 기록 모드: 호출마다 [종류][값...] 을 스레드별 고정 버퍼 끝에 덧붙인다.
+ *   값은 zigzag varint 라 상태 코드/크기 같은 작은 값은 1~2 바이트이고,
+ *   버퍼가 차면 뒤 호출은 버리고 잘림만 표시한다 (입력 실행을 막지 않음).
+ * 재생 모드: 기록 파일을 미리 풀어 둔 표를 스레드별 위치로 따라가며,
+ *   종류나 입력 값이 다르면 그 지점을 한 번 보고하고 나머지는 실제 Mock 으로 실행한다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "mock_trace.h"
+#include "mission.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define MOCK_TRACE_MAGIC        "CFSMTRC1"
+#define MOCK_TRACE_MAGIC_LEN    8
+#define MOCK_TRACE_MAX_IN       4
+#define MOCK_TRACE_MAX_OUT      3
+#define MOCK_TRACE_VARINT_MAX   10
+#define MOCK_TRACE_HEADER_MAX   (MOCK_TRACE_MAGIC_LEN + CFS_MISSION_NAME_LEN + 7 * MOCK_TRACE_VARINT_MAX)
+
+typedef enum {
+    MOCK_TRACE_OFF = 0,
+    MOCK_TRACE_RECORD,
+    MOCK_TRACE_REPLAY
+} MockTraceMode_t;
+
+// 종류별 값 수 (CFS_MockTraceKind_t 순서)
+typedef struct {
+    const char *name;
+    uint8_t     in;
+    uint8_t     out;
+} MockTraceKindInfo_t;
+
+static const MockTraceKindInfo_t g_mock_trace_kinds[CFS_MOCK_TRACE_KIND_COUNT] = {
+    [CFS_MOCK_TRACE_SYMBOL]       = { "symbol",       1, 2 },
+    [CFS_MOCK_TRACE_REGION]       = { "region",       4, 1 },
+    [CFS_MOCK_TRACE_MEM_VALIDATE] = { "mem_validate", 3, 1 },
+    [CFS_MOCK_TRACE_SB_RECEIVE]   = { "sb_receive",   2, 1 },
+    [CFS_MOCK_TRACE_TIME]         = { "time",         0, 2 },
+    [CFS_MOCK_TRACE_DELAY]        = { "delay",        1, 0 },
+    [CFS_MOCK_TRACE_EVENT]        = { "event",        2, 0 },
+    [CFS_MOCK_TRACE_FILE_READ]    = { "file_read",    1, 3 },
+};
+
+// 재생용으로 풀어 둔 기록 하나
+typedef struct {
+    uint8_t kind;
+    int64_t in[MOCK_TRACE_MAX_IN];
+    int64_t out[MOCK_TRACE_MAX_OUT];
+} MockTraceEntry_t;
+
+typedef struct {
+    MockTraceMode_t   mode;
+    const char       *prefix;
+    MockTraceEntry_t *entries;          // 재생 모드
+    uint32_t          entry_count;
+    uint64_t          input_size;       // 기록된 입력
+    uint64_t          input_hash;
+    char              mission[CFS_MISSION_NAME_LEN];
+} MockTraceConfig_t;
+
+typedef struct {
+    uint8_t       *buffer;
+    uint32_t       used;
+    uint32_t       records;
+    boolean        truncated;
+    boolean        flushed;
+    const uint8_t *data;                // 실행 중인 입력 (크래시 때 해시)
+    size_t         size;
+    uint32_t       cursor;              // 재생 위치
+    boolean        diverged;
+} MockTrace_t;
+
+struct CFS_MockTraceMark {
+    uint32_t used;
+    uint32_t records;
+    uint32_t cursor;
+    boolean  truncated;
+    boolean  diverged;
+    uint8_t  bytes[];
+};
+
+static MockTraceConfig_t g_mock_trace = { MOCK_TRACE_OFF, "", NULL, 0, 0, 0, "" };
+static CFS_THREAD_LOCAL MockTrace_t t_mock_trace;
+
+/*
+ * varint 인코딩 (zigzag + LEB128)
+ */
+static uint32_t MockTrace_PutVarint(uint8_t *out, int64_t value) {
+    uint64_t v = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+    uint32_t n = 0;
+    while (v >= 0x80) {
+        out[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+static boolean MockTrace_GetVarint(const uint8_t *data, size_t size, size_t *pos, int64_t *value) {
+    uint64_t v = 0;
+    for (uint32_t shift = 0; shift < 64 && *pos < size; shift += 7) {
+        uint8_t b = data[(*pos)++];
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            *value = (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static uint64_t MockTrace_Hash(const uint8_t *data, size_t size) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+int64_t CFS_MockTrace_Fingerprint(const void *data, size_t size) {
+    return (int64_t)(uint32_t)MockTrace_Hash((const uint8_t *)data, size);
+}
+
+/*
+ * 재생 파일 읽기
+ */
+static int32_t MockTrace_Load(const char *path) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+    fseek(fp, 0, SEEK_END);
+    long length = ftell(fp);
+    rewind(fp);
+    uint8_t *data = (length > 0) ? malloc((size_t)length) : NULL;
+    size_t size = data ? fread(data, 1, (size_t)length, fp) : 0;
+    fclose(fp);
+
+    size_t pos = MOCK_TRACE_MAGIC_LEN;
+    int64_t name_len = 0, input_size = 0, input_hash = 0, count = 0, truncated = 0, bytes = 0;
+    boolean ok = data && size >= MOCK_TRACE_MAGIC_LEN &&
+                 memcmp(data, MOCK_TRACE_MAGIC, MOCK_TRACE_MAGIC_LEN) == 0 &&
+                 MockTrace_GetVarint(data, size, &pos, &name_len) &&
+                 name_len >= 0 && name_len < CFS_MISSION_NAME_LEN && pos + (size_t)name_len <= size;
+    if (ok) {
+        memcpy(g_mock_trace.mission, data + pos, (size_t)name_len);
+        g_mock_trace.mission[name_len] = '\0';
+        pos += (size_t)name_len;
+        ok = MockTrace_GetVarint(data, size, &pos, &input_size) &&
+             MockTrace_GetVarint(data, size, &pos, &input_hash) &&
+             MockTrace_GetVarint(data, size, &pos, &count) &&
+             MockTrace_GetVarint(data, size, &pos, &truncated) &&
+             MockTrace_GetVarint(data, size, &pos, &bytes) &&
+             count >= 0 && count <= bytes && bytes >= 0 && pos + (size_t)bytes <= size;
+    }
+
+    MockTraceEntry_t *entries = ok ? calloc(count ? (size_t)count : 1, sizeof(MockTraceEntry_t)) : NULL;
+    for (int64_t i = 0; entries && i < count; i++) {
+        MockTraceEntry_t *e = &entries[i];
+        e->kind = (pos < size) ? data[pos++] : 0;
+        if (e->kind == 0 || e->kind >= CFS_MOCK_TRACE_KIND_COUNT) {
+            ok = FALSE;
+            break;
+        }
+        for (uint32_t k = 0; ok && k < g_mock_trace_kinds[e->kind].in; k++) {
+            ok = MockTrace_GetVarint(data, size, &pos, &e->in[k]);
+        }
+        for (uint32_t k = 0; ok && k < g_mock_trace_kinds[e->kind].out; k++) {
+            ok = MockTrace_GetVarint(data, size, &pos, &e->out[k]);
+        }
+    }
+    free(data);
+
+    if (!ok || !entries) {
+        free(entries);
+        return CFS_MM_ERROR_INVALID_FILE;
+    }
+
+    free(g_mock_trace.entries);
+    g_mock_trace.entries = entries;
+    g_mock_trace.entry_count = (uint32_t)count;
+    g_mock_trace.input_size = (uint64_t)input_size;
+    g_mock_trace.input_hash = (uint64_t)input_hash;
+
+    const char *current = CFS_Mission_Get()->name;
+    printf("Mock trace: %u records%s (mission %s, input %lu bytes, hash %016lx)\n",
+           g_mock_trace.entry_count, truncated ? ", truncated" : "", g_mock_trace.mission,
+           (unsigned long)g_mock_trace.input_size, (unsigned long)g_mock_trace.input_hash);
+    if (strcmp(current, g_mock_trace.mission) != 0) {
+        printf("Mock trace: recorded under mission %s, running under %s "
+               "(symbol/region results come from the trace)\n", g_mock_trace.mission, current);
+    }
+    return CFE_SUCCESS;
+}
+
+int32_t CFS_MockTrace_ConfigureFromEnv(boolean default_record) {
+    const char *record = getenv("CFS_MOCK_TRACE");
+    const char *prefix = getenv("CFS_MOCK_TRACE_PREFIX");
+    const char *replay = getenv("CFS_MOCK_TRACE_REPLAY");
+
+    g_mock_trace.prefix = prefix ? prefix : "";
+    if (replay && replay[0] != '\0') {
+        int32_t status = MockTrace_Load(replay);
+        if (status != CFE_SUCCESS) {
+            fprintf(stderr, "Cannot read mock trace: %s (status %d)\n", replay, status);
+            g_mock_trace.mode = MOCK_TRACE_OFF;
+            return status;
+        }
+        g_mock_trace.mode = MOCK_TRACE_REPLAY;
+        return CFE_SUCCESS;
+    }
+
+    boolean enabled = (record && record[0] != '\0') ? (record[0] != '0') : default_record;
+    g_mock_trace.mode = enabled ? MOCK_TRACE_RECORD : MOCK_TRACE_OFF;
+    return CFE_SUCCESS;
+}
+
+boolean CFS_MockTrace_Enabled(void) {
+    return g_mock_trace.mode != MOCK_TRACE_OFF;
+}
+
+void CFS_MockTrace_BeginInput(const uint8_t *data, size_t size) {
+    MockTrace_t *t = &t_mock_trace;
+
+    if (g_mock_trace.mode == MOCK_TRACE_OFF) {
+        return;
+    }
+    if (g_mock_trace.mode == MOCK_TRACE_RECORD && !t->buffer) {
+        t->buffer = malloc(CFS_MOCK_TRACE_BYTES);
+    }
+    t->used = 0;
+    t->records = 0;
+    t->truncated = (t->buffer == NULL);
+    t->flushed = FALSE;
+    t->data = data;
+    t->size = size;
+    t->cursor = 0;
+    t->diverged = FALSE;
+}
+
+void CFS_MockTrace_EndInput(void) {
+    MockTrace_t *t = &t_mock_trace;
+
+    if (g_mock_trace.mode == MOCK_TRACE_RECORD) {
+        t->data = NULL;
+        return;
+    }
+    if (g_mock_trace.mode != MOCK_TRACE_REPLAY) {
+        return;
+    }
+    if (t->size != g_mock_trace.input_size ||
+        MockTrace_Hash(t->data, t->size) != g_mock_trace.input_hash) {
+        printf("Mock trace: input differs from the recorded one\n");
+    }
+    printf("Mock trace: replayed %u of %u records%s\n", t->cursor, g_mock_trace.entry_count,
+           t->diverged ? " (diverged)" : "");
+    t->data = NULL;
+}
+
+/*
+ * 재생
+ */
+static void MockTrace_PrintCall(const char *label, uint32_t kind, const int64_t *in, const int64_t *out) {
+    const MockTraceKindInfo_t *info = &g_mock_trace_kinds[kind];
+    fprintf(stderr, "==CFS==   %s %s(", label, info->name ? info->name : "?");
+    for (uint32_t k = 0; k < info->in; k++) {
+        fprintf(stderr, "%s%ld", k ? ", " : "", (long)in[k]);
+    }
+    fprintf(stderr, ")");
+    for (uint32_t k = 0; out && k < info->out; k++) {
+        fprintf(stderr, "%s%ld", k ? ", " : " -> ", (long)out[k]);
+    }
+    fprintf(stderr, "\n");
+}
+
+static void MockTrace_Diverge(MockTrace_t *t, CFS_MockTraceKind_t kind, const int64_t *in, const int64_t *out) {
+    t->diverged = TRUE;
+    flockfile(stderr);
+    fprintf(stderr, "==CFS== mock trace diverged at record %u of %u\n", t->cursor, g_mock_trace.entry_count);
+    if (t->cursor < g_mock_trace.entry_count) {
+        const MockTraceEntry_t *e = &g_mock_trace.entries[t->cursor];
+        MockTrace_PrintCall("expected", e->kind, e->in, e->out);
+    }
+    MockTrace_PrintCall("got     ", kind, in, out);
+    funlockfile(stderr);
+}
+
+// 다음 기록이 같은 종류/입력인지 (다르면 어긋남 보고)
+static const MockTraceEntry_t* MockTrace_Next(MockTrace_t *t, CFS_MockTraceKind_t kind,
+                                              const int64_t *in, const int64_t *out) {
+    if (t->diverged || !t->data) {
+        return NULL;
+    }
+    const MockTraceEntry_t *e = (t->cursor < g_mock_trace.entry_count) ?
+                                &g_mock_trace.entries[t->cursor] : NULL;
+    boolean match = e && e->kind == kind;
+    for (uint32_t k = 0; match && k < g_mock_trace_kinds[kind].in; k++) {
+        match = (e->in[k] == in[k]);
+    }
+    if (!match) {
+        MockTrace_Diverge(t, kind, in, out);
+        return NULL;
+    }
+    t->cursor++;
+    return e;
+}
+
+boolean CFS_MockTrace_Feed(CFS_MockTraceKind_t kind, const int64_t *in, int64_t *out) {
+    if (g_mock_trace.mode != MOCK_TRACE_REPLAY) {
+        return FALSE;
+    }
+    const MockTraceEntry_t *e = MockTrace_Next(&t_mock_trace, kind, in, NULL);
+    if (!e) {
+        return FALSE;
+    }
+    memcpy(out, e->out, g_mock_trace_kinds[kind].out * sizeof(int64_t));
+    return TRUE;
+}
+
+void CFS_MockTrace_Record(CFS_MockTraceKind_t kind, const int64_t *in, const int64_t *out) {
+    MockTrace_t *t = &t_mock_trace;
+    const MockTraceKindInfo_t *info = &g_mock_trace_kinds[kind];
+
+    if (g_mock_trace.mode == MOCK_TRACE_REPLAY) {
+        // 비교만 하는 호출: 결과까지 같아야 한다
+        const MockTraceEntry_t *e = MockTrace_Next(t, kind, in, out);
+        if (e && info->out > 0 && memcmp(e->out, out, info->out * sizeof(int64_t)) != 0) {
+            t->cursor--;
+            MockTrace_Diverge(t, kind, in, out);
+        }
+        return;
+    }
+    if (g_mock_trace.mode != MOCK_TRACE_RECORD || t->truncated || !t->data) {
+        return;
+    }
+    if (t->used + 1 + (uint32_t)(info->in + info->out) * MOCK_TRACE_VARINT_MAX > CFS_MOCK_TRACE_BYTES) {
+        t->truncated = TRUE;
+        return;
+    }
+
+    uint8_t *p = t->buffer + t->used;
+    uint32_t n = 0;
+    p[n++] = (uint8_t)kind;
+    for (uint32_t k = 0; k < info->in; k++) {
+        n += MockTrace_PutVarint(p + n, in[k]);
+    }
+    for (uint32_t k = 0; k < info->out; k++) {
+        n += MockTrace_PutVarint(p + n, out[k]);
+    }
+    t->used += n;
+    t->records++;
+}
+
+/*
+ * 크래시 때 내보내기 (async-signal-safe 한 호출만)
+ */
+static void MockTrace_WriteAll(int fd, const uint8_t *data, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        ssize_t w = write(fd, data + done, size - done);
+        if (w < 0 && errno == EINTR) {
+            continue;
+        }
+        if (w <= 0) {
+            return;
+        }
+        done += (size_t)w;
+    }
+}
+
+static void MockTrace_WriteStr(const char *s) {
+    ssize_t r = write(STDERR_FILENO, s, strlen(s));
+    (void)r;
+}
+
+void CFS_MockTrace_Flush(const char *prefix) {
+    static const char hex[] = "0123456789abcdef";
+    static const char kind[] = "mocktrace-";
+    MockTrace_t *t = &t_mock_trace;
+
+    if (g_mock_trace.mode != MOCK_TRACE_RECORD || !t->buffer || !t->data || t->flushed) {
+        return;
+    }
+    t->flushed = TRUE;
+
+    // "<prefix>mocktrace-<16 hex>"
+    char path[1024];
+    size_t n = 0;
+    uint64_t hash = MockTrace_Hash(t->data, t->size);
+    for (const char *p = prefix ? prefix : g_mock_trace.prefix; *p && n + 1 < sizeof(path); p++) {
+        path[n++] = *p;
+    }
+    for (const char *p = kind; *p && n + 1 < sizeof(path); p++) {
+        path[n++] = *p;
+    }
+    for (int shift = 60; shift >= 0 && n + 1 < sizeof(path); shift -= 4) {
+        path[n++] = hex[(hash >> shift) & 0xF];
+    }
+    path[n] = '\0';
+
+    uint8_t header[MOCK_TRACE_HEADER_MAX];
+    const char *mission = CFS_Mission_Get()->name;
+    size_t name_len = strnlen(mission, CFS_MISSION_NAME_LEN - 1);
+    size_t h = MOCK_TRACE_MAGIC_LEN;
+    memcpy(header, MOCK_TRACE_MAGIC, MOCK_TRACE_MAGIC_LEN);
+    h += MockTrace_PutVarint(header + h, (int64_t)name_len);
+    memcpy(header + h, mission, name_len);
+    h += name_len;
+    h += MockTrace_PutVarint(header + h, (int64_t)t->size);
+    h += MockTrace_PutVarint(header + h, (int64_t)hash);
+    h += MockTrace_PutVarint(header + h, t->records);
+    h += MockTrace_PutVarint(header + h, t->truncated);
+    h += MockTrace_PutVarint(header + h, t->used);
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return;
+    }
+    MockTrace_WriteAll(fd, header, h);
+    MockTrace_WriteAll(fd, t->buffer, t->used);
+    close(fd);
+
+    MockTrace_WriteStr("==CFS== mock trace saved: ");
+    MockTrace_WriteStr(path);
+    MockTrace_WriteStr("\n");
+}
+
+// ASan 오류 보고 시작 시 호출되는 훅 (libFuzzer 가 죽음 콜백을 차지하는 경우에도 기록이 남도록)
+#if defined(__SANITIZE_ADDRESS__)
+#define MOCK_TRACE_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define MOCK_TRACE_ASAN 1
+#endif
+#endif
+
+#ifdef MOCK_TRACE_ASAN
+void __asan_on_error(void);
+void __asan_on_error(void) {
+    CFS_MockTrace_Flush(NULL);
+}
+#endif
+
+/*
+ * 스냅샷
+ */
+CFS_MockTraceMark_t* CFS_MockTrace_Capture(void) {
+    const MockTrace_t *t = &t_mock_trace;
+    uint32_t used = (g_mock_trace.mode == MOCK_TRACE_RECORD && t->buffer) ? t->used : 0;
+    CFS_MockTraceMark_t *mark = malloc(sizeof(*mark) + used);
+
+    if (!mark) {
+        return NULL;
+    }
+    mark->used = used;
+    mark->records = t->records;
+    mark->cursor = t->cursor;
+    mark->truncated = t->truncated;
+    mark->diverged = t->diverged;
+    if (used > 0) {
+        memcpy(mark->bytes, t->buffer, used);
+    }
+    return mark;
+}
+
+void CFS_MockTrace_Restore(const CFS_MockTraceMark_t *mark) {
+    MockTrace_t *t = &t_mock_trace;
+
+    if (!mark || g_mock_trace.mode == MOCK_TRACE_OFF) {
+        return;
+    }
+    if (g_mock_trace.mode == MOCK_TRACE_RECORD && t->buffer) {
+        memcpy(t->buffer, mark->bytes, mark->used);
+        t->used = mark->used;
+        t->records = mark->records;
+        t->truncated = mark->truncated;
+    }
+    t->cursor = mark->cursor;
+    t->diverged = mark->diverged;
+}
+
+size_t CFS_MockTrace_MarkBytes(const CFS_MockTraceMark_t *mark) {
+    return mark ? sizeof(*mark) + mark->used : 0;
+}
+
+void CFS_MockTrace_FreeMark(CFS_MockTraceMark_t *mark) {
+    free(mark);
+}
+
+void CFS_MockTrace_Release(void) {
+    MockTrace_t *t = &t_mock_trace;
+
+    free(t->buffer);
+    memset(t, 0, sizeof(*t));
+}
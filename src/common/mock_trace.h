@@ -0,0 +1,63 @@
+/*
+ * CFS Mock 호출 기록/재생 헤더
+ * cfe_mock.h 의 Mock 과 공통 유틸리티 (심볼 해석, 메모리 영역 검증, VFS 읽기) 호출마다
+ * 종류, 입력 값, 결과 값을 스레드별 버퍼에 varint 로 기록한다.
+ *   - 버퍼는 입력마다 비우고 크래시 때만 파일로 내보낸다 (평소에는 I/O 없음)
+ *   - 재생 모드는 기록 파일을 읽어 같은 순서의 호출에 기록된 결과를 돌려주므로,
+ *     심볼 주소나 영역 검증처럼 미션 설정에 따라 달라지는 결과를 설정 없이 재현한다
+ *   - 파일 내용, 이벤트, 지연처럼 입력에서 정해지는 호출은 재생 때 비교만 한다
+ * 심볼 해석은 캐시 적중 여부와 무관하도록 OS_SymbolLookup 이 아니라 MM_ResolveSymAddr 단에서 기록한다.
+ *
+ * 기록 파일 (<접두어>mocktrace-<입력 FNV-1a 해시 16 진수>)
+ *   "CFSMTRC1", 미션 이름 (길이 + 바이트), 입력 크기, 입력 해시, 기록 수, 잘림 여부,
+ *   기록 바이트 수, 기록들 ([종류:1][입력 값...][결과 값...], 값은 zigzag varint)
+ *
+ * 환경 변수
+ *   CFS_MOCK_TRACE=0|1          기록 여부 (기본: 퍼징 1, 단독 재생 0)
+ *   CFS_MOCK_TRACE_PREFIX=P     크래시 기록 파일 접두어 (기본 현재 디렉토리, -fuzz 는 artifact_prefix)
+ *   CFS_MOCK_TRACE_REPLAY=FILE  기록 파일의 결과를 돌려주는 재생 모드 (-j 1 로 해당 입력 하나 실행)
+ */
+
+#ifndef CFS_MOCK_TRACE_H
+#define CFS_MOCK_TRACE_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+// 스레드당 기록 버퍼 크기 (넘치면 뒤 호출은 버리고 잘림으로 표시)
+#ifndef CFS_MOCK_TRACE_BYTES
+#define CFS_MOCK_TRACE_BYTES        (64 * 1024)
+#endif
+
+// 스냅샷용 기록 상태 (불투명 타입)
+typedef struct CFS_MockTraceMark CFS_MockTraceMark_t;
+
+// 설정 (워커 스레드 시작 전에만). 재생 파일을 읽지 못하면 CFS_MM_ERROR_FILE_ACCESS
+int32_t CFS_MockTrace_ConfigureFromEnv(boolean default_record);
+
+// 기록 또는 재생 중인지 (호출자가 해시 같은 준비 비용을 건너뛰는 데 사용)
+boolean CFS_MockTrace_Enabled(void);
+
+// 입력 경계: Begin 은 버퍼/재생 위치를 비움, End 는 재생 모드에서 결과 한 줄을 출력
+void CFS_MockTrace_BeginInput(const uint8_t *data, size_t size);
+void CFS_MockTrace_EndInput(void);
+
+/*
+ * 현재 스레드의 기록을 파일로 내보냄 (async-signal-safe, 입력당 한 번)
+ * prefix 가 NULL 이면 CFS_MOCK_TRACE_PREFIX
+ */
+void CFS_MockTrace_Flush(const char *prefix);
+
+// 스냅샷: 지금까지의 기록 사본 / 복원 / 해제
+CFS_MockTraceMark_t* CFS_MockTrace_Capture(void);
+void CFS_MockTrace_Restore(const CFS_MockTraceMark_t *mark);
+size_t CFS_MockTrace_MarkBytes(const CFS_MockTraceMark_t *mark);
+void CFS_MockTrace_FreeMark(CFS_MockTraceMark_t *mark);
+
+// 현재 스레드의 기록 버퍼 해제 (워커 종료 시, 다음 BeginInput 이 다시 할당)
+void CFS_MockTrace_Release(void);
+
+// 문자열/바이트 지문 (기록 입력 값용, 32 비트)
+int64_t CFS_MockTrace_Fingerprint(const void *data, size_t size);
+
+#endif // CFS_MOCK_TRACE_H
@@ -0,0 +1,384 @@
+/*
+ * CFS 단계별 프로파일러
+ *
+ * 실행 흐름
+ *   Begin - 입력과 시작 사이클 기록
+ *   Stage - 직전 단계에 경과 사이클을 더하고 새 단계 시작
+ *   End   - 단계별 (그리고 입력 전체) 사이클을 누적하고, 단계의 상위 K 최소 힙
+ *           바닥값보다 느렸으면 입력을 복사해 힙에 넣는다
+ * 힙 바닥값은 잠금 없이 먼저 비교하므로 대부분의 실행은 잠금을 잡지 않는다.
+ * 사이클 → 시간 환산은 Configure 시점과 보고 시점의 사이클/단조 시계 비로 구한다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "profile.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+const char *const cfs_stage_names[CFS_STAGE_COUNT] = {
+    [CFS_STAGE_DECODE]   = "decode",
+    [CFS_STAGE_VALIDATE] = "validate",
+    [CFS_STAGE_PATH]     = "path",
+    [CFS_STAGE_RESOLVE]  = "resolve",
+    [CFS_STAGE_REGION]   = "region",
+    [CFS_STAGE_ALIGN]    = "align",
+    [CFS_STAGE_TRANSFER] = "transfer",
+    [CFS_STAGE_SNAPSHOT] = "snapshot",
+};
+
+// 단계별 슬롯 + 입력 전체 슬롯
+#define PROFILE_TOTAL           CFS_STAGE_COUNT
+#define PROFILE_SLOTS           (CFS_STAGE_COUNT + 1)
+
+typedef struct {
+    uint64_t  cycles;
+    uint64_t  hash;
+    size_t    size;
+    uint8_t  *data;
+} ProfileEntry_t;
+
+// 느린 입력 상위 K (heap[0] 이 가장 빠른 최소 힙)
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t        count;
+    uint64_t        floor;          // 힙이 찼을 때 heap[0].cycles, 아니면 0
+    ProfileEntry_t  heap[CFS_PROFILE_TOP_K];
+} ProfileTop_t;
+
+typedef struct {
+    const uint8_t *data;
+    size_t         size;
+    uint64_t       start;
+    uint64_t       mark;
+    int            stage;           // 현재 단계 (-1 = 없음)
+    boolean        active;
+    uint64_t       cycles[PROFILE_SLOTS];
+} ProfileThread_t;
+
+static ProfileTop_t g_profile_top[PROFILE_SLOTS];
+static CFS_ProfileStageStats_t g_profile_stats[PROFILE_SLOTS];
+static char g_profile_dir[512] = "";
+static uint64_t g_profile_ref_cycles = 0;
+static uint64_t g_profile_ref_ns = 0;
+
+static pthread_once_t g_profile_once = PTHREAD_ONCE_INIT;
+static CFS_THREAD_LOCAL ProfileThread_t t_profile = { NULL, 0, 0, 0, -1, FALSE, {0} };
+
+static uint64_t Profile_MonotonicNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint64_t Profile_Now(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return Profile_MonotonicNs();
+#endif
+}
+
+// 사이클당 나노초 (기준 시점 이후 경과로 추정)
+static double Profile_NsPerCycle(void) {
+    uint64_t cycles = Profile_Now() - g_profile_ref_cycles;
+    uint64_t ns = Profile_MonotonicNs() - g_profile_ref_ns;
+    return cycles > 0 ? (double)ns / (double)cycles : 1.0;
+}
+
+static void Profile_Init(void) {
+    for (int slot = 0; slot < PROFILE_SLOTS; slot++) {
+        pthread_mutex_init(&g_profile_top[slot].lock, NULL);
+    }
+    g_profile_ref_cycles = Profile_Now();
+    g_profile_ref_ns = Profile_MonotonicNs();
+}
+
+static const char* Profile_SlotName(int slot) {
+    return (slot == PROFILE_TOTAL) ? "total" : cfs_stage_names[slot];
+}
+
+void CFS_Profile_Configure(void) {
+    pthread_once(&g_profile_once, Profile_Init);
+
+    const char *env = getenv("CFS_PROFILE_DIR");
+    if (env && env[0] != '\0' && g_profile_dir[0] == '\0') {
+        snprintf(g_profile_dir, sizeof(g_profile_dir), "%s", env);
+        atexit(CFS_Profile_Write);
+    }
+}
+
+/*
+ * 계측
+ */
+void CFS_Profile_Begin(const uint8_t *data, size_t size) {
+    ProfileThread_t *t = &t_profile;
+
+    pthread_once(&g_profile_once, Profile_Init);
+    memset(t->cycles, 0, sizeof(t->cycles));
+    t->data = data;
+    t->size = size;
+    t->stage = -1;
+    t->active = TRUE;
+    t->start = t->mark = Profile_Now();
+}
+
+void CFS_Profile_Stage(CFS_Stage_t stage) {
+    ProfileThread_t *t = &t_profile;
+    if (!t->active) {
+        return;
+    }
+
+    uint64_t now = Profile_Now();
+    if (t->stage >= 0) {
+        t->cycles[t->stage] += now - t->mark;
+    }
+    t->mark = now;
+    t->stage = (int)stage;
+}
+
+static void Profile_SiftDown(ProfileTop_t *top, uint32_t i) {
+    for (;;) {
+        uint32_t smallest = i;
+        uint32_t l = 2 * i + 1;
+        uint32_t r = l + 1;
+        if (l < top->count && top->heap[l].cycles < top->heap[smallest].cycles) {
+            smallest = l;
+        }
+        if (r < top->count && top->heap[r].cycles < top->heap[smallest].cycles) {
+            smallest = r;
+        }
+        if (smallest == i) {
+            return;
+        }
+        ProfileEntry_t tmp = top->heap[i];
+        top->heap[i] = top->heap[smallest];
+        top->heap[smallest] = tmp;
+        i = smallest;
+    }
+}
+
+static void Profile_SiftUp(ProfileTop_t *top, uint32_t i) {
+    while (i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if (top->heap[parent].cycles <= top->heap[i].cycles) {
+            return;
+        }
+        ProfileEntry_t tmp = top->heap[i];
+        top->heap[i] = top->heap[parent];
+        top->heap[parent] = tmp;
+        i = parent;
+    }
+}
+
+// 상위 K 후보 등록 (같은 입력은 더 느린 기록만 유지)
+static void Profile_Offer(int slot, uint64_t cycles, uint64_t hash, const uint8_t *data, size_t size) {
+    ProfileTop_t *top = &g_profile_top[slot];
+
+    pthread_mutex_lock(&top->lock);
+    for (uint32_t i = 0; i < top->count; i++) {
+        if (top->heap[i].hash == hash && top->heap[i].size == size) {
+            if (cycles > top->heap[i].cycles) {
+                top->heap[i].cycles = cycles;
+                Profile_SiftDown(top, i);
+            }
+            pthread_mutex_unlock(&top->lock);
+            return;
+        }
+    }
+
+    if (top->count < CFS_PROFILE_TOP_K || cycles > top->heap[0].cycles) {
+        uint8_t *copy = malloc(size ? size : 1);
+        if (copy) {
+            memcpy(copy, data, size);
+            ProfileEntry_t entry = { cycles, hash, size, copy };
+            if (top->count < CFS_PROFILE_TOP_K) {
+                top->heap[top->count++] = entry;
+                Profile_SiftUp(top, top->count - 1);
+            } else {
+                free(top->heap[0].data);
+                top->heap[0] = entry;
+                Profile_SiftDown(top, 0);
+            }
+        }
+    }
+    uint64_t floor = (top->count == CFS_PROFILE_TOP_K) ? top->heap[0].cycles : 0;
+    __atomic_store_n(&top->floor, floor, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&top->lock);
+}
+
+void CFS_Profile_End(void) {
+    ProfileThread_t *t = &t_profile;
+    if (!t->active) {
+        return;
+    }
+
+    uint64_t now = Profile_Now();
+    if (t->stage >= 0) {
+        t->cycles[t->stage] += now - t->mark;
+    }
+    t->cycles[PROFILE_TOTAL] = now - t->start;
+    t->active = FALSE;
+
+    uint64_t hash = 0;
+    boolean hashed = FALSE;
+    for (int slot = 0; slot < PROFILE_SLOTS; slot++) {
+        uint64_t cycles = t->cycles[slot];
+        if (cycles == 0) {
+            continue;
+        }
+
+        CFS_ProfileStageStats_t *stats = &g_profile_stats[slot];
+        __atomic_fetch_add(&stats->count, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&stats->total_cycles, cycles, __ATOMIC_RELAXED);
+        uint64_t max = __atomic_load_n(&stats->max_cycles, __ATOMIC_RELAXED);
+        while (cycles > max &&
+               !__atomic_compare_exchange_n(&stats->max_cycles, &max, cycles, TRUE,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        }
+
+        if (cycles <= __atomic_load_n(&g_profile_top[slot].floor, __ATOMIC_RELAXED)) {
+            continue;
+        }
+        if (!hashed) {
+            hash = 0xcbf29ce484222325ULL;
+            for (size_t i = 0; i < t->size; i++) {
+                hash ^= t->data[i];
+                hash *= 0x100000001b3ULL;
+            }
+            hashed = TRUE;
+        }
+        Profile_Offer(slot, cycles, hash, t->data, t->size);
+    }
+}
+
+/*
+ * 보고
+ */
+static int Profile_CompareDesc(const void *a, const void *b) {
+    const ProfileEntry_t *ea = (const ProfileEntry_t *)a;
+    const ProfileEntry_t *eb = (const ProfileEntry_t *)b;
+    return (ea->cycles < eb->cycles) - (ea->cycles > eb->cycles);
+}
+
+// 슬롯의 상위 K 를 느린 순서로 복사 (데이터 포인터는 공유)
+static uint32_t Profile_Snapshot(int slot, ProfileEntry_t *out) {
+    ProfileTop_t *top = &g_profile_top[slot];
+
+    pthread_mutex_lock(&top->lock);
+    uint32_t count = top->count;
+    memcpy(out, top->heap, count * sizeof(ProfileEntry_t));
+    pthread_mutex_unlock(&top->lock);
+
+    qsort(out, count, sizeof(ProfileEntry_t), Profile_CompareDesc);
+    return count;
+}
+
+static void Profile_WriteInput(const char *dir, const ProfileEntry_t *entry) {
+    char path[600];
+    snprintf(path, sizeof(path), "%s/%016lx", dir, (unsigned long)entry->hash);
+    int fd = open(path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return;
+    }
+    size_t done = 0;
+    while (done < entry->size) {
+        ssize_t written = write(fd, entry->data + done, entry->size - done);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            break;
+        }
+        done += (size_t)written;
+    }
+    close(fd);
+}
+
+void CFS_Profile_Write(void) {
+    if (g_profile_dir[0] == '\0') {
+        return;
+    }
+
+    char inputs_dir[560];
+    snprintf(inputs_dir, sizeof(inputs_dir), "%s/inputs", g_profile_dir);
+    mkdir(g_profile_dir, 0755);
+    mkdir(inputs_dir, 0755);
+
+    double ns_per_cycle = Profile_NsPerCycle();
+    char path[600];
+
+    snprintf(path, sizeof(path), "%s/stages.csv", g_profile_dir);
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        CFS_WARN_PRINT("Cannot write profile report: %s", path);
+        return;
+    }
+    fprintf(f, "stage,count,total_cycles,mean_cycles,max_cycles,mean_ns,max_ns\n");
+    for (int slot = 0; slot < PROFILE_SLOTS; slot++) {
+        const CFS_ProfileStageStats_t *stats = &g_profile_stats[slot];
+        if (stats->count == 0) {
+            continue;
+        }
+        double mean = (double)stats->total_cycles / (double)stats->count;
+        fprintf(f, "%s,%lu,%lu,%.0f,%lu,%.0f,%.0f\n", Profile_SlotName(slot),
+                (unsigned long)stats->count, (unsigned long)stats->total_cycles, mean,
+                (unsigned long)stats->max_cycles, mean * ns_per_cycle,
+                (double)stats->max_cycles * ns_per_cycle);
+    }
+    fclose(f);
+
+    ProfileEntry_t entries[CFS_PROFILE_TOP_K];
+    for (int slot = 0; slot < PROFILE_SLOTS; slot++) {
+        uint32_t count = Profile_Snapshot(slot, entries);
+        if (count == 0) {
+            continue;
+        }
+
+        snprintf(path, sizeof(path), "%s/slow_%s.csv", g_profile_dir, Profile_SlotName(slot));
+        f = fopen(path, "w");
+        if (!f) {
+            continue;
+        }
+        fprintf(f, "rank,cycles,ns,size,input\n");
+        for (uint32_t i = 0; i < count; i++) {
+            fprintf(f, "%u,%lu,%.0f,%zu,inputs/%016lx\n", i + 1, (unsigned long)entries[i].cycles,
+                    (double)entries[i].cycles * ns_per_cycle, entries[i].size,
+                    (unsigned long)entries[i].hash);
+            Profile_WriteInput(inputs_dir, &entries[i]);
+        }
+        fclose(f);
+    }
+}
+
+void CFS_Profile_PrintStats(void) {
+    double ns_per_cycle = Profile_NsPerCycle();
+    ProfileEntry_t entries[CFS_PROFILE_TOP_K];
+
+    printf("\n=== Stage Profile ===\n");
+    printf("%-10s %10s %12s %12s %14s\n", "Stage", "Count", "Mean(ns)", "Max(ns)", "Slowest input");
+    for (int slot = 0; slot < PROFILE_SLOTS; slot++) {
+        const CFS_ProfileStageStats_t *stats = &g_profile_stats[slot];
+        if (stats->count == 0) {
+            continue;
+        }
+        uint32_t count = Profile_Snapshot(slot, entries);
+        double mean = (double)stats->total_cycles / (double)stats->count;
+        printf("%-10s %10lu %12.0f %12.0f %8zu bytes\n", Profile_SlotName(slot),
+               (unsigned long)stats->count, mean * ns_per_cycle,
+               (double)stats->max_cycles * ns_per_cycle, count ? entries[0].size : (size_t)0);
+    }
+    if (g_profile_dir[0] != '\0') {
+        printf("Slowest inputs per stage written to: %s (at exit)\n", g_profile_dir);
+    }
+    printf("=====================\n");
+}
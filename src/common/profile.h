@@ -0,0 +1,74 @@
+/*
+ * CFS 단계별 프로파일러 헤더
+ * 입력 하나의 처리 단계마다 사이클 카운터 (x86 은 rdtsc) 로 시간을 재고,
+ * 단계마다 가장 느린 입력 상위 K 개를 보관했다가 세션 종료 시 결과 디렉토리에 쓴다.
+ *
+ * 계측은 ENABLE_PROFILE=true 빌드 (-DCFS_PROFILE_STAGES) 에만 들어가며,
+ * 그 외 빌드에서 CFS_PROFILE_* 매크로는 빈 문장이다.
+ * CFS_STAGE 는 워치독 단계 표시도 겸하므로 프로파일러 없이도 항상 사용한다.
+ *
+ * 환경 변수
+ *   CFS_PROFILE_DIR=DIR   종료 시 stages.csv, slow_<단계>.csv, inputs/<해시> 를 쓸 디렉토리
+ */
+
+#ifndef CFS_PROFILE_H
+#define CFS_PROFILE_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+#include "watchdog.h"
+
+// 단계별로 보관할 느린 입력 수
+#ifndef CFS_PROFILE_TOP_K
+#define CFS_PROFILE_TOP_K       8
+#endif
+
+// 명령 처리 단계 (진입 순서)
+typedef enum {
+    CFS_STAGE_DECODE = 0,       // 입력 → 패킷
+    CFS_STAGE_VALIDATE,         // 메모리 타입/크기 검사
+    CFS_STAGE_PATH,             // 파일 이름/경로 검사
+    CFS_STAGE_RESOLVE,          // 심볼 해석
+    CFS_STAGE_REGION,           // 메모리 영역 조회
+    CFS_STAGE_ALIGN,            // 정렬 검사
+    CFS_STAGE_TRANSFER,         // 로드/CRC, 채우기, 덤프 내보내기
+    CFS_STAGE_SNAPSHOT,         // 시퀀스 스냅샷 복원/캡처
+    CFS_STAGE_COUNT
+} CFS_Stage_t;
+
+extern const char *const cfs_stage_names[CFS_STAGE_COUNT];
+
+// 단계별 누적 (마지막 항목은 입력 전체)
+typedef struct {
+    uint64_t count;
+    uint64_t total_cycles;
+    uint64_t max_cycles;
+} CFS_ProfileStageStats_t;
+
+void CFS_Profile_Configure(void);
+void CFS_Profile_Begin(const uint8_t *data, size_t size);
+void CFS_Profile_Stage(CFS_Stage_t stage);
+void CFS_Profile_End(void);
+
+// 결과 디렉토리에 보고서와 입력 쓰기 (Configure 가 atexit 으로 등록)
+void CFS_Profile_Write(void);
+void CFS_Profile_PrintStats(void);
+
+#ifdef CFS_PROFILE_STAGES
+    #define CFS_PROFILE_CONFIGURE()         CFS_Profile_Configure()
+    #define CFS_PROFILE_BEGIN(data, size)   CFS_Profile_Begin((data), (size))
+    #define CFS_PROFILE_END()               CFS_Profile_End()
+    #define CFS_PROFILE_PRINT()             CFS_Profile_PrintStats()
+    #define CFS_STAGE(stage) do { \
+        CFS_Watchdog_Stage(cfs_stage_names[stage]); \
+        CFS_Profile_Stage(stage); \
+    } while (0)
+#else
+    #define CFS_PROFILE_CONFIGURE()         ((void)0)
+    #define CFS_PROFILE_BEGIN(data, size)   ((void)0)
+    #define CFS_PROFILE_END()               ((void)0)
+    #define CFS_PROFILE_PRINT()             ((void)0)
+    #define CFS_STAGE(stage)                CFS_Watchdog_Stage(cfs_stage_names[stage])
+#endif
+
+#endif // CFS_PROFILE_H
@@ -0,0 +1,882 @@
+/*
+ * CFS 배치 재생(replay) 러너
+ *
+ * 코퍼스/크래시 디렉토리를 입력마다 퍼저 바이너리를 다시 띄우지 않고
+ * 한 프로세스 안에서 재생한다.
+ *   - 입력 목록: 파일, 디렉토리(재귀), 코퍼스 팩(mmap, 무복사)
+ *   - 워커별 구간 큐 + 작업 훔치기(work stealing)로 부하 분산
+ *   - 입력별 상태 코드/시간/가상 시간은 인덱스별 배열에 기록 후 순서대로 보고
+ *   - 크래시 시 실행 중이던 입력 이름을 출력 (signal / sanitizer 콜백)
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "replay.h"
+#include "corpus_pack.h"
+#include "differential.h"
+#include "eeprom.h"
+#include "hexdump.h"
+#include "mock_trace.h"
+#include "sim_mem.h"
+#include "snapshot.h"
+#include "sym_cache.h"
+#include "utils.h"
+#include "vclock.h"
+#include "vfs.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define REPLAY_BATCH_SIZE       16
+#define REPLAY_MAX_THREADS      256
+#define REPLAY_MAX_PACKS        64
+
+// sanitizer 런타임이 링크된 경우에만 존재
+extern void __sanitizer_set_death_callback(void (*callback)(void)) __attribute__((weak));
+
+typedef struct {
+    char          *name;            // 파일 경로 (소유) 또는 팩 엔트리 이름
+    const char    *key;             // name 중 재생 루트 기준 상대 경로 (기준 보고서 비교용)
+    const uint8_t *data;            // 팩 엔트리면 mmap 포인터, 파일이면 NULL
+    size_t         size;
+    boolean        owns_name;
+} ReplayItem_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    size_t          lo;
+    size_t          hi;
+} ReplayQueue_t;
+
+typedef struct {
+    ReplayItem_t       *items;
+    size_t              count;
+    size_t              capacity;
+    CFS_CorpusPack_t    packs[REPLAY_MAX_PACKS];
+    uint32_t            pack_count;
+
+    int32_t            *status;
+    uint64_t           *elapsed_ns;
+    uint64_t           *virtual_ns;
+
+    ReplayQueue_t      *queues;
+    uint32_t            threads;
+    CFS_ReplayTarget_t  target;
+
+    // 워커별 현재 실행 중인 입력 (크래시 보고용, SIZE_MAX = 없음)
+    volatile size_t     current[REPLAY_MAX_THREADS];
+} ReplayRun_t;
+
+typedef struct {
+    ReplayRun_t *run;
+    uint32_t     id;
+} ReplayWorker_t;
+
+static ReplayRun_t *volatile g_replay_run = NULL;
+
+// 하네스 스레드 상태 해제 훅 (CFS_Replay_ReleaseThread)
+static CFS_ReplayThreadRelease_t g_thread_release = NULL;
+static CFS_THREAD_LOCAL int t_worker_id = -1;
+static CFS_THREAD_LOCAL const uint8_t *t_worker_data = NULL;   // 실행 중인 입력 (크래시 보고용)
+static CFS_THREAD_LOCAL size_t t_worker_size = 0;
+
+static uint64_t Replay_NowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/*
+ * 크래시 보고 (async-signal-safe 한 write 만 사용)
+ */
+static void Replay_WriteStr(const char *s) {
+    ssize_t r = write(STDERR_FILENO, s, strlen(s));
+    (void)r;
+}
+
+static void Replay_ReportInFlight(void) {
+    ReplayRun_t *run = g_replay_run;
+    if (!run) {
+        return;
+    }
+
+    if (t_worker_id >= 0 && run->current[t_worker_id] != SIZE_MAX) {
+        Replay_WriteStr("==CFS_REPLAY== crashing input: ");
+        Replay_WriteStr(run->items[run->current[t_worker_id]].name);
+        Replay_WriteStr("\n");
+        if (t_worker_data) {
+            const CFS_HexDumpOptions_t opts = { "  ", 0, NULL, CFS_HEXDUMP_ELIDE };
+            size_t shown = t_worker_size < CFS_HEXDUMP_CRASH_BYTES ? t_worker_size : CFS_HEXDUMP_CRASH_BYTES;
+            (void)CFS_HexDump_Write(STDERR_FILENO, t_worker_data, shown, &opts);
+        }
+        CFS_MockTrace_Flush(NULL);
+    }
+
+    for (uint32_t i = 0; i < run->threads; i++) {
+        size_t idx = run->current[i];
+        if ((int)i != t_worker_id && idx != SIZE_MAX) {
+            Replay_WriteStr("==CFS_REPLAY== also in flight: ");
+            Replay_WriteStr(run->items[idx].name);
+            Replay_WriteStr("\n");
+        }
+    }
+}
+
+static void Replay_SignalHandler(int signo) {
+    Replay_ReportInFlight();
+    signal(signo, SIG_DFL);
+    raise(signo);
+}
+
+static void Replay_InstallCrashHandlers(void) {
+    static const int signals[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+
+    for (size_t i = 0; i < sizeof(signals) / sizeof(signals[0]); i++) {
+        signal(signals[i], Replay_SignalHandler);
+    }
+    if (__sanitizer_set_death_callback) {
+        __sanitizer_set_death_callback(Replay_ReportInFlight);
+    }
+}
+
+/*
+ * 입력 목록 수집
+ */
+static int32_t Replay_AddItem(ReplayRun_t *run, char *name, size_t key_offset,
+                              const uint8_t *data, size_t size, boolean owns_name) {
+    if (run->count == run->capacity) {
+        size_t new_capacity = run->capacity ? run->capacity * 2 : 1024;
+        ReplayItem_t *p = realloc(run->items, new_capacity * sizeof(ReplayItem_t));
+        if (!p) {
+            return CFS_MM_ERROR_RESOURCE_LIMIT;
+        }
+        run->items = p;
+        run->capacity = new_capacity;
+    }
+
+    ReplayItem_t *item = &run->items[run->count++];
+    item->name = name;
+    item->key = name + key_offset;
+    item->data = data;
+    item->size = size;
+    item->owns_name = owns_name;
+    return CFE_SUCCESS;
+}
+
+static int Replay_NameCompare(const void *a, const void *b) {
+    return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+// 재생 루트로 준 경로 (root_len 자리에 넘기면 루트 기준 상대 경로 길이를 여기서 정한다)
+#define REPLAY_ROOT SIZE_MAX
+
+static int32_t Replay_AddPath(ReplayRun_t *run, const char *path, size_t root_len);
+
+static int32_t Replay_AddDirectory(ReplayRun_t *run, const char *dir, size_t root_len) {
+    DIR *d = opendir(dir);
+    if (!d) {
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    // 보고서 순서를 재현 가능하게 하기 위해 이름순 정렬
+    char **names = NULL;
+    size_t n = 0, capacity = 0;
+    struct dirent *entry;
+    int32_t status = CFE_SUCCESS;
+
+    while ((entry = readdir(d)) != NULL) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        if (n == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            char **p = realloc(names, capacity * sizeof(char *));
+            if (!p) {
+                status = CFS_MM_ERROR_RESOURCE_LIMIT;
+                break;
+            }
+            names = p;
+        }
+        size_t len = strlen(dir) + strlen(entry->d_name) + 2;
+        names[n] = malloc(len);
+        if (!names[n]) {
+            status = CFS_MM_ERROR_RESOURCE_LIMIT;
+            break;
+        }
+        snprintf(names[n], len, "%s/%s", dir, entry->d_name);
+        n++;
+    }
+    closedir(d);
+
+    qsort(names, n, sizeof(char *), Replay_NameCompare);
+    for (size_t i = 0; i < n; i++) {
+        if (status == CFE_SUCCESS) {
+            status = Replay_AddPath(run, names[i], root_len);
+        }
+        free(names[i]);
+    }
+    free(names);
+    return status;
+}
+
+/*
+ * root_len: 입력 이름에서 잘라낼 재생 루트 접두 길이
+ *   디렉토리 루트는 그 아래 경로, 파일 루트는 파일 이름 부분이 비교 키가 된다.
+ */
+static int32_t Replay_AddPath(ReplayRun_t *run, const char *path, size_t root_len) {
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        fprintf(stderr, "Cannot access input: %s\n", path);
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    if (S_ISDIR(st.st_mode)) {
+        return Replay_AddDirectory(run, path, root_len == REPLAY_ROOT ? strlen(path) + 1 : root_len);
+    }
+    if (!S_ISREG(st.st_mode)) {
+        return CFE_SUCCESS;
+    }
+
+    if (CFS_CorpusPack_IsPackFile(path)) {
+        if (run->pack_count >= REPLAY_MAX_PACKS) {
+            return CFS_MM_ERROR_RESOURCE_LIMIT;
+        }
+        CFS_CorpusPack_t *pack = &run->packs[run->pack_count];
+        int32_t status = CFS_CorpusPack_Open(pack, path);
+        if (status != CFE_SUCCESS) {
+            fprintf(stderr, "Failed to open corpus pack: %s (status %d)\n", path, status);
+            return status;
+        }
+        run->pack_count++;
+
+        for (uint32_t i = 0; i < CFS_CorpusPack_Count(pack) && status == CFE_SUCCESS; i++) {
+            const uint8_t *data;
+            size_t size;
+            CFS_CorpusPack_Get(pack, i, &data, &size);
+            status = Replay_AddItem(run, (char *)CFS_CorpusPack_GetName(pack, i), 0, data, size, FALSE);
+        }
+        return status;
+    }
+
+    char *name = strdup(path);
+    if (!name) {
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+    if (root_len == REPLAY_ROOT) {
+        const char *slash = strrchr(name, '/');
+        root_len = slash ? (size_t)(slash - name) + 1 : 0;
+    }
+    return Replay_AddItem(run, name, root_len, NULL, (size_t)st.st_size, TRUE);
+}
+
+// 목록 파일의 각 줄을 입력 경로로 추가 (빈 줄 무시)
+static int32_t Replay_AddList(ReplayRun_t *run, const char *list_path) {
+    FILE *f = fopen(list_path, "r");
+    if (!f) {
+        fprintf(stderr, "Cannot open input list: %s\n", list_path);
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    char *line = NULL;
+    size_t capacity = 0;
+    ssize_t length;
+    int32_t status = CFE_SUCCESS;
+    while (status == CFE_SUCCESS && (length = getline(&line, &capacity, f)) >= 0) {
+        while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r')) {
+            line[--length] = '\0';
+        }
+        if (length > 0) {
+            status = Replay_AddPath(run, line, REPLAY_ROOT);
+        }
+    }
+    free(line);
+    fclose(f);
+    return status;
+}
+
+/*
+ * 파일 입력 읽기 (워커별 버퍼 재사용)
+ */
+static boolean Replay_ReadFile(const char *path, uint8_t **buffer, size_t *capacity, size_t *size) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return FALSE;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return FALSE;
+    }
+
+    size_t want = (size_t)st.st_size;
+    if (want + 1 > *capacity) {
+        uint8_t *p = realloc(*buffer, want + 1);
+        if (!p) {
+            close(fd);
+            return FALSE;
+        }
+        *buffer = p;
+        *capacity = want + 1;
+    }
+
+    size_t got = 0;
+    while (got < want) {
+        ssize_t r = read(fd, *buffer + got, want - got);
+        if (r < 0 && errno == EINTR) {
+            continue;
+        }
+        if (r <= 0) {
+            break;
+        }
+        got += (size_t)r;
+    }
+    close(fd);
+
+    *size = got;
+    return got == want;
+}
+
+/*
+ * 작업 큐: 자기 큐 앞에서 배치 단위로 가져오고, 비면 다른 큐 뒤쪽 절반을 훔친다
+ */
+static boolean Replay_TakeBatch(ReplayRun_t *run, uint32_t id, size_t *lo, size_t *hi) {
+    ReplayQueue_t *own = &run->queues[id];
+
+    pthread_mutex_lock(&own->lock);
+    if (own->lo < own->hi) {
+        *lo = own->lo;
+        *hi = (own->hi - own->lo > REPLAY_BATCH_SIZE) ? own->lo + REPLAY_BATCH_SIZE : own->hi;
+        own->lo = *hi;
+        pthread_mutex_unlock(&own->lock);
+        return TRUE;
+    }
+    pthread_mutex_unlock(&own->lock);
+
+    for (uint32_t k = 1; k < run->threads; k++) {
+        ReplayQueue_t *victim = &run->queues[(id + k) % run->threads];
+        size_t stolen_lo = 0, stolen_hi = 0;
+
+        pthread_mutex_lock(&victim->lock);
+        size_t remaining = victim->hi - victim->lo;
+        if (remaining > 0) {
+            size_t take = (remaining + 1) / 2;
+            stolen_hi = victim->hi;
+            stolen_lo = victim->hi - take;
+            victim->hi = stolen_lo;
+        }
+        pthread_mutex_unlock(&victim->lock);
+
+        if (stolen_hi > stolen_lo) {
+            pthread_mutex_lock(&own->lock);
+            own->lo = stolen_lo;
+            own->hi = stolen_hi;
+            pthread_mutex_unlock(&own->lock);
+            return Replay_TakeBatch(run, id, lo, hi);
+        }
+    }
+    return FALSE;
+}
+
+static void* Replay_Worker(void *arg) {
+    ReplayWorker_t *worker = (ReplayWorker_t *)arg;
+    ReplayRun_t *run = worker->run;
+    uint8_t *buffer = NULL;
+    size_t capacity = 0;
+    size_t lo, hi;
+
+    t_worker_id = (int)worker->id;
+
+    while (Replay_TakeBatch(run, worker->id, &lo, &hi)) {
+        for (size_t idx = lo; idx < hi; idx++) {
+            ReplayItem_t *item = &run->items[idx];
+            const uint8_t *data = item->data;
+            size_t size = item->size;
+
+            if (!data) {
+                if (!Replay_ReadFile(item->name, &buffer, &capacity, &size)) {
+                    run->status[idx] = CFS_MM_ERROR_FILE_ACCESS;
+                    run->elapsed_ns[idx] = UINT64_MAX;
+                    continue;
+                }
+                item->size = size;
+                data = buffer;
+            }
+
+            run->current[worker->id] = idx;
+            t_worker_data = data;
+            t_worker_size = size;
+            uint64_t start = Replay_NowNs();
+            run->status[idx] = run->target(data, size);
+            run->elapsed_ns[idx] = Replay_NowNs() - start;
+            t_worker_data = NULL;
+            run->virtual_ns[idx] = CFS_VClock_InputNs();
+            run->current[worker->id] = SIZE_MAX;
+        }
+    }
+
+    free(buffer);
+    return NULL;
+}
+
+// 만든 스레드의 진입점: 워커 0 은 호출 스레드에서 돌고 종료 후 통계 출력이 그 상태를 읽으므로 제외
+static void* Replay_Thread(void *arg) {
+    Replay_Worker(arg);
+    CFS_Replay_ReleaseThread();
+    return NULL;
+}
+
+/*
+ * 기준 보고서 (name,size,status,ns[,virtual_ns]) 로드: 이름 -> 상태
+ * 보고서 이름은 이전 실행의 전체 경로이고 그때의 재생 루트는 알 수 없으므로,
+ * 입력의 루트 기준 상대 경로가 이름 끝의 경로 성분과 일치하는 항목을 찾는다.
+ */
+typedef struct {
+    uint64_t hash;              // 파일 이름 부분의 해시
+    char    *name;              // 보고서의 입력 이름 (소유)
+    int32_t  status;
+    boolean  used;
+} ReplayBaselineSlot_t;
+
+/*
+ * 디렉토리/팩 어느 쪽으로 재생해도 같은 슬롯 사슬에 들어가도록 파일 이름 부분만 해시
+ */
+static uint64_t Replay_HashName(const char *name) {
+    const char *slash = strrchr(name, '/');
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    if (slash) {
+        name = slash + 1;
+    }
+    for (; *name; name++) {
+        hash ^= (uint8_t)*name;
+        hash *= 0x100000001B3ULL;
+    }
+    return hash ? hash : 1;
+}
+
+static void Replay_FreeBaseline(ReplayBaselineSlot_t *table, size_t slots) {
+    if (!table) {
+        return;
+    }
+    for (size_t i = 0; i < slots; i++) {
+        free(table[i].name);
+    }
+    free(table);
+}
+
+static ReplayBaselineSlot_t* Replay_LoadBaseline(const char *path, size_t *slot_count) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        return NULL;
+    }
+
+    size_t lines = 0;
+    int c;
+    while ((c = fgetc(fp)) != EOF) {
+        lines += (c == '\n');
+    }
+    rewind(fp);
+
+    size_t slots = 64;
+    while (slots < lines * 2) {
+        slots *= 2;
+    }
+    ReplayBaselineSlot_t *table = calloc(slots, sizeof(ReplayBaselineSlot_t));
+    if (!table) {
+        fclose(fp);
+        return NULL;
+    }
+
+    // 이름 뒤 필드 수는 헤더로 판단 (가상 시간 열이 없는 이전 보고서도 읽음)
+    char line[4096];
+    int fields = 3;
+    if (fgets(line, sizeof(line), fp) && strncmp(line, "name,", 5) == 0) {
+        fields = 0;
+        for (const char *p = line; *p; p++) {
+            fields += (*p == ',');
+        }
+        fields = (fields < 3) ? 3 : (fields > 4) ? 4 : fields;
+    } else {
+        rewind(fp);
+    }
+
+    while (fgets(line, sizeof(line), fp)) {
+        // 이름에 ',' 가 있을 수 있으므로 뒤에서부터 필드 분리
+        char *f[4];
+        int k;
+        for (k = fields - 1; k >= 0; k--) {
+            f[k] = strrchr(line, ',');
+            if (!f[k]) {
+                break;
+            }
+            *f[k]++ = '\0';
+        }
+        if (k >= 0 || strcmp(line, "name") == 0) {
+            continue;
+        }
+
+        // 같은 파일 이름의 다른 경로는 별도 슬롯, 같은 이름이 다시 나오면 나중 줄로 갱신
+        uint64_t hash = Replay_HashName(line);
+        size_t pos = hash & (slots - 1);
+        while (table[pos].used && !(table[pos].hash == hash && strcmp(table[pos].name, line) == 0)) {
+            pos = (pos + 1) & (slots - 1);
+        }
+        if (!table[pos].used) {
+            table[pos].name = strdup(line);
+            if (!table[pos].name) {
+                Replay_FreeBaseline(table, slots);
+                fclose(fp);
+                return NULL;
+            }
+        }
+        table[pos].hash = hash;
+        table[pos].status = (int32_t)strtol(f[1], NULL, 10);
+        table[pos].used = TRUE;
+    }
+    fclose(fp);
+
+    *slot_count = slots;
+    return table;
+}
+
+// key 가 name 과 같거나 name 의 마지막 경로 성분들과 같은지
+static boolean Replay_KeyMatches(const char *name, const char *key) {
+    size_t name_len = strlen(name);
+    size_t key_len = strlen(key);
+    if (key_len > name_len || strcmp(name + name_len - key_len, key) != 0) {
+        return FALSE;
+    }
+    return key_len == name_len || name[name_len - key_len - 1] == '/';
+}
+
+/*
+ * 루트 기준 상대 경로 key 와 일치하는 기준 항목 (없거나 둘 이상이면 NULL)
+ */
+static const ReplayBaselineSlot_t* Replay_FindBaseline(const ReplayBaselineSlot_t *table,
+                                                       size_t slots, const char *key) {
+    uint64_t hash = Replay_HashName(key);
+    size_t pos = hash & (slots - 1);
+    const ReplayBaselineSlot_t *found = NULL;
+    while (table[pos].used) {
+        if (table[pos].hash == hash && Replay_KeyMatches(table[pos].name, key)) {
+            if (found) {
+                return NULL;
+            }
+            found = &table[pos];
+        }
+        pos = (pos + 1) & (slots - 1);
+    }
+    return found;
+}
+
+/*
+ * 재생 실행
+ */
+int32_t CFS_Replay_Run(const char * const *paths, int path_count, CFS_ReplayTarget_t target,
+                       const CFS_ReplayOptions_t *options, CFS_ReplaySummary_t *summary) {
+    if (!paths || !target || !options || !summary) {
+        return OS_INVALID_POINTER;
+    }
+
+    memset(summary, 0, sizeof(*summary));
+
+    ReplayRun_t *run = calloc(1, sizeof(ReplayRun_t));
+    if (!run) {
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+    run->target = target;
+
+    int32_t status = CFE_SUCCESS;
+    for (int i = 0; i < path_count && status == CFE_SUCCESS; i++) {
+        status = Replay_AddPath(run, paths[i], REPLAY_ROOT);
+    }
+    if (status == CFE_SUCCESS && options->list_path) {
+        status = Replay_AddList(run, options->list_path);
+    }
+
+    uint32_t threads = options->threads;
+    if (threads == 0) {
+        long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = ncpu > 0 ? (uint32_t)ncpu : 1;
+    }
+    if (threads > REPLAY_MAX_THREADS) {
+        threads = REPLAY_MAX_THREADS;
+    }
+    if (run->count > 0 && threads > run->count) {
+        threads = (uint32_t)run->count;
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+    run->threads = threads;
+
+    if (status == CFE_SUCCESS) {
+        run->status = calloc(run->count ? run->count : 1, sizeof(int32_t));
+        run->elapsed_ns = calloc(run->count ? run->count : 1, sizeof(uint64_t));
+        run->virtual_ns = calloc(run->count ? run->count : 1, sizeof(uint64_t));
+        run->queues = calloc(threads, sizeof(ReplayQueue_t));
+        if (!run->status || !run->elapsed_ns || !run->virtual_ns || !run->queues) {
+            status = CFS_MM_ERROR_RESOURCE_LIMIT;
+        }
+    }
+
+    if (status == CFE_SUCCESS) {
+        // 초기 분배: 연속 구간으로 균등 분할
+        for (uint32_t t = 0; t < threads; t++) {
+            pthread_mutex_init(&run->queues[t].lock, NULL);
+            run->queues[t].lo = run->count * t / threads;
+            run->queues[t].hi = run->count * (t + 1) / threads;
+            run->current[t] = SIZE_MAX;
+        }
+
+        g_replay_run = run;
+        Replay_InstallCrashHandlers();
+
+        ReplayWorker_t workers[REPLAY_MAX_THREADS];
+        pthread_t tids[REPLAY_MAX_THREADS];
+        uint64_t wall_start = Replay_NowNs();
+
+        // 만들지 못한 워커의 큐는 나머지 워커 (최소한 호출 스레드) 가 훔쳐 간다
+        boolean started[REPLAY_MAX_THREADS] = { FALSE };
+        uint32_t failed = 0;
+        for (uint32_t t = 1; t < threads; t++) {
+            workers[t].run = run;
+            workers[t].id = t;
+            started[t] = (pthread_create(&tids[t], NULL, Replay_Thread, &workers[t]) == 0);
+            if (!started[t]) {
+                failed++;
+            }
+        }
+        if (failed > 0) {
+            fprintf(stderr, "Cannot start %u of %u replay threads, continuing with fewer\n",
+                    failed, threads - 1);
+        }
+        workers[0].run = run;
+        workers[0].id = 0;
+        Replay_Worker(&workers[0]);
+        for (uint32_t t = 1; t < threads; t++) {
+            if (started[t]) {
+                pthread_join(tids[t], NULL);
+            }
+        }
+
+        summary->wall_ns = Replay_NowNs() - wall_start;
+        g_replay_run = NULL;
+        for (uint32_t t = 0; t < threads; t++) {
+            pthread_mutex_destroy(&run->queues[t].lock);
+        }
+    }
+
+    // 결과 집계 및 보고서
+    FILE *report = NULL;
+    if (status == CFE_SUCCESS && options->report_path) {
+        report = fopen(options->report_path, "w");
+        if (report) {
+            fprintf(report, "name,size,status,ns,virtual_ns\n");
+        } else {
+            fprintf(stderr, "Cannot write report: %s\n", options->report_path);
+        }
+    }
+
+    ReplayBaselineSlot_t *baseline = NULL;
+    size_t baseline_slots = 0;
+    if (status == CFE_SUCCESS && options->baseline_path) {
+        baseline = Replay_LoadBaseline(options->baseline_path, &baseline_slots);
+        if (!baseline) {
+            fprintf(stderr, "Cannot read baseline: %s\n", options->baseline_path);
+        }
+    }
+
+    for (size_t i = 0; status == CFE_SUCCESS && i < run->count; i++) {
+        const ReplayItem_t *item = &run->items[i];
+        int32_t rc = run->status[i];
+
+        if (run->elapsed_ns[i] == UINT64_MAX) {
+            summary->unreadable++;
+            fprintf(stderr, "Cannot read input: %s\n", item->name);
+            continue;
+        }
+
+        summary->inputs++;
+        summary->bytes += item->size;
+        summary->total_ns += run->elapsed_ns[i];
+        if (run->elapsed_ns[i] >= summary->max_ns) {
+            summary->max_ns = run->elapsed_ns[i];
+            summary->slowest = item->name;
+        }
+        summary->total_virtual_ns += run->virtual_ns[i];
+        if (run->virtual_ns[i] > summary->max_virtual_ns) {
+            summary->max_virtual_ns = run->virtual_ns[i];
+        }
+        if (rc == CFS_REPLAY_STATUS_REJECTED) {
+            summary->rejected++;
+        } else if (rc != CFE_SUCCESS) {
+            summary->errors++;
+        }
+
+        if (options->verbose) {
+            printf("%-48s size=%-6zu status=%-6d time=%.3fus\n", item->name, item->size, rc,
+                   run->elapsed_ns[i] / 1000.0);
+        }
+        if (report) {
+            fprintf(report, "%s,%zu,%d,%lu,%lu\n", item->name, item->size, rc, run->elapsed_ns[i],
+                    run->virtual_ns[i]);
+        }
+        if (baseline) {
+            const ReplayBaselineSlot_t *slot = Replay_FindBaseline(baseline, baseline_slots, item->key);
+            if (slot && slot->status != rc) {
+                summary->regressions++;
+                printf("REGRESSION: %s status %d -> %d\n", item->name, slot->status, rc);
+            }
+        }
+    }
+
+    if (report) {
+        fclose(report);
+    }
+    Replay_FreeBaseline(baseline, baseline_slots);
+
+    // 요약의 slowest 는 items 이름을 가리키므로 복사해 둔다
+    static char slowest_name[4096];
+    if (summary->slowest) {
+        snprintf(slowest_name, sizeof(slowest_name), "%s", summary->slowest);
+        summary->slowest = slowest_name;
+    }
+
+    for (size_t i = 0; i < run->count; i++) {
+        if (run->items[i].owns_name) {
+            free(run->items[i].name);
+        }
+    }
+    for (uint32_t p = 0; p < run->pack_count; p++) {
+        CFS_CorpusPack_Close(&run->packs[p]);
+    }
+    free(run->items);
+    free(run->status);
+    free(run->elapsed_ns);
+    free(run->virtual_ns);
+    free(run->queues);
+    free(run);
+    return status;
+}
+
+void CFS_Replay_SetThreadRelease(CFS_ReplayThreadRelease_t release) {
+    g_thread_release = release;
+}
+
+void CFS_Replay_ReleaseThread(void) {
+    // 하네스 상태 (스냅샷 등) 가 아래 모듈 상태를 가리킬 수 있으므로 먼저
+    if (g_thread_release) {
+        g_thread_release();
+    }
+    CFS_SnapshotCache_Clear();
+    CFS_SimMem_Release();
+    CFS_SymCache_Release();
+    CFS_MockTrace_Release();
+    CFS_Eeprom_Release();
+    CFS_Vfs_Clear();
+    CFS_Diff_Release();
+}
+
+void CFS_Replay_PrintSummary(const CFS_ReplaySummary_t *summary) {
+    if (!summary) {
+        return;
+    }
+
+    double wall_sec = summary->wall_ns / 1e9;
+
+    printf("\n=== CFS Replay Summary ===\n");
+    printf("Inputs: %lu (%lu bytes)\n", summary->inputs, summary->bytes);
+    printf("Success: %lu\n", summary->inputs - summary->errors - summary->rejected);
+    printf("Errors: %lu\n", summary->errors);
+    printf("Rejected: %lu\n", summary->rejected);
+    if (summary->unreadable > 0) {
+        printf("Unreadable: %lu\n", summary->unreadable);
+    }
+    if (summary->regressions > 0) {
+        printf("Regressions: %lu\n", summary->regressions);
+    }
+    printf("Wall Time: %.3f sec\n", wall_sec);
+    printf("Throughput: %.0f inputs/sec\n", wall_sec > 0 ? summary->inputs / wall_sec : 0.0);
+    printf("Mean Exec: %.3f us\n",
+           summary->inputs > 0 ? summary->total_ns / 1000.0 / summary->inputs : 0.0);
+    if (summary->slowest) {
+        printf("Slowest: %.3f us (%s)\n", summary->max_ns / 1000.0, summary->slowest);
+    }
+    if (summary->total_virtual_ns > 0) {
+        printf("Mean Virtual: %.3f ms (max %.3f ms)\n",
+               summary->total_virtual_ns / 1e6 / summary->inputs, summary->max_virtual_ns / 1e6);
+    }
+    printf("==========================\n\n");
+}
+
+static void Replay_Usage(const char *prog) {
+    printf("Usage: %s [-j N | -threads=N] [-v] [-report=FILE] [-baseline=FILE] [-list=FILE] <file|dir|pack>...\n", prog);
+}
+
+/*
+ * 명령행 진입점
+ */
+int CFS_Replay_Main(int argc, char **argv, CFS_ReplayTarget_t target) {
+    CFS_ReplayOptions_t options;
+    memset(&options, 0, sizeof(options));
+
+    const char **paths = calloc((size_t)argc, sizeof(char *));
+    int path_count = 0;
+    if (!paths) {
+        return 2;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strcmp(arg, "-j") == 0 && i + 1 < argc) {
+            options.threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strncmp(arg, "-threads=", 9) == 0) {
+            options.threads = (uint32_t)strtoul(arg + 9, NULL, 10);
+        } else if (strcmp(arg, "-v") == 0) {
+            options.verbose = TRUE;
+        } else if (strncmp(arg, "-report=", 8) == 0) {
+            options.report_path = arg + 8;
+        } else if (strncmp(arg, "-baseline=", 10) == 0) {
+            options.baseline_path = arg + 10;
+        } else if (strncmp(arg, "-list=", 6) == 0) {
+            options.list_path = arg + 6;
+        } else if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            Replay_Usage(argv[0]);
+            free(paths);
+            return 0;
+        } else if (arg[0] == '-') {
+            fprintf(stderr, "Unknown option: %s\n", arg);
+            Replay_Usage(argv[0]);
+            free(paths);
+            return 2;
+        } else {
+            paths[path_count++] = arg;
+        }
+    }
+
+    if (path_count == 0 && !options.list_path) {
+        Replay_Usage(argv[0]);
+        free(paths);
+        return 2;
+    }
+
+    CFS_ReplaySummary_t summary;
+    int32_t status = CFS_Replay_Run(paths, path_count, target, &options, &summary);
+    free(paths);
+
+    if (status != CFE_SUCCESS) {
+        fprintf(stderr, "Replay failed (status %d)\n", status);
+        return 1;
+    }
+
+    CFS_Replay_PrintSummary(&summary);
+    return (summary.unreadable > 0 || summary.regressions > 0) ? 1 : 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * CFS 배치 재생(replay) 러너 헤더
+ * 파일/디렉토리/코퍼스 팩 입력을 프로세스 내에서 N 스레드로 재생하고
+ * 입력별 상태 코드, 소요 시간, sanitizer 실패를 보고한다.
+ */
+
+#ifndef CFS_REPLAY_H
+#define CFS_REPLAY_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+// 패킷 생성 실패 등으로 대상 함수까지 도달하지 못한 입력
+#define CFS_REPLAY_STATUS_REJECTED  (-1000)
+
+// 차분 모드에서 참조 구현과 결과가 달랐던 입력
+#define CFS_REPLAY_STATUS_DIVERGED  (-1001)
+
+// EEPROM 한 페이지를 입력당 한도보다 많이 프로그램한 입력 (eeprom.h)
+#define CFS_REPLAY_STATUS_WEAR      (-1002)
+
+// 시뮬레이션 메모리 접근이 영역 경계나 권한을 어긴 입력 (target_san.h)
+#define CFS_REPLAY_STATUS_TARGET_SAN (-1003)
+
+// 재생 대상 (입력 하나를 실행하고 시뮬레이션 상태 코드를 반환)
+typedef int32_t (*CFS_ReplayTarget_t)(const uint8_t *data, size_t size);
+
+// 하네스 고유 스레드 상태 해제 (예: 시퀀스 모드 루트 스냅샷)
+typedef void (*CFS_ReplayThreadRelease_t)(void);
+
+// 재생 옵션
+typedef struct {
+    uint32_t    threads;            // 워커 스레드 수 (0 = CPU 수)
+    boolean     verbose;            // 입력별 결과 출력
+    const char *report_path;        // 입력별 CSV 보고서 (name,size,status,ns,virtual_ns)
+    const char *baseline_path;      // 이전 보고서와 상태 코드 비교 (재생 루트 기준 상대 경로로 대응)
+    const char *list_path;          // 입력 경로 목록 파일 (한 줄에 하나, 인수 길이 제한 없이 대량 재생)
+} CFS_ReplayOptions_t;
+
+// 재생 요약
+typedef struct {
+    uint64_t inputs;                // 재생한 입력 수
+    uint64_t bytes;                 // 전체 입력 바이트
+    uint64_t rejected;              // CFS_REPLAY_STATUS_REJECTED 수
+    uint64_t errors;                // 0 이 아닌 상태 코드 수 (rejected 제외)
+    uint64_t unreadable;            // 읽을 수 없었던 파일 수
+    uint64_t regressions;           // 기준 보고서와 상태가 달라진 입력 수
+    uint64_t total_ns;              // 입력 실행 시간 합계
+    uint64_t max_ns;                // 가장 느린 입력 시간
+    uint64_t wall_ns;               // 전체 경과 시간
+    uint64_t total_virtual_ns;      // 입력별 가상 시간 합계 (vclock.h)
+    uint64_t max_virtual_ns;        // 가장 긴 입력 가상 시간
+    const char *slowest;            // 가장 느린 입력 이름
+} CFS_ReplaySummary_t;
+
+/*
+ * 명령행 인수 파싱 후 재생 실행
+ *   [-j N | -threads=N] [-v] [-report=FILE] [-baseline=FILE] [-list=FILE] <file|dir|pack>...
+ * 반환값: 0 = 성공, 1 = 읽기 실패 또는 회귀 발견, 2 = 인수 오류
+ */
+int CFS_Replay_Main(int argc, char **argv, CFS_ReplayTarget_t target);
+
+// 옵션을 직접 지정하여 재생
+int32_t CFS_Replay_Run(const char * const *paths, int path_count, CFS_ReplayTarget_t target,
+                       const CFS_ReplayOptions_t *options, CFS_ReplaySummary_t *summary);
+
+void CFS_Replay_PrintSummary(const CFS_ReplaySummary_t *summary);
+
+// 하네스 해제 훅 등록 (워커 시작 전에만, NULL = 없음)
+void CFS_Replay_SetThreadRelease(CFS_ReplayThreadRelease_t release);
+
+/*
+ * 워커 스레드 종료 직전 정리 (재생/퍼징 워커가 만든 스레드에서만 호출)
+ * 하네스 훅을 먼저 부른 뒤 스냅샷 캐시, 시뮬레이션 메모리 아레나, 심볼 캐시,
+ * Mock 기록 버퍼, EEPROM 뱅크, VFS, 차분 작업 버퍼를 해제한다.
+ * 다음 입력이 오면 각 모듈이 다시 할당하므로 호출 뒤에도 실행은 가능하다.
+ */
+void CFS_Replay_ReleaseThread(void);
+
+#endif // CFS_REPLAY_H
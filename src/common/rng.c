@@ -0,0 +1,47 @@
+/*
+ * CFS 의사 난수 생성기
+ */
+
+#include <string.h>
+
+#include "rng.h"
+
+static uint64_t Rng_SplitMix64(uint64_t *x) {
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void CFS_Rng_Seed(CFS_Rng_t *rng, uint64_t seed) {
+    // splitmix64 출력은 네 값이 모두 0 일 수 없으므로 xoshiro 의 금지 상태를 피한다
+    for (int i = 0; i < 4; i++) {
+        rng->s[i] = Rng_SplitMix64(&seed);
+    }
+}
+
+// 값 하나를 리틀엔디언 바이트로 저장
+static inline void Rng_Store(uint8_t *out, uint64_t value, size_t size) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(out, &value, size);
+#else
+    for (size_t i = 0; i < size; i++) {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+#endif
+}
+
+void CFS_Rng_Fill(CFS_Rng_t *rng, void *buffer, size_t size) {
+    uint8_t *out = buffer;
+    size_t i = 0;
+
+    if (!out) {
+        return;
+    }
+    for (; i + 8 <= size; i += 8) {
+        Rng_Store(out + i, CFS_Rng_Next(rng), 8);
+    }
+    if (i < size) {
+        Rng_Store(out + i, CFS_Rng_Next(rng), size - i);
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * CFS 의사 난수 생성기 헤더
+ * 호출자마다 상태를 따로 가지는 xoshiro256** (시드는 splitmix64 로 펼침).
+ * libc srand/rand 와 달리 전역 상태를 건드리지 않아 스레드마다 하나씩 둘 수 있고,
+ * 같은 시드는 플랫폼과 무관하게 같은 값/바이트열을 낸다 (Fill 은 리틀엔디언 바이트 순서).
+ * 암호용이 아니다.
+ */
+
+#ifndef CFS_RNG_H
+#define CFS_RNG_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+typedef struct {
+    uint64_t s[4];
+} CFS_Rng_t;
+
+// 64 비트 시드로 상태 초기화 (모든 시드 허용, 0 포함)
+void CFS_Rng_Seed(CFS_Rng_t *rng, uint64_t seed);
+
+static inline uint64_t CFS_Rng_Rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static inline uint64_t CFS_Rng_Next(CFS_Rng_t *rng) {
+    uint64_t *s = rng->s;
+    const uint64_t result = CFS_Rng_Rotl(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = CFS_Rng_Rotl(s[3], 45);
+    return result;
+}
+
+// [0, n) 범위 값 (상위 32 비트의 곱셈-시프트, 나눗셈 없음)
+static inline uint32_t CFS_Rng_Below(CFS_Rng_t *rng, uint32_t n) {
+    return (uint32_t)(((CFS_Rng_Next(rng) >> 32) * n) >> 32);
+}
+
+// size 바이트를 8 바이트 단위로 채움 (꼬리는 값 하나의 앞 바이트)
+void CFS_Rng_Fill(CFS_Rng_t *rng, void *buffer, size_t size);
+
+#endif // CFS_RNG_H
@@ -0,0 +1,572 @@
+/*
+ * CFS 시뮬레이션 타겟 메모리
+ *
+ * 각 메모리 영역은 스레드별로 첫 접근 시 아레나 (arena.h) 로 예약된다 (큰 영역은 휴지페이지).
+ * 쓰기 전에 걸친 배치를 한 번에 미리 폴트하므로 실제로 쓴 배치만 물리 메모리를 사용한다.
+ * 저널이 켜져 있으면 쓰기 전에 이전 내용을 undo 버퍼에 보관한다.
+ *
+ * 페이지 추적 (영역별 비트맵)
+ *   touched - 내용이 0 이 아닐 수 있는 페이지 (쓰기 또는 이미지 복원)
+ *   dirty   - 마지막 이미지 캡처/복원(기준 이미지) 이후 쓴 페이지
+ * 기준 이미지로 되돌릴 때는 dirty 페이지만 복사하므로 비용이
+ * 실행 중에 실제로 바뀐 메모리 양에 비례한다. Reset 은 touched 페이지의 연속 구간만
+ * 0 으로 지우고 매핑은 유지하므로, 다음 입력이 같은 곳을 다시 폴트하지 않는다.
+ *
+ * EEPROM 영역 쓰기는 먼저 장치 모델 (eeprom.h) 을 거친다 (뱅크 쓰기 허용, 페이지 프로그램 기록).
+ * 읽기/쓰기/채우기/로드는 타겟 메모리 sanitizer (target_san.h) 로 영역 경계와 권한을 검사한다.
+ * 구간 단위 채우기/로드는 구간 사이마다 MM_PROCESSOR_CYCLE 만큼 가상 시간을 흘린다.
+ */
+
+#define _GNU_SOURCE
+
+#include "sim_mem.h"
+#include "arena.h"
+#include "eeprom.h"
+#include "fill.h"
+#include "mission.h"
+#include "mm_types.h"
+#include "target_san.h"
+
+#define SIM_MEM_PAGE_SHIFT      12
+#define SIM_MEM_PAGE_SIZE       (1u << SIM_MEM_PAGE_SHIFT)
+#define SIM_MEM_KEY(region, page)   (((uint32_t)(region) << 24) | (uint32_t)(page))
+
+// 캡처된 메모리 이미지 (touched 페이지 내용, 키 오름차순)
+struct CFS_SimMemImage {
+    uint32_t  page_count;
+    uint32_t *keys;
+    uint8_t  *data;
+};
+
+typedef struct {
+    CFS_Arena_t       arenas[CFS_MISSION_MAX_REGIONS];
+    uint64_t         *touched[CFS_MISSION_MAX_REGIONS];
+    uint64_t         *dirty[CFS_MISSION_MAX_REGIONS];
+    const CFS_SimMemImage_t *baseline;
+    boolean           journal_active;
+    uint32_t          journal_count;
+    uint32_t          journal_capacity;
+    CFS_SimMemWrite_t *journal;
+    uint8_t          *undo;
+    size_t            undo_used;
+    size_t            undo_capacity;
+    CFS_SimMemStats_t stats;
+} SimMem_t;
+
+static CFS_THREAD_LOCAL SimMem_t t_sim_mem;
+
+static size_t SimMem_RegionSize(const CFS_MemoryRegion_t *region) {
+    return (size_t)(region->end_addr - region->start_addr + 1);
+}
+
+// 영역 끝의 부분 페이지도 비트 하나를 받는다
+static size_t SimMem_BitmapWords(size_t region_index) {
+    size_t size = SimMem_RegionSize(&CFS_Mission_Get()->regions[region_index]);
+    size_t pages = (size + SIM_MEM_PAGE_SIZE - 1) >> SIM_MEM_PAGE_SHIFT;
+    return (pages + 63) / 64;
+}
+
+// 페이지의 실제 바이트 수 (마지막 부분 페이지는 영역 끝까지)
+static size_t SimMem_PageBytes(size_t region, uint32_t page) {
+    size_t offset = (size_t)page << SIM_MEM_PAGE_SHIFT;
+    size_t size = t_sim_mem.arenas[region].size;
+    return (size - offset < SIM_MEM_PAGE_SIZE) ? size - offset : SIM_MEM_PAGE_SIZE;
+}
+
+// 영역 호스트 메모리와 페이지 비트맵 (첫 사용 시 할당)
+static uint8_t* SimMem_RegionBase(size_t index) {
+    SimMem_t *mem = &t_sim_mem;
+
+    if (mem->arenas[index].base) {
+        return mem->arenas[index].base;
+    }
+
+    const CFS_MemoryRegion_t *region = &CFS_Mission_Get()->regions[index];
+    CFS_Arena_t arena;
+    if (CFS_Arena_Map(&arena, SimMem_RegionSize(region)) != CFE_SUCCESS) {
+        return NULL;
+    }
+
+    size_t words = SimMem_BitmapWords(index);
+    mem->touched[index] = calloc(words, sizeof(uint64_t));
+    mem->dirty[index] = calloc(words, sizeof(uint64_t));
+    if (!mem->touched[index] || !mem->dirty[index]) {
+        free(mem->touched[index]);
+        free(mem->dirty[index]);
+        mem->touched[index] = NULL;
+        mem->dirty[index] = NULL;
+        CFS_Arena_Unmap(&arena);
+        return NULL;
+    }
+
+    mem->arenas[index] = arena;
+    return arena.base;
+}
+
+uint8_t* CFS_SimMem_Translate(uint64_t addr, uint32_t size) {
+    int index = CFS_Mission_FindRegion(addr, size);
+    if (index < 0) {
+        return NULL;
+    }
+
+    uint8_t *base = SimMem_RegionBase((size_t)index);
+    if (!base) {
+        return NULL;
+    }
+    return base + (addr - CFS_Mission_Get()->regions[index].start_addr);
+}
+
+static void SimMem_MarkDirty(size_t index, uint64_t offset, uint32_t size) {
+    uint64_t *touched = t_sim_mem.touched[index];
+    uint64_t *dirty = t_sim_mem.dirty[index];
+    uint64_t first = offset >> SIM_MEM_PAGE_SHIFT;
+    uint64_t last = (offset + size - 1) >> SIM_MEM_PAGE_SHIFT;
+
+    for (uint64_t page = first; page <= last; page++) {
+        uint64_t bit = 1ULL << (page & 63);
+        touched[page >> 6] |= bit;
+        dirty[page >> 6] |= bit;
+    }
+}
+
+int32_t CFS_SimMem_Read(uint64_t addr, void *dst, uint32_t size) {
+    if (!dst) {
+        return OS_INVALID_POINTER;
+    }
+
+    (void)CFS_TargetSan_Check(addr, size, FALSE);
+    const uint8_t *src = CFS_SimMem_Translate(addr, size);
+    if (!src) {
+        return CFS_MM_ERROR_INVALID_ADDR;
+    }
+
+    memcpy(dst, src, size);
+    return CFE_SUCCESS;
+}
+
+static int32_t SimMem_SaveUndo(uint64_t addr, const uint8_t *old, uint32_t size) {
+    SimMem_t *mem = &t_sim_mem;
+
+    if (mem->journal_count >= mem->journal_capacity) {
+        uint32_t capacity = mem->journal_capacity ? mem->journal_capacity * 2 : 64;
+        CFS_SimMemWrite_t *journal = realloc(mem->journal, capacity * sizeof(*journal));
+        if (!journal) {
+            return CFS_MM_ERROR_RESOURCE_LIMIT;
+        }
+        mem->journal = journal;
+        mem->journal_capacity = capacity;
+    }
+
+    if (mem->undo_used + size > mem->undo_capacity) {
+        size_t capacity = mem->undo_capacity ? mem->undo_capacity : 4096;
+        while (capacity < mem->undo_used + size) {
+            capacity *= 2;
+        }
+        uint8_t *undo = realloc(mem->undo, capacity);
+        if (!undo) {
+            return CFS_MM_ERROR_RESOURCE_LIMIT;
+        }
+        mem->undo = undo;
+        mem->undo_capacity = capacity;
+    }
+
+    CFS_SimMemWrite_t *entry = &mem->journal[mem->journal_count++];
+    entry->addr = addr;
+    entry->size = size;
+    entry->undo_offset = mem->undo_used;
+    memcpy(mem->undo + mem->undo_used, old, size);
+    mem->undo_used += size;
+    return CFE_SUCCESS;
+}
+
+// 쓰기 준비: 영역 확인, EEPROM 프로그램 (chunk = 중단 불가 구간), 미리 폴트, 저널 기록, dirty 표시 후 호스트 포인터 반환
+static int32_t SimMem_PrepareWrite(uint64_t addr, uint32_t size, uint32_t chunk, uint8_t **dst) {
+    int index = CFS_Mission_FindRegion(addr, size);
+    uint8_t *base = (index >= 0) ? SimMem_RegionBase((size_t)index) : NULL;
+    if (!base) {
+        return CFS_MM_ERROR_INVALID_ADDR;
+    }
+
+    const CFS_MemoryRegion_t *region = &CFS_Mission_Get()->regions[index];
+    uint64_t offset = addr - region->start_addr;
+    *dst = base + offset;
+
+    if (region->mem_type == MM_EEPROM) {
+        int32_t status = CFS_Eeprom_Program((size_t)index, offset, size, chunk);
+        if (status != CFE_SUCCESS) {
+            return status;
+        }
+    }
+
+    CFS_Arena_Prefault(&t_sim_mem.arenas[index], (size_t)offset, size);
+    if (t_sim_mem.journal_active) {
+        int32_t status = SimMem_SaveUndo(addr, *dst, size);
+        if (status != CFE_SUCCESS) {
+            return status;
+        }
+    }
+
+    SimMem_MarkDirty((size_t)index, offset, size);
+    return CFE_SUCCESS;
+}
+
+int32_t CFS_SimMem_Write(uint64_t addr, const void *src, uint32_t size) {
+    if (!src) {
+        return OS_INVALID_POINTER;
+    }
+
+    (void)CFS_TargetSan_Check(addr, size, TRUE);
+    uint8_t *dst = NULL;
+    int32_t status = SimMem_PrepareWrite(addr, size, 0, &dst);
+    if (status != CFE_SUCCESS) {
+        return status;
+    }
+
+    memcpy(dst, src, size);
+    return CFE_SUCCESS;
+}
+
+// 비행 코드는 구간 사이마다 OS_TaskDelay(MM_PROCESSOR_CYCLE) 로 양보한다 (가상 시간만 흐름)
+static void SimMem_SegmentBreaks(uint32_t size, uint32_t segment) {
+    if (segment != 0 && size > segment) {
+        CFS_VClock_Advance(CFS_VCLOCK_DELAY,
+                           (uint64_t)((size - 1) / segment) * MM_PROCESSOR_CYCLE * 1000000ULL);
+    }
+}
+
+int32_t CFS_SimMem_Fill(uint64_t addr, uint32_t size, uint32_t pattern, uint32_t segment) {
+    (void)CFS_TargetSan_Check(addr, size, TRUE);
+    uint8_t *dst = NULL;
+    int32_t status = SimMem_PrepareWrite(addr, size, segment, &dst);
+    if (status != CFE_SUCCESS) {
+        return status;
+    }
+
+    // 구간 경계는 비행 코드의 중단 불가 구간과 같고, 위상은 시작점 기준으로 이어진다
+    if (segment == 0) {
+        segment = size;
+    }
+    for (uint32_t done = 0; done < size; done += segment) {
+        uint32_t length = (size - done < segment) ? size - done : segment;
+        CFS_Fill_Pattern32(dst + done, length, pattern, done);
+    }
+    SimMem_SegmentBreaks(size, segment);
+    return CFE_SUCCESS;
+}
+
+int32_t CFS_SimMem_LoadStream(uint64_t addr, const void *src, uint32_t size, uint32_t chunk,
+                              CFS_SimMemLoadMode_t mode, uint32_t expected_crc,
+                              uint32_t *crc_out) {
+    const uint8_t *in = (const uint8_t *)src;
+    uint32_t crc = 0xFFFFFFFF;
+
+    if (!src) {
+        return OS_INVALID_POINTER;
+    }
+    (void)CFS_TargetSan_Check(addr, size, TRUE);
+    if (CFS_Mission_FindRegion(addr, size) < 0) {
+        return CFS_MM_ERROR_INVALID_ADDR;
+    }
+    if (chunk == 0) {
+        chunk = size;
+    }
+
+    // 먼저 확인: CRC 패스만 돌고 불일치면 타겟을 건드리지 않음 (비행 코드와 같은 순서)
+    boolean verify_first = (expected_crc != 0 && mode == CFS_SIMMEM_LOAD_VERIFY_FIRST);
+    if (verify_first) {
+        crc = MM_CalculateCRC32(in, size, crc) ^ 0xFFFFFFFF;
+        if (crc_out) {
+            *crc_out = crc;
+        }
+        if (crc != expected_crc) {
+            return CFS_MM_ERROR_CRC_MISMATCH;
+        }
+    }
+
+    uint8_t *dst = NULL;
+    int32_t status = SimMem_PrepareWrite(addr, size, chunk, &dst);
+    if (status != CFE_SUCCESS) {
+        return status;
+    }
+
+    // 단일 패스: 청크가 캐시에 있는 동안 CRC 누적과 복사를 함께 수행
+    boolean accumulate = (expected_crc != 0 && !verify_first);
+    for (uint32_t done = 0; done < size; done += chunk) {
+        uint32_t length = (size - done < chunk) ? size - done : chunk;
+        if (accumulate) {
+            crc = MM_CalculateCRC32(in + done, length, crc);
+        }
+        memcpy(dst + done, in + done, length);
+    }
+    SimMem_SegmentBreaks(size, chunk);
+
+    if (accumulate) {
+        crc ^= 0xFFFFFFFF;
+        if (crc_out) {
+            *crc_out = crc;
+        }
+        if (crc != expected_crc) {
+            return CFS_MM_ERROR_CRC_MISMATCH;
+        }
+    }
+    return CFE_SUCCESS;
+}
+
+void CFS_SimMem_JournalBegin(void) {
+    t_sim_mem.journal_active = TRUE;
+    t_sim_mem.journal_count = 0;
+    t_sim_mem.undo_used = 0;
+}
+
+void CFS_SimMem_JournalRollback(void) {
+    SimMem_t *mem = &t_sim_mem;
+
+    // 같은 주소에 여러 번 썼을 수 있으므로 역순으로 되돌린다
+    while (mem->journal_count > 0) {
+        const CFS_SimMemWrite_t *entry = &mem->journal[--mem->journal_count];
+        uint8_t *dst = CFS_SimMem_Translate(entry->addr, entry->size);
+        if (dst) {
+            memcpy(dst, mem->undo + entry->undo_offset, entry->size);
+        }
+    }
+    mem->undo_used = 0;
+}
+
+void CFS_SimMem_JournalCommit(void) {
+    t_sim_mem.journal_active = FALSE;
+    t_sim_mem.journal_count = 0;
+    t_sim_mem.undo_used = 0;
+}
+
+uint32_t CFS_SimMem_JournalCount(void) {
+    return t_sim_mem.journal_count;
+}
+
+const CFS_SimMemWrite_t* CFS_SimMem_JournalEntry(uint32_t index) {
+    if (index >= t_sim_mem.journal_count) {
+        return NULL;
+    }
+    return &t_sim_mem.journal[index];
+}
+
+CFS_SimMemImage_t* CFS_SimMem_CaptureImage(void) {
+    SimMem_t *mem = &t_sim_mem;
+    uint32_t count = 0;
+
+    for (size_t i = 0; i < CFS_MISSION_MAX_REGIONS; i++) {
+        if (!mem->touched[i]) {
+            continue;
+        }
+        size_t words = SimMem_BitmapWords(i);
+        for (size_t w = 0; w < words; w++) {
+            count += (uint32_t)__builtin_popcountll(mem->touched[i][w]);
+        }
+    }
+
+    CFS_SimMemImage_t *image = calloc(1, sizeof(*image));
+    if (!image) {
+        return NULL;
+    }
+    if (count > 0) {
+        image->keys = malloc(count * sizeof(uint32_t));
+        image->data = malloc((size_t)count * SIM_MEM_PAGE_SIZE);
+        if (!image->keys || !image->data) {
+            CFS_SimMem_FreeImage(image);
+            return NULL;
+        }
+    }
+
+    uint32_t n = 0;
+    for (size_t i = 0; i < CFS_MISSION_MAX_REGIONS; i++) {
+        if (!mem->touched[i]) {
+            continue;
+        }
+        size_t words = SimMem_BitmapWords(i);
+        for (size_t w = 0; w < words; w++) {
+            uint64_t bits = mem->touched[i][w];
+            while (bits) {
+                uint32_t page = (uint32_t)(w * 64 + (size_t)__builtin_ctzll(bits));
+                bits &= bits - 1;
+                image->keys[n] = SIM_MEM_KEY(i, page);
+                memcpy(image->data + (size_t)n * SIM_MEM_PAGE_SIZE,
+                       mem->arenas[i].base + ((size_t)page << SIM_MEM_PAGE_SHIFT), SimMem_PageBytes(i, page));
+                n++;
+            }
+            mem->dirty[i][w] = 0;
+        }
+    }
+    image->page_count = n;
+
+    mem->baseline = image;
+    mem->stats.captures++;
+    mem->stats.pages_captured += n;
+    return image;
+}
+
+static const uint8_t* SimMem_ImagePage(const CFS_SimMemImage_t *image, uint32_t key) {
+    uint32_t lo = 0;
+    uint32_t hi = image->page_count;
+
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (image->keys[mid] < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo < image->page_count && image->keys[lo] == key) {
+        return image->data + (size_t)lo * SIM_MEM_PAGE_SIZE;
+    }
+    return NULL;
+}
+
+static void SimMem_RestorePage(const CFS_SimMemImage_t *image, size_t region, uint32_t page) {
+    uint8_t *dst = t_sim_mem.arenas[region].base + ((size_t)page << SIM_MEM_PAGE_SHIFT);
+    const uint8_t *src = SimMem_ImagePage(image, SIM_MEM_KEY(region, page));
+    size_t bytes = SimMem_PageBytes(region, page);
+
+    if (src) {
+        memcpy(dst, src, bytes);
+    } else {
+        // 이미지에 없는 페이지는 0 으로 되돌리고 touched 에서도 뺀다
+        memset(dst, 0, bytes);
+        t_sim_mem.touched[region][page >> 6] &= ~(1ULL << (page & 63));
+    }
+    t_sim_mem.stats.pages_restored++;
+}
+
+int32_t CFS_SimMem_RestoreImage(const CFS_SimMemImage_t *image) {
+    SimMem_t *mem = &t_sim_mem;
+
+    if (!image) {
+        return OS_INVALID_POINTER;
+    }
+
+    // 기준 이미지면 dirty 페이지만, 아니면 touched 전체를 이미지와 맞춘다
+    boolean from_baseline = (image == mem->baseline);
+    uint64_t reset_begin = CFS_Arena_ResetBegin();
+    uint64_t pages_before = mem->stats.pages_restored;
+
+    for (size_t i = 0; i < CFS_MISSION_MAX_REGIONS; i++) {
+        if (!mem->arenas[i].base) {
+            continue;
+        }
+        uint64_t *bitmap = from_baseline ? mem->dirty[i] : mem->touched[i];
+        size_t words = SimMem_BitmapWords(i);
+        for (size_t w = 0; w < words; w++) {
+            uint64_t bits = bitmap[w];
+            while (bits) {
+                uint32_t page = (uint32_t)(w * 64 + (size_t)__builtin_ctzll(bits));
+                bits &= bits - 1;
+                SimMem_RestorePage(image, i, page);
+            }
+            mem->dirty[i][w] = 0;
+        }
+    }
+
+    // Release 이후 아직 만지지 않은 페이지에 이미지 내용이 있는 경우
+    if (!from_baseline) {
+        for (uint32_t n = 0; n < image->page_count; n++) {
+            size_t region = image->keys[n] >> 24;
+            uint32_t page = image->keys[n] & 0xFFFFFF;
+            if (!SimMem_RegionBase(region)) {
+                return CFS_MM_ERROR_RESOURCE_LIMIT;
+            }
+            uint64_t bit = 1ULL << (page & 63);
+            if (!(mem->touched[region][page >> 6] & bit)) {
+                mem->touched[region][page >> 6] |= bit;
+                size_t bytes = SimMem_PageBytes(region, page);
+                CFS_Arena_Prefault(&mem->arenas[region], (size_t)page << SIM_MEM_PAGE_SHIFT, bytes);
+                memcpy(mem->arenas[region].base + ((size_t)page << SIM_MEM_PAGE_SHIFT),
+                       image->data + (size_t)n * SIM_MEM_PAGE_SIZE, bytes);
+                mem->stats.pages_restored++;
+            }
+        }
+    }
+
+    mem->baseline = image;
+    mem->stats.restores++;
+    CFS_Arena_ResetEnd(reset_begin, (mem->stats.pages_restored - pages_before) * SIM_MEM_PAGE_SIZE);
+    return CFE_SUCCESS;
+}
+
+size_t CFS_SimMem_ImageBytes(const CFS_SimMemImage_t *image) {
+    return image ? (size_t)image->page_count * (SIM_MEM_PAGE_SIZE + sizeof(uint32_t)) : 0;
+}
+
+void CFS_SimMem_FreeImage(CFS_SimMemImage_t *image) {
+    if (!image) {
+        return;
+    }
+    if (t_sim_mem.baseline == image) {
+        t_sim_mem.baseline = NULL;
+    }
+    free(image->keys);
+    free(image->data);
+    free(image);
+}
+
+const CFS_SimMemStats_t* CFS_SimMem_GetStats(void) {
+    return &t_sim_mem.stats;
+}
+
+void CFS_SimMem_Reset(void) {
+    SimMem_t *mem = &t_sim_mem;
+    uint64_t reset_begin = CFS_Arena_ResetBegin();
+    uint64_t bytes = 0;
+
+    for (size_t i = 0; i < CFS_MISSION_MAX_REGIONS; i++) {
+        if (!mem->arenas[i].base) {
+            continue;
+        }
+        // touched 페이지의 연속 구간마다 한 번씩 지움
+        size_t words = SimMem_BitmapWords(i);
+        size_t run_start = 0;
+        size_t run_pages = 0;
+        for (size_t w = 0; w < words; w++) {
+            uint64_t bits = mem->touched[i][w];
+            while (bits) {
+                size_t page = w * 64 + (size_t)__builtin_ctzll(bits);
+                bits &= bits - 1;
+                if (run_pages > 0 && page == run_start + run_pages) {
+                    run_pages++;
+                    continue;
+                }
+                if (run_pages > 0) {
+                    CFS_Arena_Zero(&mem->arenas[i], run_start << SIM_MEM_PAGE_SHIFT, run_pages << SIM_MEM_PAGE_SHIFT);
+                    bytes += run_pages << SIM_MEM_PAGE_SHIFT;
+                }
+                run_start = page;
+                run_pages = 1;
+            }
+            mem->touched[i][w] = 0;
+            mem->dirty[i][w] = 0;
+        }
+        if (run_pages > 0) {
+            CFS_Arena_Zero(&mem->arenas[i], run_start << SIM_MEM_PAGE_SHIFT, run_pages << SIM_MEM_PAGE_SHIFT);
+            bytes += run_pages << SIM_MEM_PAGE_SHIFT;
+        }
+    }
+
+    mem->baseline = NULL;
+    mem->journal_active = FALSE;
+    mem->journal_count = 0;
+    mem->undo_used = 0;
+    CFS_Arena_ResetEnd(reset_begin, bytes);
+}
+
+void CFS_SimMem_Release(void) {
+    SimMem_t *mem = &t_sim_mem;
+
+    for (size_t i = 0; i < CFS_MISSION_MAX_REGIONS; i++) {
+        CFS_Arena_Unmap(&mem->arenas[i]);
+        free(mem->touched[i]);
+        free(mem->dirty[i]);
+    }
+
+    free(mem->journal);
+    free(mem->undo);
+    memset(mem, 0, sizeof(*mem));
+}
@@ -0,0 +1,80 @@
+/*
+ * CFS 시뮬레이션 타겟 메모리 헤더
+ * 현재 미션 (mission.h) 의 각 메모리 영역을 호스트 메모리 아레나 (arena.h) 로 뒷받침하고,
+ * 쓰기 저널(undo)로 실행 전 상태로 되돌릴 수 있게 한다.
+ * 페이지 단위 dirty 추적으로 메모리 이미지 캡처/복원(스냅샷)을 지원한다.
+ */
+
+#ifndef CFS_SIM_MEM_H
+#define CFS_SIM_MEM_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+// 저널에 기록된 쓰기 한 건
+typedef struct {
+    uint64_t addr;              // 타겟 주소
+    uint32_t size;              // 쓴 바이트 수
+    size_t   undo_offset;       // 이전 내용이 저장된 undo 버퍼 위치
+} CFS_SimMemWrite_t;
+
+// 캡처된 메모리 이미지 (불투명 타입, 캡처한 스레드에서만 사용)
+typedef struct CFS_SimMemImage CFS_SimMemImage_t;
+
+// 이미지 통계
+typedef struct {
+    uint64_t captures;
+    uint64_t restores;
+    uint64_t pages_captured;
+    uint64_t pages_restored;
+} CFS_SimMemStats_t;
+
+// 타겟 주소 → 호스트 포인터 (한 영역 안에 완전히 들어가지 않으면 NULL, sanitizer 검사 없음)
+uint8_t* CFS_SimMem_Translate(uint64_t addr, uint32_t size);
+
+// 타겟 메모리 읽기/쓰기 (권한 검사는 호출자 책임, 위반은 target_san.h 가 보고)
+int32_t CFS_SimMem_Read(uint64_t addr, void *dst, uint32_t size);
+int32_t CFS_SimMem_Write(uint64_t addr, const void *src, uint32_t size);
+
+// 32비트 패턴으로 채우기 (segment 바이트 구간 단위로 나눠 씀, 0 이면 한 번에)
+int32_t CFS_SimMem_Fill(uint64_t addr, uint32_t size, uint32_t pattern, uint32_t segment);
+
+// 스트리밍 로드의 CRC 불일치 처리
+typedef enum {
+    CFS_SIMMEM_LOAD_STREAM = 0,     // 청크마다 CRC 누적과 복사를 한 번에 (불일치는 쓴 뒤에 보고)
+    CFS_SIMMEM_LOAD_VERIFY_FIRST    // CRC 를 먼저 확인하고 일치할 때만 씀 (불일치 시 타겟 불변)
+} CFS_SimMemLoadMode_t;
+
+/*
+ * src 를 chunk 바이트 단위로 타겟 메모리에 로드 (chunk 0 이면 한 번에)
+ * expected_crc 가 0 이 아니면 MM_CalculateCRC32 로 누적한 CRC 와 비교해
+ * 다르면 CFS_MM_ERROR_CRC_MISMATCH 를 반환한다. crc_out 은 계산한 CRC (선택).
+ */
+int32_t CFS_SimMem_LoadStream(uint64_t addr, const void *src, uint32_t size, uint32_t chunk,
+                              CFS_SimMemLoadMode_t mode, uint32_t expected_crc,
+                              uint32_t *crc_out);
+
+// 쓰기 저널: Begin 이후의 쓰기를 기록, Rollback 은 되돌림, Commit 은 유지
+void CFS_SimMem_JournalBegin(void);
+void CFS_SimMem_JournalRollback(void);
+void CFS_SimMem_JournalCommit(void);
+uint32_t CFS_SimMem_JournalCount(void);
+const CFS_SimMemWrite_t* CFS_SimMem_JournalEntry(uint32_t index);
+
+// 지금까지 쓴 페이지 전체를 이미지로 캡처 (이 이미지가 dirty 추적 기준이 됨)
+CFS_SimMemImage_t* CFS_SimMem_CaptureImage(void);
+
+// 이미지 상태로 복원 (기준 이미지면 그 이후 dirty 페이지만 복사)
+int32_t CFS_SimMem_RestoreImage(const CFS_SimMemImage_t *image);
+
+size_t CFS_SimMem_ImageBytes(const CFS_SimMemImage_t *image);
+void CFS_SimMem_FreeImage(CFS_SimMemImage_t *image);
+const CFS_SimMemStats_t* CFS_SimMem_GetStats(void);
+
+// 현재 스레드의 모든 영역을 0 으로 되돌림 (쓴 페이지만 지우고 매핑과 미리 폴트한 배치는 유지)
+void CFS_SimMem_Reset(void);
+
+// 현재 스레드의 모든 영역을 0 으로 되돌리고 메모리 반환
+void CFS_SimMem_Release(void);
+
+#endif // CFS_SIM_MEM_H
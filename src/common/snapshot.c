@@ -0,0 +1,211 @@
+/*
+ * CFS 하니스 상태 스냅샷
+ *
+ * 스냅샷 = MM_AppData 사본 + EEPROM 뱅크 쓰기 허용 상태 + 가상 시계 + 타겟 메모리 위반 + 시뮬레이션 메모리 이미지 + VFS 이미지
+ * + Mock 호출 기록 (캐시에서 복원한 접두부도 같은 기록을 남기도록).
+ * 메모리 이미지는 마지막으로 캡처/복원한 이미지 이후 dirty 페이지만 되돌리므로
+ * 같은 스냅샷으로 반복 복원하는 비용은 한 번의 실행이 바꾼 양에 비례한다.
+ */
+
+#include "snapshot.h"
+#include "eeprom.h"
+#include "mm_types.h"
+#include "mock_trace.h"
+#include "sim_mem.h"
+#include "target_san.h"
+#include "vclock.h"
+#include "vfs.h"
+
+struct CFS_Snapshot {
+    MM_AppData_t       app;
+    uint64_t           eeprom_write_mask;
+    CFS_VClockState_t  clock;
+    CFS_TargetSanInput_t target_san;
+    CFS_SimMemImage_t *mem;
+    CFS_VfsImage_t    *vfs;
+    CFS_MockTraceMark_t *trace;
+};
+
+typedef struct {
+    uint64_t        key;
+    uint64_t        last_used;
+    CFS_Snapshot_t *snap;
+    uint8_t        *prefix;     // 적중 확인용 접두부 바이트 사본
+    size_t          length;
+} SnapshotSlot_t;
+
+typedef struct {
+    SnapshotSlot_t      slots[CFS_SNAPSHOT_CACHE_SLOTS];
+    uint64_t            sightings[CFS_SNAPSHOT_SIGHTING_SLOTS];
+    uint64_t            tick;
+    CFS_SnapshotStats_t stats;
+} SnapshotCache_t;
+
+static CFS_THREAD_LOCAL SnapshotCache_t t_snapshot_cache;
+
+CFS_Snapshot_t* CFS_Snapshot_Capture(void) {
+    CFS_Snapshot_t *snap = calloc(1, sizeof(*snap));
+    if (!snap) {
+        return NULL;
+    }
+
+    snap->app = MM_AppData;
+    snap->eeprom_write_mask = CFS_Eeprom_GetWriteMask();
+    CFS_VClock_Save(&snap->clock);
+    CFS_TargetSan_Save(&snap->target_san);
+    snap->mem = CFS_SimMem_CaptureImage();
+    snap->vfs = CFS_Vfs_Capture();
+    snap->trace = CFS_MockTrace_Capture();
+    if (!snap->mem || !snap->vfs || !snap->trace) {
+        CFS_Snapshot_Free(snap);
+        return NULL;
+    }
+
+    t_snapshot_cache.stats.captures++;
+    return snap;
+}
+
+int32_t CFS_Snapshot_Restore(const CFS_Snapshot_t *snap) {
+    if (!snap) {
+        return OS_INVALID_POINTER;
+    }
+
+    int32_t status = CFS_SimMem_RestoreImage(snap->mem);
+    if (status != CFE_SUCCESS) {
+        return status;
+    }
+    status = CFS_Vfs_Restore(snap->vfs);
+    if (status != CFE_SUCCESS) {
+        return status;
+    }
+
+    MM_AppData = snap->app;
+    CFS_Eeprom_SetWriteMask(snap->eeprom_write_mask);
+    CFS_VClock_Restore(&snap->clock);
+    CFS_TargetSan_Restore(&snap->target_san);
+    CFS_MockTrace_Restore(snap->trace);
+    t_snapshot_cache.stats.restores++;
+    return CFE_SUCCESS;
+}
+
+size_t CFS_Snapshot_Size(const CFS_Snapshot_t *snap) {
+    if (!snap) {
+        return 0;
+    }
+    return sizeof(*snap) + CFS_SimMem_ImageBytes(snap->mem) + CFS_Vfs_ImageBytes(snap->vfs) +
+           CFS_MockTrace_MarkBytes(snap->trace);
+}
+
+void CFS_Snapshot_Free(CFS_Snapshot_t *snap) {
+    if (!snap) {
+        return;
+    }
+    CFS_SimMem_FreeImage(snap->mem);
+    CFS_Vfs_FreeImage(snap->vfs);
+    CFS_MockTrace_FreeMark(snap->trace);
+    free(snap);
+}
+
+static void SnapshotCache_FreeSlot(SnapshotSlot_t *slot) {
+    CFS_Snapshot_Free(slot->snap);
+    free(slot->prefix);
+    slot->snap = NULL;
+    slot->prefix = NULL;
+    slot->length = 0;
+}
+
+CFS_Snapshot_t* CFS_SnapshotCache_Find(uint64_t key, const uint8_t *prefix, size_t length) {
+    SnapshotCache_t *cache = &t_snapshot_cache;
+
+    cache->stats.cache_lookups++;
+    for (size_t i = 0; i < CFS_SNAPSHOT_CACHE_SLOTS; i++) {
+        SnapshotSlot_t *slot = &cache->slots[i];
+        if (slot->snap && slot->key == key && slot->length == length &&
+            memcmp(slot->prefix, prefix, length) == 0) {
+            slot->last_used = ++cache->tick;
+            cache->stats.cache_hits++;
+            return slot->snap;
+        }
+    }
+    return NULL;
+}
+
+boolean CFS_SnapshotCache_ShouldCapture(uint64_t key) {
+    uint64_t *seen = &t_snapshot_cache.sightings[key & (CFS_SNAPSHOT_SIGHTING_SLOTS - 1)];
+
+    if (*seen == key) {
+        return TRUE;
+    }
+    *seen = key;
+    return FALSE;
+}
+
+void CFS_SnapshotCache_Insert(uint64_t key, const uint8_t *prefix, size_t length,
+                              CFS_Snapshot_t *snap) {
+    SnapshotCache_t *cache = &t_snapshot_cache;
+    SnapshotSlot_t *victim = &cache->slots[0];
+
+    if (!snap) {
+        return;
+    }
+
+    uint8_t *copy = malloc(length ? length : 1);
+    if (!copy) {
+        CFS_Snapshot_Free(snap);
+        return;
+    }
+    memcpy(copy, prefix, length);
+
+    for (size_t i = 0; i < CFS_SNAPSHOT_CACHE_SLOTS; i++) {
+        SnapshotSlot_t *slot = &cache->slots[i];
+        if (!slot->snap || slot->key == key) {
+            victim = slot;
+            break;
+        }
+        if (slot->last_used < victim->last_used) {
+            victim = slot;
+        }
+    }
+
+    if (victim->snap) {
+        cache->stats.bytes_cached -= CFS_Snapshot_Size(victim->snap) + victim->length;
+        SnapshotCache_FreeSlot(victim);
+        cache->stats.cache_evictions++;
+    }
+
+    victim->key = key;
+    victim->snap = snap;
+    victim->prefix = copy;
+    victim->length = length;
+    victim->last_used = ++cache->tick;
+    cache->stats.bytes_cached += CFS_Snapshot_Size(snap) + length;
+}
+
+void CFS_SnapshotCache_Clear(void) {
+    SnapshotCache_t *cache = &t_snapshot_cache;
+
+    for (size_t i = 0; i < CFS_SNAPSHOT_CACHE_SLOTS; i++) {
+        SnapshotCache_FreeSlot(&cache->slots[i]);
+    }
+    memset(cache->sightings, 0, sizeof(cache->sightings));
+    cache->stats.bytes_cached = 0;
+}
+
+const CFS_SnapshotStats_t* CFS_Snapshot_GetStats(void) {
+    return &t_snapshot_cache.stats;
+}
+
+void CFS_Snapshot_PrintStats(void) {
+    const CFS_SnapshotStats_t *stats = CFS_Snapshot_GetStats();
+    const CFS_SimMemStats_t *mem = CFS_SimMem_GetStats();
+
+    printf("\n=== Snapshot Statistics ===\n");
+    printf("Captures: %lu\n", stats->captures);
+    printf("Restores: %lu\n", stats->restores);
+    printf("Prefix Cache Hits: %lu / %lu (%.2f%%)\n", stats->cache_hits, stats->cache_lookups,
+           stats->cache_lookups > 0 ? (100.0 * stats->cache_hits / stats->cache_lookups) : 0.0);
+    printf("Evictions: %lu\n", stats->cache_evictions);
+    printf("Cached Bytes: %lu\n", stats->bytes_cached);
+    printf("Pages Captured/Restored: %lu / %lu\n", mem->pages_captured, mem->pages_restored);
+    printf("===========================\n\n");
+}
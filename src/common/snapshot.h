@@ -0,0 +1,57 @@
+/*
+ * CFS 하니스 상태 스냅샷 헤더
+ * MM 앱 상태(HK), 시뮬레이션 메모리 페이지, VFS 를 한 번에 캡처/복원한다.
+ * 명령 시퀀스 입력에서 공통 접두부를 다시 실행하지 않도록
+ * 접두부 해시 → 스냅샷 캐시를 함께 제공한다.
+ */
+
+#ifndef CFS_SNAPSHOT_H
+#define CFS_SNAPSHOT_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+// 스레드당 접두부 스냅샷 캐시 크기
+#ifndef CFS_SNAPSHOT_CACHE_SLOTS
+#define CFS_SNAPSHOT_CACHE_SLOTS    32
+#endif
+
+// 캡처 여부 판단용 접두부 관측 카운터 크기 (2 의 거듭제곱)
+#define CFS_SNAPSHOT_SIGHTING_SLOTS 1024
+
+// 스냅샷 (불투명 타입, 캡처한 스레드에서만 사용)
+typedef struct CFS_Snapshot CFS_Snapshot_t;
+
+// 스냅샷 통계
+typedef struct {
+    uint64_t captures;
+    uint64_t restores;
+    uint64_t cache_lookups;
+    uint64_t cache_hits;
+    uint64_t cache_evictions;
+    uint64_t bytes_cached;      // 현재 캐시에 보관 중인 스냅샷 크기 합
+} CFS_SnapshotStats_t;
+
+CFS_Snapshot_t* CFS_Snapshot_Capture(void);
+int32_t CFS_Snapshot_Restore(const CFS_Snapshot_t *snap);
+size_t CFS_Snapshot_Size(const CFS_Snapshot_t *snap);
+void CFS_Snapshot_Free(CFS_Snapshot_t *snap);
+
+/*
+ * 접두부 캐시
+ *   key 는 접두부 바이트의 빠른 (표본) 해시여도 된다. 적중은 저장해 둔
+ *   접두부 바이트와 memcmp 로 확인하므로 해시 충돌이 잘못된 상태로 이어지지 않는다.
+ *   Find          - 키와 접두부 바이트가 모두 같은 스냅샷 (없으면 NULL)
+ *   ShouldCapture - 같은 키를 두 번째 볼 때 TRUE (한 번만 나오는 접두부는 캡처 비용만 듦)
+ *   Insert        - 캐시가 스냅샷 소유권을 가져가고 접두부를 복사 (가득 차면 LRU 교체)
+ */
+CFS_Snapshot_t* CFS_SnapshotCache_Find(uint64_t key, const uint8_t *prefix, size_t length);
+boolean CFS_SnapshotCache_ShouldCapture(uint64_t key);
+void CFS_SnapshotCache_Insert(uint64_t key, const uint8_t *prefix, size_t length,
+                              CFS_Snapshot_t *snap);
+void CFS_SnapshotCache_Clear(void);
+
+const CFS_SnapshotStats_t* CFS_Snapshot_GetStats(void);
+void CFS_Snapshot_PrintStats(void);
+
+#endif // CFS_SNAPSHOT_H
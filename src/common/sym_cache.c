@@ -0,0 +1,257 @@
+/*
+ * CFS 심볼 해석 캐시
+ *
+ * 실제 OSAL 심볼 테이블 조회는 선형 탐색이므로, 명령마다 호출되는
+ * MM_ResolveSymAddr 앞단에서 결과를 캐시한다.
+ *   - 이름 해시(FNV-1a)를 키로 사용, 충돌 시 이름까지 비교
+ *   - 실패 결과도 캐시 (negative caching) → 실패 로그는 최초 1회만
+ *   - 고정 크기 + LRU 교체
+ *   - 테이블은 스레드별로 첫 사용 시 할당, 스레드가 끝나면 키 소멸자가 해제
+ *   - CFS_SymCache_Invalidate() 로 세대(epoch)를 올리면 각 스레드가
+ *     다음 조회 시 캐시를 비운다
+ */
+
+#include "sym_cache.h"
+#include "utils.h"
+#include <pthread.h>
+
+#define SYM_CACHE_BUCKETS   (CFS_SYM_CACHE_CAPACITY * 2)
+#define SYM_CACHE_NIL       0xFFFF
+
+typedef struct {
+    uint64_t hash;
+    uint64_t address;
+    int32_t  status;
+    uint16_t chain_next;                    // 같은 버킷의 다음 엔트리
+    uint16_t lru_prev;
+    uint16_t lru_next;
+    char     name[OS_MAX_API_NAME + 1];
+} SymCacheEntry_t;
+
+typedef struct {
+    uint32_t        epoch;
+    uint16_t        count;
+    uint16_t        lru_head;               // 가장 최근 사용
+    uint16_t        lru_tail;               // 가장 오래된 사용
+    uint16_t        buckets[SYM_CACHE_BUCKETS];
+    SymCacheEntry_t entries[CFS_SYM_CACHE_CAPACITY];
+    CFS_SymCacheStats_t stats;
+} SymCache_t;
+
+// 스레드별 캐시 (첫 조회 시 할당)
+static CFS_THREAD_LOCAL SymCache_t *t_sym_cache = NULL;
+
+static pthread_once_t g_sym_cache_once = PTHREAD_ONCE_INIT;
+static pthread_key_t  g_sym_cache_key;
+
+// 심볼 테이블 세대 (재로드마다 증가)
+static volatile uint32_t g_sym_epoch = 0;
+
+static uint32_t SymCache_CurrentEpoch(void) {
+    return __atomic_load_n(&g_sym_epoch, __ATOMIC_ACQUIRE);
+}
+
+static void SymCache_Reset(SymCache_t *cache) {
+    cache->count = 0;
+    cache->lru_head = SYM_CACHE_NIL;
+    cache->lru_tail = SYM_CACHE_NIL;
+    memset(cache->buckets, 0xFF, sizeof(cache->buckets));
+}
+
+static void SymCache_ThreadExit(void *arg) {
+    free(arg);
+}
+
+static void SymCache_Init(void) {
+    pthread_key_create(&g_sym_cache_key, SymCache_ThreadExit);
+}
+
+static SymCache_t* SymCache_Get(void) {
+    SymCache_t *cache = t_sym_cache;
+
+    if (!cache) {
+        pthread_once(&g_sym_cache_once, SymCache_Init);
+        cache = calloc(1, sizeof(SymCache_t));
+        if (!cache) {
+            return NULL;
+        }
+        SymCache_Reset(cache);
+        cache->epoch = SymCache_CurrentEpoch();
+        t_sym_cache = cache;
+        pthread_setspecific(g_sym_cache_key, cache);
+        return cache;
+    }
+
+    uint32_t epoch = SymCache_CurrentEpoch();
+    if (cache->epoch != epoch) {
+        SymCache_Reset(cache);
+        cache->epoch = epoch;
+        cache->stats.invalidations++;
+    }
+
+    return cache;
+}
+
+static void SymCache_LruUnlink(SymCache_t *cache, uint16_t idx) {
+    SymCacheEntry_t *e = &cache->entries[idx];
+
+    if (e->lru_prev != SYM_CACHE_NIL) {
+        cache->entries[e->lru_prev].lru_next = e->lru_next;
+    } else {
+        cache->lru_head = e->lru_next;
+    }
+
+    if (e->lru_next != SYM_CACHE_NIL) {
+        cache->entries[e->lru_next].lru_prev = e->lru_prev;
+    } else {
+        cache->lru_tail = e->lru_prev;
+    }
+}
+
+static void SymCache_LruPushFront(SymCache_t *cache, uint16_t idx) {
+    SymCacheEntry_t *e = &cache->entries[idx];
+
+    e->lru_prev = SYM_CACHE_NIL;
+    e->lru_next = cache->lru_head;
+    if (cache->lru_head != SYM_CACHE_NIL) {
+        cache->entries[cache->lru_head].lru_prev = idx;
+    }
+    cache->lru_head = idx;
+    if (cache->lru_tail == SYM_CACHE_NIL) {
+        cache->lru_tail = idx;
+    }
+}
+
+static void SymCache_BucketRemove(SymCache_t *cache, uint16_t idx) {
+    uint16_t *link = &cache->buckets[cache->entries[idx].hash & (SYM_CACHE_BUCKETS - 1)];
+
+    while (*link != SYM_CACHE_NIL) {
+        if (*link == idx) {
+            *link = cache->entries[idx].chain_next;
+            return;
+        }
+        link = &cache->entries[*link].chain_next;
+    }
+}
+
+/*
+ * 심볼 이름 해시 (FNV-1a 64비트)
+ * SymName 필드는 NUL 종료가 보장되지 않으므로 OS_MAX_API_NAME 에서 멈춘다.
+ */
+uint64_t CFS_SymCache_Hash(const char *name, size_t *length) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    size_t i = 0;
+
+    if (name) {
+        for (; i < OS_MAX_API_NAME && name[i] != '\0'; i++) {
+            hash ^= (uint8_t)name[i];
+            hash *= 0x100000001B3ULL;
+        }
+    }
+
+    if (length) {
+        *length = i;
+    }
+    return hash;
+}
+
+/*
+ * 캐시를 거친 심볼 조회
+ */
+int32_t CFS_SymCache_Lookup(const char *name, uint64_t hash, uint64_t *address) {
+    if (!name || !address) {
+        return OS_INVALID_POINTER;
+    }
+
+    SymCache_t *cache = SymCache_Get();
+    if (!cache) {
+        return OS_SymbolLookup(address, name);
+    }
+
+    cache->stats.lookups++;
+
+    // 버킷 탐색
+    uint16_t idx = cache->buckets[hash & (SYM_CACHE_BUCKETS - 1)];
+    while (idx != SYM_CACHE_NIL) {
+        SymCacheEntry_t *e = &cache->entries[idx];
+        if (e->hash == hash && strncmp(e->name, name, OS_MAX_API_NAME) == 0) {
+            if (idx != cache->lru_head) {
+                SymCache_LruUnlink(cache, idx);
+                SymCache_LruPushFront(cache, idx);
+            }
+            if (e->status == OS_SUCCESS) {
+                cache->stats.hits++;
+                *address = e->address;
+            } else {
+                cache->stats.negative_hits++;
+            }
+            return e->status;
+        }
+        idx = e->chain_next;
+    }
+
+    // 미스: 빈 슬롯 또는 LRU 엔트리 재사용
+    cache->stats.misses++;
+
+    if (cache->count < CFS_SYM_CACHE_CAPACITY) {
+        idx = cache->count++;
+    } else {
+        idx = cache->lru_tail;
+        SymCache_LruUnlink(cache, idx);
+        SymCache_BucketRemove(cache, idx);
+        cache->stats.evictions++;
+    }
+
+    SymCacheEntry_t *e = &cache->entries[idx];
+    e->hash = hash;
+    strncpy(e->name, name, OS_MAX_API_NAME);
+    e->name[OS_MAX_API_NAME] = '\0';
+    e->address = 0;
+    e->status = OS_SymbolLookup(&e->address, e->name);
+
+    if (e->status != OS_SUCCESS) {
+        CFS_DEBUG_PRINT("Symbol lookup failed for: %s", e->name);
+    }
+
+    uint16_t *bucket = &cache->buckets[hash & (SYM_CACHE_BUCKETS - 1)];
+    e->chain_next = *bucket;
+    *bucket = idx;
+    SymCache_LruPushFront(cache, idx);
+
+    if (e->status == OS_SUCCESS) {
+        *address = e->address;
+    }
+    return e->status;
+}
+
+void CFS_SymCache_Invalidate(void) {
+    __atomic_add_fetch(&g_sym_epoch, 1, __ATOMIC_RELEASE);
+}
+
+void CFS_SymCache_Release(void) {
+    if (t_sym_cache) {
+        pthread_setspecific(g_sym_cache_key, NULL);
+        free(t_sym_cache);
+        t_sym_cache = NULL;
+    }
+}
+
+const CFS_SymCacheStats_t* CFS_SymCache_GetStats(void) {
+    static const CFS_SymCacheStats_t empty_stats = {0};
+    return t_sym_cache ? &t_sym_cache->stats : &empty_stats;
+}
+
+void CFS_SymCache_PrintStats(void) {
+    const CFS_SymCacheStats_t *stats = CFS_SymCache_GetStats();
+    uint64_t served = stats->hits + stats->negative_hits;
+
+    printf("\n=== Symbol Cache Statistics ===\n");
+    printf("Lookups: %lu\n", stats->lookups);
+    printf("Hits: %lu (negative: %lu)\n", served, stats->negative_hits);
+    printf("Misses: %lu\n", stats->misses);
+    printf("Hit Rate: %.2f%%\n",
+           stats->lookups > 0 ? (100.0 * served / stats->lookups) : 0.0);
+    printf("Evictions: %lu\n", stats->evictions);
+    printf("Invalidations: %lu\n", stats->invalidations);
+    printf("===============================\n\n");
+}
@@ -0,0 +1,43 @@
+/*
+ * CFS 심볼 해석 캐시 헤더
+ * OS_SymbolLookup 앞단에서 성공/실패 결과를 이름 해시 기준으로 메모이제이션
+ */
+
+#ifndef CFS_SYM_CACHE_H
+#define CFS_SYM_CACHE_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+// 캐시 크기 (엔트리 수, 버킷 수는 2배)
+#ifndef CFS_SYM_CACHE_CAPACITY
+#define CFS_SYM_CACHE_CAPACITY      256
+#endif
+
+// 캐시 통계
+typedef struct {
+    uint64_t lookups;           // 전체 조회 수
+    uint64_t hits;              // 성공 결과 캐시 적중
+    uint64_t negative_hits;     // 실패 결과 캐시 적중
+    uint64_t misses;            // OS_SymbolLookup 호출 수
+    uint64_t evictions;         // LRU 교체 수
+    uint64_t invalidations;     // 심볼 테이블 재로드에 따른 비우기 수
+} CFS_SymCacheStats_t;
+
+// 심볼 이름 해시 (최대 OS_MAX_API_NAME 바이트, NUL 종료 불필요)
+uint64_t CFS_SymCache_Hash(const char *name, size_t *length);
+
+// 해시를 미리 계산한 심볼 조회 (미스 시 OS_SymbolLookup 호출 후 결과 저장)
+int32_t CFS_SymCache_Lookup(const char *name, uint64_t hash, uint64_t *address);
+
+// 심볼 테이블 재로드 시 호출 (모든 스레드의 캐시를 무효화)
+void CFS_SymCache_Invalidate(void);
+
+// 현재 스레드 캐시 해제 (스레드 종료 시에는 자동으로 해제됨)
+void CFS_SymCache_Release(void);
+
+// 현재 스레드 캐시 통계
+const CFS_SymCacheStats_t* CFS_SymCache_GetStats(void);
+void CFS_SymCache_PrintStats(void);
+
+#endif // CFS_SYM_CACHE_H
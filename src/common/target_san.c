@@ -0,0 +1,232 @@
+/*
+ * CFS 타겟 메모리 sanitizer
+ *
+ * 섀도와 영역 권한 표는 설정 때 한 번 만들고 이후에는 읽기만 하므로 스레드 사이에 공유한다.
+ * 검사 횟수와 위반은 스레드별로 세고 입력이 끝날 때 전체 통계에 더한다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "target_san.h"
+#include "mission.h"
+
+#define TARGET_SAN_GRANULE_SHIFT    12
+#define TARGET_SAN_SHADOW_SIZE      ((size_t)1 << (32 - TARGET_SAN_GRANULE_SHIFT))
+#define TARGET_SAN_MIXED            0xFF
+
+// 영역 권한 비트 (섀도 값으로 색인, 시뮬레이션 메모리에서 코드를 가져오는 경로가 없으므로 쓰기만)
+#define TARGET_SAN_WRITABLE         0x1
+
+typedef struct {
+    boolean  enabled;
+    boolean  fatal;
+    uint8_t *shadow;                // NULL 이면 모두 영역 표 탐색
+    uint8_t  perms[256];
+} TargetSanConfig_t;
+
+typedef struct {
+    CFS_TargetSanInput_t current;
+    uint64_t             checks;
+    uint64_t             slow_checks;
+    boolean              suspended;     // CFS_TargetSan_SetAccounting(FALSE)
+} TargetSan_t;
+
+static TargetSanConfig_t g_target_san = { FALSE, FALSE, NULL, { 0 } };
+static CFS_TargetSanStats_t g_target_san_stats;
+static CFS_THREAD_LOCAL TargetSan_t t_target_san;
+
+static const char * const g_target_san_kind_names[CFS_TARGET_SAN_KIND_COUNT] = {
+    "ok", "unmapped", "cross-region", "read-only"
+};
+
+/*
+ * 섀도 구성: 영역마다 덮는 그래뉼을 채우고, 영역이 그래뉼 일부만 덮으면 경계 표시
+ */
+static void TargetSan_BuildShadow(void) {
+    const CFS_Mission_t *m = CFS_Mission_Get();
+    const uint64_t granule = 1ULL << TARGET_SAN_GRANULE_SHIFT;
+
+    memset(g_target_san.perms, 0, sizeof(g_target_san.perms));
+    if (!g_target_san.shadow) {
+        g_target_san.shadow = calloc(TARGET_SAN_SHADOW_SIZE, 1);
+        if (!g_target_san.shadow) {
+            fprintf(stderr, "Target sanitizer: no memory for shadow, using region table only\n");
+            return;
+        }
+    } else {
+        memset(g_target_san.shadow, 0, TARGET_SAN_SHADOW_SIZE);
+    }
+
+    for (uint32_t i = 0; i < m->region_count && i < TARGET_SAN_MIXED - 1; i++) {
+        const CFS_MemoryRegion_t *region = &m->regions[i];
+        uint8_t value = (uint8_t)(i + 1);
+
+        g_target_san.perms[value] = region->writable ? TARGET_SAN_WRITABLE : 0;
+        if (region->start_addr > UINT32_MAX) {
+            continue;
+        }
+        uint64_t end = region->end_addr < UINT32_MAX ? region->end_addr : UINT32_MAX;
+        uint64_t first = region->start_addr >> TARGET_SAN_GRANULE_SHIFT;
+        uint64_t last = end >> TARGET_SAN_GRANULE_SHIFT;
+        for (uint64_t g = first; g <= last; g++) {
+            boolean whole = (g << TARGET_SAN_GRANULE_SHIFT) >= region->start_addr &&
+                            ((g + 1) * granule - 1) <= region->end_addr;
+            uint8_t *entry = &g_target_san.shadow[g];
+            *entry = (whole && *entry == 0) ? value : TARGET_SAN_MIXED;
+        }
+    }
+}
+
+void CFS_TargetSan_Configure(boolean enabled, boolean fatal) {
+    g_target_san.enabled = enabled;
+    g_target_san.fatal = fatal;
+    if (enabled) {
+        TargetSan_BuildShadow();
+    }
+}
+
+void CFS_TargetSan_ConfigureFromEnv(boolean default_fatal) {
+    const char *enabled = getenv("CFS_TARGET_SAN");
+    const char *fatal = getenv("CFS_TARGET_SAN_FATAL");
+
+    CFS_TargetSan_Configure((enabled && enabled[0] != '\0') ? (enabled[0] != '0') : TRUE,
+                            (fatal && fatal[0] != '\0') ? (fatal[0] != '0') : default_fatal);
+}
+
+static void TargetSan_Report(CFS_TargetSanKind_t kind, uint64_t addr, uint32_t size, boolean write,
+                             int index) {
+    const CFS_Mission_t *m = CFS_Mission_Get();
+
+    flockfile(stderr);
+    fprintf(stderr, "==CFS== TARGET-SAN: %s %s of %u bytes at 0x%08lX\n",
+            g_target_san_kind_names[kind], write ? "write" : "read", size, (unsigned long)addr);
+    if (index >= 0) {
+        const CFS_MemoryRegion_t *region = &m->regions[index];
+        fprintf(stderr, "==CFS==   region %s 0x%08lX-0x%08lX %c%c%c", region->name,
+                (unsigned long)region->start_addr, (unsigned long)region->end_addr,
+                'r', region->writable ? 'w' : '-', region->executable ? 'x' : '-');
+        if (kind == CFS_TARGET_SAN_CROSS_REGION) {
+            int next = (region->end_addr < UINT64_MAX) ? CFS_Mission_FindRegion(region->end_addr + 1, 1) : -1;
+            fprintf(stderr, ", spills %lu bytes into %s",
+                    (unsigned long)(addr + size - 1 - region->end_addr),
+                    next >= 0 ? m->regions[next].name : "unmapped space");
+        }
+        fprintf(stderr, "\n");
+    }
+    funlockfile(stderr);
+}
+
+// 섀도로 판정하지 못한 접근: 영역 표에서 정확히 분류
+static CFS_TargetSanKind_t TargetSan_Classify(uint64_t addr, uint32_t size, boolean write, int *index) {
+    const CFS_Mission_t *m = CFS_Mission_Get();
+
+    *index = CFS_Mission_FindRegion(addr, 1);
+    if (*index < 0) {
+        return CFS_TARGET_SAN_UNMAPPED;
+    }
+    if (CFS_Mission_FindRegion(addr, size) != *index) {
+        return CFS_TARGET_SAN_CROSS_REGION;
+    }
+    if (write && !m->regions[*index].writable) {
+        return CFS_TARGET_SAN_READ_ONLY;
+    }
+    return CFS_TARGET_SAN_OK;
+}
+
+CFS_TargetSanKind_t CFS_TargetSan_Check(uint64_t addr, uint32_t size, boolean write) {
+    TargetSan_t *t = &t_target_san;
+
+    if (!g_target_san.enabled || size == 0 || t->suspended) {
+        return CFS_TARGET_SAN_OK;
+    }
+    t->checks++;
+
+    // 빠른 경로: 첫/마지막 그래뉼이 같은 영역 전체 그래뉼이고 권한이 맞음
+    uint64_t last = addr + size - 1;
+    const uint8_t *shadow = g_target_san.shadow;
+    if (shadow && last <= UINT32_MAX && last >= addr) {
+        uint8_t first_value = shadow[addr >> TARGET_SAN_GRANULE_SHIFT];
+        uint8_t last_value = shadow[last >> TARGET_SAN_GRANULE_SHIFT];
+        boolean allowed = !write || (g_target_san.perms[first_value] & TARGET_SAN_WRITABLE);
+        if (first_value == last_value && (uint8_t)(first_value - 1) < TARGET_SAN_MIXED - 1 && allowed) {
+            return CFS_TARGET_SAN_OK;
+        }
+    }
+
+    t->slow_checks++;
+    int index;
+    CFS_TargetSanKind_t kind = TargetSan_Classify(addr, size, write, &index);
+    if (kind == CFS_TARGET_SAN_OK) {
+        return kind;
+    }
+
+    if (t->current.violations++ == 0) {
+        t->current.first_kind = kind;
+        TargetSan_Report(kind, addr, size, write, index);
+    }
+    __atomic_fetch_add(&g_target_san_stats.violations[kind], 1, __ATOMIC_RELAXED);
+    if (g_target_san.fatal) {
+        fprintf(stderr, "==CFS== ABORTING on target memory %s violation\n", g_target_san_kind_names[kind]);
+        abort();
+    }
+    return kind;
+}
+
+void CFS_TargetSan_BeginInput(void) {
+    memset(&t_target_san.current, 0, sizeof(t_target_san.current));
+}
+
+boolean CFS_TargetSan_EndInput(void) {
+    TargetSan_t *t = &t_target_san;
+    CFS_TargetSanStats_t *stats = &g_target_san_stats;
+
+    __atomic_fetch_add(&stats->inputs, 1, __ATOMIC_RELAXED);
+    if (t->checks) {
+        __atomic_fetch_add(&stats->checks, t->checks, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&stats->slow_checks, t->slow_checks, __ATOMIC_RELAXED);
+        t->checks = 0;
+        t->slow_checks = 0;
+    }
+    if (t->current.violations == 0) {
+        return FALSE;
+    }
+    __atomic_fetch_add(&stats->findings, 1, __ATOMIC_RELAXED);
+    return TRUE;
+}
+
+void CFS_TargetSan_SetAccounting(boolean enabled) {
+    t_target_san.suspended = !enabled;
+}
+
+void CFS_TargetSan_Save(CFS_TargetSanInput_t *state) {
+    *state = t_target_san.current;
+}
+
+void CFS_TargetSan_Restore(const CFS_TargetSanInput_t *state) {
+    t_target_san.current = *state;
+}
+
+const char* CFS_TargetSan_KindName(CFS_TargetSanKind_t kind) {
+    return (kind < CFS_TARGET_SAN_KIND_COUNT) ? g_target_san_kind_names[kind] : "unknown";
+}
+
+const CFS_TargetSanStats_t* CFS_TargetSan_GetStats(void) {
+    return &g_target_san_stats;
+}
+
+void CFS_TargetSan_PrintStats(void) {
+    const CFS_TargetSanStats_t *stats = CFS_TargetSan_GetStats();
+
+    if (!g_target_san.enabled || stats->checks == 0) {
+        return;
+    }
+
+    printf("\n=== Target Memory Sanitizer ===\n");
+    printf("Checks: %lu (%.2f%% resolved from region table)\n", stats->checks,
+           100.0 * (double)stats->slow_checks / (double)stats->checks);
+    for (int k = CFS_TARGET_SAN_UNMAPPED; k < CFS_TARGET_SAN_KIND_COUNT; k++) {
+        printf("  %-14s %lu\n", g_target_san_kind_names[k], stats->violations[k]);
+    }
+    printf("Inputs with violations: %lu of %lu\n", stats->findings, stats->inputs);
+    printf("===============================\n");
+}
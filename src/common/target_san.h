@@ -0,0 +1,81 @@
+/*
+ * CFS 타겟 메모리 sanitizer 헤더
+ * ASan 은 호스트 할당만 보므로, 시뮬레이션 메모리 안에서 한 영역을 넘어 다음 영역으로
+ * 이어지는 접근 (예: SRAM_MAIN 끝에서 SRAM_BACKUP 으로 넘치는 로드) 은 잡지 못한다.
+ * 시뮬레이션 메모리 (sim_mem.c) 의 모든 읽기/쓰기를 현재 미션의 영역 표로 검사한다.
+ *
+ * 섀도는 32 비트 주소 공간을 4KB 그래뉼로 나눈 바이트 배열이다 (1MB).
+ *   0 = 영역 없음, 1..64 = 그래뉼 전체가 속한 영역 번호 + 1, 0xFF = 영역 경계가 걸친 그래뉼
+ * 접근의 첫/마지막 그래뉼이 같은 영역이고 권한이 맞으면 비교 몇 번으로 통과하고,
+ * 나머지 (경계 그래뉼, 4GB 이상 주소, 위반) 만 영역 표를 찾아 정확히 판정한다.
+ *
+ * 위반 종류 (입력마다 첫 위반을 보고, fatal 이면 그 자리에서 abort)
+ *   unmapped      - 시작 주소가 어느 영역에도 없음
+ *   cross-region  - 한 영역에서 시작해 그 영역 끝을 넘음 (다음 영역 또는 빈 공간)
+ *   read-only     - 쓰기 불가 영역에 쓰기
+ * 검사하는 접근은 읽기와 쓰기뿐이다. 시뮬레이션 메모리에서 명령을 가져오는 경로가 없으므로
+ * 영역의 실행 권한은 보고서에 표시만 하고 검사하지 않는다.
+ * 검사는 관찰만 하므로 시뮬레이션 결과는 켜고 끄는 것과 무관하다.
+ *
+ * 환경 변수
+ *   CFS_TARGET_SAN=0|1        검사 여부 (기본 1)
+ *   CFS_TARGET_SAN_FATAL=0|1  위반 시 abort (기본: 퍼징 1, 단독 재생 0)
+ */
+
+#ifndef CFS_TARGET_SAN_H
+#define CFS_TARGET_SAN_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+typedef enum {
+    CFS_TARGET_SAN_OK = 0,
+    CFS_TARGET_SAN_UNMAPPED,
+    CFS_TARGET_SAN_CROSS_REGION,
+    CFS_TARGET_SAN_READ_ONLY,
+    CFS_TARGET_SAN_KIND_COUNT
+} CFS_TargetSanKind_t;
+
+// 입력 하나의 위반 (BeginInput 이후, 스냅샷과 함께 저장/복원)
+typedef struct {
+    uint32_t violations;
+    uint32_t first_kind;            // CFS_TargetSanKind_t
+} CFS_TargetSanInput_t;
+
+// 전체 통계 (모든 스레드 합)
+typedef struct {
+    uint64_t inputs;
+    uint64_t checks;
+    uint64_t slow_checks;           // 섀도로 판정하지 못해 영역 표를 찾은 검사
+    uint64_t violations[CFS_TARGET_SAN_KIND_COUNT];
+    uint64_t findings;              // 위반이 있었던 입력 수
+} CFS_TargetSanStats_t;
+
+/*
+ * 설정 (미션 설정 뒤, 워커 스레드 시작 전에만)
+ * 섀도를 만들지 못하면 모든 검사가 영역 표 탐색으로 간다.
+ */
+void CFS_TargetSan_Configure(boolean enabled, boolean fatal);
+void CFS_TargetSan_ConfigureFromEnv(boolean default_fatal);
+
+/*
+ * 시뮬레이션 메모리 접근 하나 검사 (sim_mem.c 전용)
+ * 반환값: CFS_TARGET_SAN_OK 또는 위반 종류 (보고/중단은 이 안에서)
+ */
+CFS_TargetSanKind_t CFS_TargetSan_Check(uint64_t addr, uint32_t size, boolean write);
+
+// 입력 경계: End 는 위반이 있었는지 반환
+void CFS_TargetSan_BeginInput(void);
+boolean CFS_TargetSan_EndInput(void);
+
+// 현재 스레드 검사 일시 중지 (차분 모드의 참조 실행과 재실행이 위반을 두 번 세지 않게)
+void CFS_TargetSan_SetAccounting(boolean enabled);
+
+void CFS_TargetSan_Save(CFS_TargetSanInput_t *state);
+void CFS_TargetSan_Restore(const CFS_TargetSanInput_t *state);
+
+const char* CFS_TargetSan_KindName(CFS_TargetSanKind_t kind);
+const CFS_TargetSanStats_t* CFS_TargetSan_GetStats(void);
+void CFS_TargetSan_PrintStats(void);
+
+#endif // CFS_TARGET_SAN_H
@@ -2,12 +2,22 @@
  * CFS MM Fuzzer 공통 유틸리티 함수들
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include "utils.h"
+#include "mission.h"
+#include "hexdump.h"
+#include "mock_trace.h"
+#include "rng.h"
+#include "sym_cache.h"
+#include <pthread.h>
 #include <time.h>
+#include <unistd.h>
 
-// 전역 변수들
+// 로그 설정 (초기화 시 설정, 워커 스레드들은 읽기만 한다)
 static boolean g_debug_enabled = FALSE;
 static FILE *g_log_file = NULL;
+static pthread_mutex_t g_log_lock = PTHREAD_MUTEX_INITIALIZER;
 
 // 기본 MM 설정
 const MM_Config_t MM_DefaultConfig = {
@@ -23,23 +33,53 @@ const MM_Config_t MM_DefaultConfig = {
     .file_dump_callback = NULL
 };
 
+// MM 앱 상태 (하니스 실행 간 유지, 스레드별)
+CFS_THREAD_LOCAL MM_AppData_t MM_AppData;
+
+/*
+ * MM 앱 상태 초기화 (MM_ResetCmd 와 동일하게 카운터와 마지막 작업 정보 초기화)
+ */
+void MM_ResetAppData(void) {
+    memset(&MM_AppData, 0, sizeof(MM_AppData));
+    MM_AppData.LastAction = MM_NOACTION;
+}
+
 /*
  * 심볼 주소 해석 함수
+ * 심볼 조회는 CFS_SymCache 를 거치므로 반복되는 이름은 상수 시간에 해석된다.
  */
 int32_t MM_ResolveSymAddr(MM_SymAddr_t *SymAddr, uint64_t *ResolvedAddr) {
+    if (!SymAddr) {
+        return OS_INVALID_POINTER;
+    }
+    
+    return MM_ResolveSymAddrHashed(SymAddr, CFS_SymCache_Hash(SymAddr->SymName, NULL), 
+                                   ResolvedAddr);
+}
+
+/*
+ * 이름 해시를 미리 계산한 심볼 주소 해석 함수
+ * 심볼 조회 결과는 캐시 적중과 무관하게 Mock 호출 기록에 남는다 (재생 모드는 기록된 결과).
+ */
+int32_t MM_ResolveSymAddrHashed(MM_SymAddr_t *SymAddr, uint64_t NameHash, uint64_t *ResolvedAddr) {
     if (!SymAddr || !ResolvedAddr) {
         return OS_INVALID_POINTER;
     }
     
     // 심볼 이름이 있는 경우
-    if (strlen(SymAddr->SymName) > 0) {
-        uint64_t symbol_addr = 0;
-        int32_t status = OS_SymbolLookup(&symbol_addr, SymAddr->SymName);
-        if (status != OS_SUCCESS) {
-            CFS_DEBUG_PRINT("Symbol lookup failed for: %s", SymAddr->SymName);
-            return status;
+    if (SymAddr->SymName[0] != '\0') {
+        const int64_t in[1] = { (int64_t)(uint32_t)NameHash };
+        int64_t out[2];
+        if (!CFS_MockTrace_Feed(CFS_MOCK_TRACE_SYMBOL, in, out)) {
+            uint64_t symbol_addr = 0;
+            out[0] = CFS_SymCache_Lookup(SymAddr->SymName, NameHash, &symbol_addr);
+            out[1] = (out[0] == OS_SUCCESS) ? (int64_t)symbol_addr : 0;
+            CFS_MockTrace_Record(CFS_MOCK_TRACE_SYMBOL, in, out);
         }
-        *ResolvedAddr = symbol_addr + SymAddr->Offset;
+        if (out[0] != OS_SUCCESS) {
+            return (int32_t)out[0];
+        }
+        *ResolvedAddr = (uint64_t)out[1] + SymAddr->Offset;
     } else {
         // 직접 주소 사용
         *ResolvedAddr = SymAddr->Offset;
@@ -102,15 +142,7 @@ int32_t MM_VerifyFileName(const char *FileName) {
     }
     
     // 허용된 경로인지 확인
-    boolean valid_path = FALSE;
-    for (int i = 0; i < CFS_NUM_VALID_PATHS; i++) {
-        if (strncmp(FileName, cfs_valid_paths[i], strlen(cfs_valid_paths[i])) == 0) {
-            valid_path = TRUE;
-            break;
-        }
-    }
-    
-    if (!valid_path) {
+    if (!CFS_Mission_PathAllowed(FileName)) {
         CFS_DEBUG_PRINT("Filename not in allowed paths: %s", FileName);
         return CFS_MM_ERROR_INVALID_FILE;
     }
@@ -141,24 +173,95 @@ boolean MM_IsValidAlignment(uint64_t addr, uint8_t data_size) {
     return (addr % alignment) == 0;
 }
 
+// CRC32 테이블 (IEEE 802.3, 반사 다항식 0xEDB88320)
+static const uint32_t crc_table[256] = {
+    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F,
+    0xE963A535, 0x9E6495A3, 0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988,
+    0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91, 0x1DB71064, 0x6AB020F2,
+    0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9,
+    0xFA0F3D63, 0x8D080DF5, 0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172,
+    0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B, 0x35B5A8FA, 0x42B2986C,
+    0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423,
+    0xCFBA9599, 0xB8BDA50F, 0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924,
+    0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D, 0x76DC4190, 0x01DB7106,
+    0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D,
+    0x91646C97, 0xE6635C01, 0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E,
+    0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457, 0x65B0D9C6, 0x12B7E950,
+    0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7,
+    0xA4D1C46D, 0xD3D6F4FB, 0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0,
+    0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9, 0x5005713C, 0x270241AA,
+    0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81,
+    0xB7BD5C3B, 0xC0BA6CAD, 0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A,
+    0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683, 0xE3630B12, 0x94643B84,
+    0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB,
+    0x196C3671, 0x6E6B06E7, 0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC,
+    0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5, 0xD6D6A3E8, 0xA1D1937E,
+    0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55,
+    0x316E8EEF, 0x4669BE79, 0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236,
+    0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F, 0xC5BA3BBE, 0xB2BD0B28,
+    0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F,
+    0x72076785, 0x05005713, 0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38,
+    0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21, 0x86D3D2D4, 0xF1D4E242,
+    0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69,
+    0x616BFFD3, 0x166CCF45, 0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2,
+    0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB, 0xAED16A4A, 0xD9D65ADC,
+    0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693,
+    0x54DE5729, 0x23D967BF, 0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94,
+    0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+};
+
+// slicing-by-8 테이블: crc_slice[k][b] = 바이트 b 뒤에 0 바이트 k 개를 더 처리한 CRC
+static uint32_t crc_slice[8][256];
+static pthread_once_t crc_slice_once = PTHREAD_ONCE_INIT;
+
+static void MM_InitCRC32Slices(void) {
+    for (size_t b = 0; b < 256; b++) {
+        crc_slice[0][b] = crc_table[b];
+    }
+    for (size_t k = 1; k < 8; k++) {
+        for (size_t b = 0; b < 256; b++) {
+            uint32_t prev = crc_slice[k - 1][b];
+            crc_slice[k][b] = crc_table[prev & 0xFF] ^ (prev >> 8);
+        }
+    }
+}
+
 /*
  * CRC32 계산 함수
+ * initial_crc 에서 이어서 누적하므로 데이터를 나눠 넣어도 결과가 같다.
+ * 8 바이트씩 slicing-by-8 로 처리하고 나머지는 바이트 테이블로 처리한다.
  */
 uint32_t MM_CalculateCRC32(const void *data, size_t length, uint32_t initial_crc) {
     if (!data || length == 0) {
         return initial_crc;
     }
     
-    // 간단한 CRC32 구현 (실제로는 더 정교한 알고리즘 사용)
     const uint8_t *bytes = (const uint8_t *)data;
     uint32_t crc = initial_crc;
     
-    static const uint32_t crc_table[256] = {
-        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F,
-        0xE963A535, 0x9E6495A3, 0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988,
-        0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91
-        // ... 나머지 테이블 생략 (실제 구현에서는 전체 256 엔트리 필요)
-    };
+    if (length >= 16) {
+        pthread_once(&crc_slice_once, MM_InitCRC32Slices);
+        while (length >= 8) {
+            uint32_t lo = crc ^ ((uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) |
+                                 ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24));
+            crc = crc_slice[7][lo & 0xFF] ^ crc_slice[6][(lo >> 8) & 0xFF] ^
+                  crc_slice[5][(lo >> 16) & 0xFF] ^ crc_slice[4][lo >> 24] ^
+                  crc_slice[3][bytes[4]] ^ crc_slice[2][bytes[5]] ^
+                  crc_slice[1][bytes[6]] ^ crc_slice[0][bytes[7]];
+            bytes += 8;
+            length -= 8;
+        }
+    }
     
     for (size_t i = 0; i < length; i++) {
         crc = crc_table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
@@ -181,16 +284,16 @@ int32_t MM_CalculateCRC(const void *data, size_t length, uint32_t *crc) {
 
 /*
  * 랜덤 데이터 생성 유틸리티
+ * 같은 seed 는 플랫폼과 무관하게 같은 바이트열 (rng.h), libc rand 상태는 건드리지 않음
  */
 void CFS_GenerateRandomData(uint8_t *buffer, size_t size, uint32_t seed) {
     if (!buffer || size == 0) {
         return;
     }
     
-    srand(seed);
-    for (size_t i = 0; i < size; i++) {
-        buffer[i] = (uint8_t)(rand() & 0xFF);
-    }
+    CFS_Rng_t rng;
+    CFS_Rng_Seed(&rng, seed);
+    CFS_Rng_Fill(&rng, buffer, size);
 }
 
 /*
@@ -222,34 +325,10 @@ void CFS_HexDump(const void *data, size_t length, const char *prefix) {
         return;
     }
     
-    const uint8_t *bytes = (const uint8_t *)data;
-    
-    for (size_t i = 0; i < length; i += 16) {
-        if (prefix) {
-            printf("%s%04zX: ", prefix, i);
-        } else {
-            printf("%04zX: ", i);
-        }
-        
-        // 16진수 출력
-        for (size_t j = 0; j < 16; j++) {
-            if (i + j < length) {
-                printf("%02X ", bytes[i + j]);
-            } else {
-                printf("   ");
-            }
-        }
-        
-        printf(" ");
-        
-        // ASCII 출력
-        for (size_t j = 0; j < 16 && i + j < length; j++) {
-            uint8_t c = bytes[i + j];
-            printf("%c", (c >= 32 && c <= 126) ? c : '.');
-        }
-        
-        printf("\n");
-    }
+    // 블록 단위 write 로 stdout 에 직접 쓰므로 앞선 printf 출력을 먼저 내보낸다
+    const CFS_HexDumpOptions_t opts = { prefix, 0, NULL, 0 };
+    fflush(stdout);
+    (void)CFS_HexDump_Write(STDOUT_FILENO, data, length, &opts);
 }
 
 /*
@@ -257,41 +336,41 @@ void CFS_HexDump(const void *data, size_t length, const char *prefix) {
  */
 int32_t CFS_ValidateMemoryRegion(uint64_t addr, uint32_t size, uint8_t mem_type, 
                                 boolean write_access) {
+    // 미션 설정에 따라 달라지는 결과이므로 재생 모드는 기록된 결과를 돌려준다
+    const int64_t in[4] = { (int64_t)addr, size, mem_type, write_access };
+    int64_t out[1];
+    if (CFS_MockTrace_Feed(CFS_MOCK_TRACE_REGION, in, out)) {
+        return (int32_t)out[0];
+    }
+
     // 주소가 유효한 범위에 있는지 확인
-    if (!CFS_IsValidMemoryAddress(addr, mem_type, size)) {
+    out[0] = CFE_SUCCESS;
+    const CFS_MemoryRegion_t *region = CFS_Mission_MatchRegion(addr, mem_type, size);
+    if (!region) {
         CFS_DEBUG_PRINT("Invalid memory region: addr=0x%08lX, size=%u, type=%d", 
                          addr, size, mem_type);
-        return CFS_MM_ERROR_INVALID_ADDR;
+        out[0] = CFS_MM_ERROR_INVALID_ADDR;
+    } else if (write_access && !region->writable) {
+        // 해당 영역의 쓰기 권한 확인
+        CFS_DEBUG_PRINT("Write access denied to read-only region: %s", 
+                         region->name);
+        out[0] = CFS_MM_ERROR_PERMISSION;
     }
     
-    // 해당 영역의 쓰기 권한 확인
-    if (write_access) {
-        for (int i = 0; i < CFS_NUM_MEMORY_REGIONS; i++) {
-            const CFS_MemoryRegion_t *region = &cfs_memory_regions[i];
-            if (region->mem_type == mem_type &&
-                addr >= region->start_addr &&
-                (addr + size - 1) <= region->end_addr) {
-                if (!region->writable) {
-                    CFS_DEBUG_PRINT("Write access denied to read-only region: %s", 
-                                     region->name);
-                    return CFS_MM_ERROR_PERMISSION;
-                }
-                break;
-            }
-        }
-    }
-    
-    return CFE_SUCCESS;
+    CFS_MockTrace_Record(CFS_MOCK_TRACE_REGION, in, out);
+    return (int32_t)out[0];
 }
 
 /*
  * 디버그 로깅 함수들
  */
 void CFS_EnableDebug(boolean enable) {
-    g_debug_enabled = enable;
+    __atomic_store_n(&g_debug_enabled, enable, __ATOMIC_RELAXED);
 }
 
+// 로그 파일 교체는 쓰는 중인 메시지가 끝난 뒤에 한다
 void CFS_SetLogFile(const char *filename) {
+    pthread_mutex_lock(&g_log_lock);
     if (g_log_file && g_log_file != stdout && g_log_file != stderr) {
         fclose(g_log_file);
         g_log_file = NULL;
@@ -305,68 +384,143 @@ void CFS_SetLogFile(const char *filename) {
     } else {
         g_log_file = stdout;
     }
+    pthread_mutex_unlock(&g_log_lock);
 }
 
 void CFS_LogMessage(const char *level, const char *format, ...) {
-    if (!g_debug_enabled) {
+    if (!__atomic_load_n(&g_debug_enabled, __ATOMIC_RELAXED)) {
         return;
     }
     
-    if (!g_log_file) {
-        g_log_file = stdout;
-    }
-    
     // 타임스탬프 추가
     time_t now;
+    struct tm tm_info;
     time(&now);
-    struct tm *tm_info = localtime(&now);
+    localtime_r(&now, &tm_info);
     
-    fprintf(g_log_file, "[%04d-%02d-%02d %02d:%02d:%02d] [%s] ",
-            tm_info->tm_year + 1900, tm_info->tm_mon + 1, tm_info->tm_mday,
-            tm_info->tm_hour, tm_info->tm_min, tm_info->tm_sec, level);
+    // 여러 워커의 메시지가 한 줄 안에서 섞이지 않도록 메시지 단위로 잠근다
+    pthread_mutex_lock(&g_log_lock);
+    FILE *out = g_log_file ? g_log_file : stdout;
+    fprintf(out, "[%04d-%02d-%02d %02d:%02d:%02d] [%s] ",
+            tm_info.tm_year + 1900, tm_info.tm_mon + 1, tm_info.tm_mday,
+            tm_info.tm_hour, tm_info.tm_min, tm_info.tm_sec, level);
     
     va_list args;
     va_start(args, format);
-    vfprintf(g_log_file, format, args);
+    vfprintf(out, format, args);
     va_end(args);
     
-    fprintf(g_log_file, "\n");
-    fflush(g_log_file);
+    fprintf(out, "\n");
+    fflush(out);
+    pthread_mutex_unlock(&g_log_lock);
 }
 
 /*
  * 퍼징 통계 관련 함수들
+ * 카운터는 스레드별 (다른 코어와 캐시 라인을 공유하지 않음) 이며 조회 시 합산한다.
+ * 끝난 스레드의 카운터는 g_fuzz_retired 로 옮긴 뒤 해제한다.
  */
+typedef struct FuzzStatsThread {
+    uint64_t                counts[CFS_FUZZ_INVALID_INPUT + 1];
+    uint64_t                total;
+    struct FuzzStatsThread *next;
+} __attribute__((aligned(64))) FuzzStatsThread_t;
+
+static pthread_mutex_t g_fuzz_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static FuzzStatsThread_t *g_fuzz_threads = NULL;
+static FuzzStatsThread_t g_fuzz_retired;
 static CFS_FuzzStats_t g_fuzz_stats = {0};
+static pthread_key_t g_fuzz_stats_key;
+static pthread_once_t g_fuzz_stats_once = PTHREAD_ONCE_INIT;
+static CFS_THREAD_LOCAL FuzzStatsThread_t *t_fuzz_stats = NULL;
+
+static void FuzzStats_Add(FuzzStatsThread_t *dst, const FuzzStatsThread_t *src) {
+    for (int i = 0; i <= CFS_FUZZ_INVALID_INPUT; i++) {
+        dst->counts[i] += __atomic_load_n(&src->counts[i], __ATOMIC_RELAXED);
+    }
+    dst->total += __atomic_load_n(&src->total, __ATOMIC_RELAXED);
+}
+
+static void FuzzStats_ThreadExit(void *arg) {
+    FuzzStatsThread_t *t = (FuzzStatsThread_t *)arg;
+
+    pthread_mutex_lock(&g_fuzz_stats_lock);
+    for (FuzzStatsThread_t **p = &g_fuzz_threads; *p; p = &(*p)->next) {
+        if (*p == t) {
+            *p = t->next;
+            break;
+        }
+    }
+    FuzzStats_Add(&g_fuzz_retired, t);
+    pthread_mutex_unlock(&g_fuzz_stats_lock);
+    free(t);
+}
+
+static void FuzzStats_Init(void) {
+    pthread_key_create(&g_fuzz_stats_key, FuzzStats_ThreadExit);
+}
 
+static FuzzStatsThread_t* FuzzStats_Thread(void) {
+    FuzzStatsThread_t *t = t_fuzz_stats;
+    if (t) {
+        return t;
+    }
+
+    pthread_once(&g_fuzz_stats_once, FuzzStats_Init);
+    t = calloc(1, sizeof(FuzzStatsThread_t));
+    if (!t) {
+        return NULL;
+    }
+    pthread_mutex_lock(&g_fuzz_stats_lock);
+    t->next = g_fuzz_threads;
+    g_fuzz_threads = t;
+    pthread_mutex_unlock(&g_fuzz_stats_lock);
+    pthread_setspecific(g_fuzz_stats_key, t);
+    t_fuzz_stats = t;
+    return t;
+}
+
+// 워커가 실행 중이지 않을 때 호출한다
 void CFS_InitFuzzStats(void) {
+    pthread_mutex_lock(&g_fuzz_stats_lock);
+    for (FuzzStatsThread_t *t = g_fuzz_threads; t; t = t->next) {
+        memset(t->counts, 0, sizeof(t->counts));
+        t->total = 0;
+    }
+    memset(&g_fuzz_retired, 0, sizeof(g_fuzz_retired));
     memset(&g_fuzz_stats, 0, sizeof(CFS_FuzzStats_t));
     g_fuzz_stats.start_time = time(NULL);
+    pthread_mutex_unlock(&g_fuzz_stats_lock);
 }
 
+// 자기 스레드 카운터만 쓰므로 잠금/원자적 덧셈 없이 증가 (조회 스레드는 relaxed 로 읽음)
 void CFS_UpdateFuzzStats(CFS_FuzzResult_t result) {
-    g_fuzz_stats.total_executions++;
-    
-    switch (result) {
-        case CFS_FUZZ_SUCCESS:
-            g_fuzz_stats.successful_executions++;
-            break;
-        case CFS_FUZZ_ERROR:
-            g_fuzz_stats.error_executions++;
-            break;
-        case CFS_FUZZ_CRASH:
-            g_fuzz_stats.crash_executions++;
-            break;
-        case CFS_FUZZ_TIMEOUT:
-            g_fuzz_stats.timeout_executions++;
-            break;
-        default:
-            break;
+    FuzzStatsThread_t *t = FuzzStats_Thread();
+    if (!t) {
+        return;
+    }
+
+    __atomic_store_n(&t->total, t->total + 1, __ATOMIC_RELAXED);
+    if (result >= CFS_FUZZ_SUCCESS && result <= CFS_FUZZ_INVALID_INPUT) {
+        __atomic_store_n(&t->counts[result], t->counts[result] + 1, __ATOMIC_RELAXED);
     }
 }
 
 const CFS_FuzzStats_t* CFS_GetFuzzStats(void) {
+    FuzzStatsThread_t sum;
+
+    pthread_mutex_lock(&g_fuzz_stats_lock);
+    sum = g_fuzz_retired;
+    for (FuzzStatsThread_t *t = g_fuzz_threads; t; t = t->next) {
+        FuzzStats_Add(&sum, t);
+    }
+    g_fuzz_stats.total_executions = sum.total;
+    g_fuzz_stats.successful_executions = sum.counts[CFS_FUZZ_SUCCESS];
+    g_fuzz_stats.error_executions = sum.counts[CFS_FUZZ_ERROR];
+    g_fuzz_stats.crash_executions = sum.counts[CFS_FUZZ_CRASH];
+    g_fuzz_stats.timeout_executions = sum.counts[CFS_FUZZ_TIMEOUT];
     g_fuzz_stats.elapsed_time = time(NULL) - g_fuzz_stats.start_time;
+    pthread_mutex_unlock(&g_fuzz_stats_lock);
     return &g_fuzz_stats;
 }
 
@@ -31,6 +31,7 @@ typedef struct {
 
 // MM 함수 프로토타입들
 int32_t MM_ResolveSymAddr(MM_SymAddr_t *SymAddr, uint64_t *ResolvedAddr);
+int32_t MM_ResolveSymAddrHashed(MM_SymAddr_t *SymAddr, uint64_t NameHash, uint64_t *ResolvedAddr);
 int32_t MM_VerifyMemType(uint8_t MemType);
 int32_t MM_VerifyDataSize(uint8_t DataSize);
 int32_t MM_VerifyFileName(const char *FileName);
@@ -0,0 +1,160 @@
+/*
+ * CFS 가상 시간 시계
+ *
+ * 스레드마다 입력 시작 이후의 가상 나노초와 출처별 합을 들고 있다.
+ * Mock 의 대기와 장치 지연은 이 값에 더하기만 하므로 비용이 덧셈 한 번이며,
+ * 실제 시간에 의존하지 않아 같은 입력은 같은 시각에 같은 타임아웃을 낸다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "vclock.h"
+#include "utils.h"
+
+typedef struct {
+    uint64_t file_open_ns;
+    uint64_t file_ns_per_kb;
+    uint64_t pend_forever_ns;
+    uint32_t epoch_seconds;
+} VClockConfig_t;
+
+static VClockConfig_t g_vclock_config = {
+    CFS_VCLOCK_DEFAULT_FILE_OPEN_US * 1000ULL,
+    CFS_VCLOCK_DEFAULT_FILE_US_PER_KB * 1000ULL,
+    CFS_VCLOCK_DEFAULT_PEND_FOREVER_MS * 1000000ULL,
+    0
+};
+static CFS_VClockStats_t g_vclock_stats;
+static CFS_THREAD_LOCAL CFS_VClockState_t t_vclock;
+
+static const char * const g_vclock_source_names[CFS_VCLOCK_SOURCE_COUNT] = {
+    "delay", "pend", "file", "eeprom"
+};
+
+void CFS_VClock_Configure(uint32_t file_open_us, uint32_t file_us_per_kb,
+                          uint32_t pend_forever_ms, uint32_t epoch_seconds) {
+    g_vclock_config.file_open_ns = (uint64_t)file_open_us * 1000ULL;
+    g_vclock_config.file_ns_per_kb = (uint64_t)file_us_per_kb * 1000ULL;
+    g_vclock_config.pend_forever_ns = (uint64_t)pend_forever_ms * 1000000ULL;
+    g_vclock_config.epoch_seconds = epoch_seconds;
+}
+
+static uint32_t VClock_EnvNumber(const char *name, uint32_t default_value) {
+    const char *value = getenv(name);
+    if (!value || value[0] == '\0') {
+        return default_value;
+    }
+    return (uint32_t)strtoul(value, NULL, 0);
+}
+
+void CFS_VClock_ConfigureFromEnv(void) {
+    CFS_VClock_Configure(VClock_EnvNumber("CFS_VCLOCK_FILE_OPEN_US", CFS_VCLOCK_DEFAULT_FILE_OPEN_US),
+                         VClock_EnvNumber("CFS_VCLOCK_FILE_US_PER_KB", CFS_VCLOCK_DEFAULT_FILE_US_PER_KB),
+                         VClock_EnvNumber("CFS_VCLOCK_PEND_FOREVER_MS", CFS_VCLOCK_DEFAULT_PEND_FOREVER_MS),
+                         VClock_EnvNumber("CFS_VCLOCK_EPOCH", 0));
+}
+
+void CFS_VClock_Advance(CFS_VClockSource_t source, uint64_t ns) {
+    t_vclock.now_ns += ns;
+    t_vclock.source_ns[source] += ns;
+}
+
+uint64_t CFS_VClock_Now(void) {
+    return t_vclock.now_ns;
+}
+
+void CFS_VClock_Pend(int32_t timeout_ms) {
+    uint64_t ns;
+
+    if (timeout_ms < 0) {
+        ns = g_vclock_config.pend_forever_ns;
+        t_vclock.forever_pends++;
+    } else {
+        ns = (uint64_t)timeout_ms * 1000000ULL;
+    }
+    t_vclock.timeouts++;
+    CFS_VClock_Advance(CFS_VCLOCK_PEND, ns);
+}
+
+CFE_TIME_SysTime_t CFS_VClock_SysTime(void) {
+    CFE_TIME_SysTime_t time;
+    uint64_t now = t_vclock.now_ns;
+
+    time.Seconds = g_vclock_config.epoch_seconds + (uint32_t)(now / 1000000000ULL);
+    time.Subseconds = (uint32_t)(((now % 1000000000ULL) << 32) / 1000000000ULL);
+    return time;
+}
+
+void CFS_VClock_FileAccess(uint32_t bytes) {
+    CFS_VClock_Advance(CFS_VCLOCK_FILE, g_vclock_config.file_open_ns +
+                       ((uint64_t)bytes * g_vclock_config.file_ns_per_kb) / 1024);
+}
+
+void CFS_VClock_BeginInput(void) {
+    memset(&t_vclock, 0, sizeof(t_vclock));
+}
+
+static void VClock_StoreMax(uint64_t *target, uint64_t value) {
+    uint64_t max = __atomic_load_n(target, __ATOMIC_RELAXED);
+    while (value > max &&
+           !__atomic_compare_exchange_n(target, &max, value, TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+uint64_t CFS_VClock_EndInput(void) {
+    const CFS_VClockState_t *clock = &t_vclock;
+    CFS_VClockStats_t *stats = &g_vclock_stats;
+
+    __atomic_fetch_add(&stats->inputs, 1, __ATOMIC_RELAXED);
+    if (clock->now_ns == 0) {
+        return 0;
+    }
+    __atomic_fetch_add(&stats->total_ns, clock->now_ns, __ATOMIC_RELAXED);
+    for (int s = 0; s < CFS_VCLOCK_SOURCE_COUNT; s++) {
+        if (clock->source_ns[s]) {
+            __atomic_fetch_add(&stats->source_ns[s], clock->source_ns[s], __ATOMIC_RELAXED);
+        }
+    }
+    if (clock->timeouts) {
+        __atomic_fetch_add(&stats->timeouts, clock->timeouts, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&stats->forever_pends, clock->forever_pends, __ATOMIC_RELAXED);
+    }
+    VClock_StoreMax(&stats->max_ns, clock->now_ns);
+    return clock->now_ns;
+}
+
+uint64_t CFS_VClock_InputNs(void) {
+    return t_vclock.now_ns;
+}
+
+void CFS_VClock_Save(CFS_VClockState_t *state) {
+    *state = t_vclock;
+}
+
+void CFS_VClock_Restore(const CFS_VClockState_t *state) {
+    t_vclock = *state;
+}
+
+const CFS_VClockStats_t* CFS_VClock_GetStats(void) {
+    return &g_vclock_stats;
+}
+
+void CFS_VClock_PrintStats(void) {
+    const CFS_VClockStats_t *stats = CFS_VClock_GetStats();
+
+    if (stats->total_ns == 0) {
+        return;
+    }
+
+    printf("\n=== Virtual Clock Statistics ===\n");
+    printf("Inputs: %lu, virtual time: %.3f s (mean %.3f ms, max %.3f ms)\n",
+           stats->inputs, (double)stats->total_ns / 1e9,
+           stats->inputs ? (double)stats->total_ns / 1e6 / (double)stats->inputs : 0.0,
+           (double)stats->max_ns / 1e6);
+    for (int s = 0; s < CFS_VCLOCK_SOURCE_COUNT; s++) {
+        printf("  %-8s %12.3f ms\n", g_vclock_source_names[s], (double)stats->source_ns[s] / 1e6);
+    }
+    printf("Timeouts: %lu (PEND_FOREVER capped at %lu ms: %lu)\n", stats->timeouts,
+           (unsigned long)(g_vclock_config.pend_forever_ns / 1000000ULL), stats->forever_pends);
+    printf("================================\n");
+}
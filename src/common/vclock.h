@@ -0,0 +1,68 @@
+/*
+ * CFS 가상 시간 시계 헤더
+ * cfe_mock.h 의 Mock 들은 기다리는 대신 스레드별 가상 시계를 즉시 앞당긴다.
+ *   - OS_TaskDelay, 세그먼트 사이 양보는 지연 시간만큼 더하고 곧바로 반환
+ *   - 모의 파이프에는 메시지가 오지 않으므로 CFE_SB_ReceiveBuffer 대기는 정확히
+ *     타임아웃 시각에 CFE_SB_TIME_OUT 으로 끝난다 (PEND_FOREVER 는 설정한 한도)
+ *   - 파일 접근, EEPROM 프로그램 같은 장치 지연도 출처별로 더한다
+ *   - CFE_TIME_GetTime 은 기준 시각 + 가상 시계
+ * 시계는 입력마다 0 에서 시작하고 스냅샷과 함께 저장/복원되므로
+ * 같은 입력은 항상 같은 가상 시간을 보고한다.
+ *
+ * 환경 변수
+ *   CFS_VCLOCK_FILE_OPEN_US=N       파일 열기 한 번의 지연 (기본 500)
+ *   CFS_VCLOCK_FILE_US_PER_KB=N     파일 1KB 전송 지연 (기본 100, 약 10MB/s)
+ *   CFS_VCLOCK_PEND_FOREVER_MS=N    PEND_FOREVER 대기를 끝내는 한도 (기본 10000)
+ *   CFS_VCLOCK_EPOCH=N              CFE_TIME_GetTime 기준 초 (기본 0)
+ */
+
+#ifndef CFS_VCLOCK_H
+#define CFS_VCLOCK_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+#define CFS_VCLOCK_DEFAULT_FILE_OPEN_US     500
+#define CFS_VCLOCK_DEFAULT_FILE_US_PER_KB   100
+#define CFS_VCLOCK_DEFAULT_PEND_FOREVER_MS  10000
+
+// 시계 상태 (스냅샷, 차분 실행의 참조 쪽 되감기용)
+typedef struct {
+    uint64_t now_ns;                                // 입력 시작 이후 가상 시간
+    uint64_t source_ns[CFS_VCLOCK_SOURCE_COUNT];    // 출처별 합
+    uint32_t timeouts;                              // 타임아웃으로 끝난 대기
+    uint32_t forever_pends;                         // 그중 PEND_FOREVER 대기
+} CFS_VClockState_t;
+
+// 전체 통계 (모든 스레드 합)
+typedef struct {
+    uint64_t inputs;
+    uint64_t total_ns;
+    uint64_t max_ns;                                // 입력 하나의 최대 가상 시간
+    uint64_t source_ns[CFS_VCLOCK_SOURCE_COUNT];
+    uint64_t timeouts;
+    uint64_t forever_pends;
+} CFS_VClockStats_t;
+
+// 동작 설정 (워커 스레드 시작 전에만)
+void CFS_VClock_Configure(uint32_t file_open_us, uint32_t file_us_per_kb,
+                          uint32_t pend_forever_ms, uint32_t epoch_seconds);
+void CFS_VClock_ConfigureFromEnv(void);
+
+// 파일 하나를 열어 bytes 바이트를 읽거나 쓴 지연
+void CFS_VClock_FileAccess(uint32_t bytes);
+
+// 입력 경계: Begin 은 시계를 0 으로, End 는 이번 입력의 가상 시간을 전체 통계에 더하고 반환
+void CFS_VClock_BeginInput(void);
+uint64_t CFS_VClock_EndInput(void);
+
+// 현재 스레드의 마지막 (또는 진행 중인) 입력의 가상 시간
+uint64_t CFS_VClock_InputNs(void);
+
+void CFS_VClock_Save(CFS_VClockState_t *state);
+void CFS_VClock_Restore(const CFS_VClockState_t *state);
+
+const CFS_VClockStats_t* CFS_VClock_GetStats(void);
+void CFS_VClock_PrintStats(void);
+
+#endif // CFS_VCLOCK_H
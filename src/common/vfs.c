@@ -0,0 +1,189 @@
+/*
+ * CFS 인메모리 파일 시스템 (VFS)
+ *
+ * 경로 → 블록 테이블은 스레드별 고정 배열이다. 블록은 쓰기 시 새로 만들고
+ * 수정하지 않으므로, 스냅샷은 테이블을 복사하고 참조 카운트만 올린다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "vfs.h"
+#include "mock_trace.h"
+
+typedef struct {
+    uint32_t refs;
+    uint32_t size;
+    uint8_t  data[];
+} VfsBlob_t;
+
+typedef struct {
+    char       path[OS_MAX_PATH_LEN];
+    VfsBlob_t *blob;
+} VfsEntry_t;
+
+struct CFS_VfsImage {
+    uint32_t   count;
+    VfsEntry_t entries[CFS_VFS_MAX_FILES];
+};
+
+typedef struct {
+    uint32_t   count;
+    VfsEntry_t entries[CFS_VFS_MAX_FILES];
+} Vfs_t;
+
+static CFS_THREAD_LOCAL Vfs_t t_vfs;
+
+static void Vfs_Release(VfsBlob_t *blob) {
+    if (blob && --blob->refs == 0) {
+        free(blob);
+    }
+}
+
+static int Vfs_Find(const char *path) {
+    for (uint32_t i = 0; i < t_vfs.count; i++) {
+        if (strncmp(t_vfs.entries[i].path, path, OS_MAX_PATH_LEN) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+int32_t CFS_Vfs_CreateFile(const char *path, uint32_t size, uint8_t **data) {
+    if (!path || !data) {
+        return OS_INVALID_POINTER;
+    }
+    if (path[0] == '\0' || strlen(path) >= OS_MAX_PATH_LEN) {
+        return CFS_MM_ERROR_INVALID_FILE;
+    }
+
+    int index = Vfs_Find(path);
+    if (index < 0 && t_vfs.count >= CFS_VFS_MAX_FILES) {
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+
+    VfsBlob_t *blob = malloc(sizeof(VfsBlob_t) + size);
+    if (!blob) {
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
+    }
+    blob->refs = 1;
+    blob->size = size;
+
+    if (index < 0) {
+        index = (int)t_vfs.count++;
+        strncpy(t_vfs.entries[index].path, path, OS_MAX_PATH_LEN - 1);
+        t_vfs.entries[index].path[OS_MAX_PATH_LEN - 1] = '\0';
+    } else {
+        Vfs_Release(t_vfs.entries[index].blob);
+    }
+    t_vfs.entries[index].blob = blob;
+    *data = blob->data;
+    return CFE_SUCCESS;
+}
+
+int32_t CFS_Vfs_WriteFile(const char *path, const void *data, uint32_t size) {
+    if (!data && size > 0) {
+        return OS_INVALID_POINTER;
+    }
+
+    uint8_t *dst = NULL;
+    int32_t status = CFS_Vfs_CreateFile(path, size, &dst);
+    if (status == CFE_SUCCESS && size > 0) {
+        memcpy(dst, data, size);
+    }
+    return status;
+}
+
+int32_t CFS_Vfs_ReadFile(const char *path, const uint8_t **data, uint32_t *size) {
+    if (!path || !data || !size) {
+        return OS_INVALID_POINTER;
+    }
+
+    int index = Vfs_Find(path);
+    int32_t status = CFS_MM_ERROR_FILE_ACCESS;
+    if (index >= 0) {
+        *data = t_vfs.entries[index].blob->data;
+        *size = t_vfs.entries[index].blob->size;
+        status = CFE_SUCCESS;
+    }
+
+    // 내용은 입력에서 정해지므로 기록은 비교용 지문만 (앞부분 64 바이트)
+    if (CFS_MockTrace_Enabled()) {
+        const int64_t in[1] = { CFS_MockTrace_Fingerprint(path, strnlen(path, OS_MAX_PATH_LEN)) };
+        const int64_t out[3] = {
+            status, (status == CFE_SUCCESS) ? *size : 0,
+            (status == CFE_SUCCESS) ? CFS_MockTrace_Fingerprint(*data, (*size < 64) ? *size : 64) : 0
+        };
+        CFS_MockTrace_Record(CFS_MOCK_TRACE_FILE_READ, in, out);
+    }
+    return status;
+}
+
+int32_t CFS_Vfs_Remove(const char *path) {
+    if (!path) {
+        return OS_INVALID_POINTER;
+    }
+
+    int index = Vfs_Find(path);
+    if (index < 0) {
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+
+    Vfs_Release(t_vfs.entries[index].blob);
+    t_vfs.entries[index] = t_vfs.entries[--t_vfs.count];
+    return CFE_SUCCESS;
+}
+
+uint32_t CFS_Vfs_Count(void) {
+    return t_vfs.count;
+}
+
+void CFS_Vfs_Clear(void) {
+    for (uint32_t i = 0; i < t_vfs.count; i++) {
+        Vfs_Release(t_vfs.entries[i].blob);
+    }
+    t_vfs.count = 0;
+}
+
+CFS_VfsImage_t* CFS_Vfs_Capture(void) {
+    CFS_VfsImage_t *image = malloc(sizeof(*image));
+    if (!image) {
+        return NULL;
+    }
+
+    image->count = t_vfs.count;
+    for (uint32_t i = 0; i < t_vfs.count; i++) {
+        image->entries[i] = t_vfs.entries[i];
+        image->entries[i].blob->refs++;
+    }
+    return image;
+}
+
+int32_t CFS_Vfs_Restore(const CFS_VfsImage_t *image) {
+    if (!image) {
+        return OS_INVALID_POINTER;
+    }
+
+    // 이미지 블록을 먼저 잡아두고 현재 블록을 놓는다 (같은 블록 공유 시 안전)
+    for (uint32_t i = 0; i < image->count; i++) {
+        image->entries[i].blob->refs++;
+    }
+    CFS_Vfs_Clear();
+
+    t_vfs.count = image->count;
+    memcpy(t_vfs.entries, image->entries, image->count * sizeof(VfsEntry_t));
+    return CFE_SUCCESS;
+}
+
+size_t CFS_Vfs_ImageBytes(const CFS_VfsImage_t *image) {
+    return image ? sizeof(*image) : 0;
+}
+
+void CFS_Vfs_FreeImage(CFS_VfsImage_t *image) {
+    if (!image) {
+        return;
+    }
+    for (uint32_t i = 0; i < image->count; i++) {
+        Vfs_Release(image->entries[i].blob);
+    }
+    free(image);
+}
@@ -0,0 +1,40 @@
+/*
+ * CFS 인메모리 파일 시스템 (VFS) 헤더
+ * 하니스가 로드/덤프하는 파일을 실제 디스크 대신 메모리에 보관한다.
+ * 파일 내용은 참조 카운트된 불변 블록이므로 스냅샷은 테이블 복사만으로 끝난다.
+ */
+
+#ifndef CFS_VFS_H
+#define CFS_VFS_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+
+// 스레드당 최대 파일 수
+#ifndef CFS_VFS_MAX_FILES
+#define CFS_VFS_MAX_FILES           32
+#endif
+
+// VFS 스냅샷 (불투명 타입, 캡처한 스레드에서만 사용)
+typedef struct CFS_VfsImage CFS_VfsImage_t;
+
+// 파일 쓰기 (내용 복사, 같은 경로가 있으면 교체)
+int32_t CFS_Vfs_WriteFile(const char *path, const void *data, uint32_t size);
+
+// 빈 파일 생성 (같은 경로가 있으면 교체), data 는 다음 VFS 호출 전까지 채워야 하는 내용 버퍼
+int32_t CFS_Vfs_CreateFile(const char *path, uint32_t size, uint8_t **data);
+
+// 파일 읽기 (반환 포인터는 해당 경로가 바뀌거나 삭제될 때까지 유효)
+int32_t CFS_Vfs_ReadFile(const char *path, const uint8_t **data, uint32_t *size);
+
+int32_t CFS_Vfs_Remove(const char *path);
+uint32_t CFS_Vfs_Count(void);
+void CFS_Vfs_Clear(void);
+
+// 스냅샷
+CFS_VfsImage_t* CFS_Vfs_Capture(void);
+int32_t CFS_Vfs_Restore(const CFS_VfsImage_t *image);
+size_t CFS_Vfs_ImageBytes(const CFS_VfsImage_t *image);
+void CFS_Vfs_FreeImage(CFS_VfsImage_t *image);
+
+#endif // CFS_VFS_H
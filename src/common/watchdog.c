@@ -0,0 +1,484 @@
+/*
+ * CFS 실행별 워치독
+ *
+ * 실행 흐름
+ *   Begin - 스레드 타이머를 예산만큼 뒤로 재무장 (timer_settime 한 번, 해제는 하지 않음)
+ *   신호  - 아직 같은 실행 중이고 마감이 지났으면 단계와 스택을 잡고 그 자리에서
+ *           입력/보고서를 기록한다 (멈춘 채 끝나지 않는 입력, fatal 모드의 abort 전)
+ *   End   - 경과 시간으로 초과 여부를 확정하고 통계 갱신, 신호 전에 끝난 초과 입력은
+ *           여기서 기록하고 신호 때 기록한 보고서에는 최종 경과 시간을 덧붙인다
+ * 실행이 예산 안에 끝나면 타이머는 나중에 울려도 무시된다 (active == 0 또는 마감 전).
+ * 기록 경로는 신호 처리기에서도 쓰이므로 open/write/close 와 직접 만든 문자열만 사용한다.
+ */
+
+#define _GNU_SOURCE
+
+#include "watchdog.h"
+#include "replay.h"
+
+#include <errno.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+// libFuzzer 의 -timeout (SIGALRM) 과 겹치지 않는 실시간 신호
+#define WATCHDOG_SIGNAL         (SIGRTMIN + 3)
+
+static const char *const g_wd_cmd_names[CFS_WATCHDOG_CMD_COUNT] = {
+    [CFS_WATCHDOG_CMD_LOAD]     = "load",
+    [CFS_WATCHDOG_CMD_DUMP]     = "dump",
+    [CFS_WATCHDOG_CMD_FILL]     = "fill",
+    [CFS_WATCHDOG_CMD_SEQUENCE] = "sequence",
+};
+
+typedef struct {
+    boolean enabled;
+    boolean fatal;
+    char    dir[512];
+} WatchdogConfig_t;
+
+static WatchdogConfig_t g_wd_config = { TRUE, FALSE, "" };
+
+static CFS_WatchdogStats_t g_wd_stats[CFS_WATCHDOG_CMD_COUNT] = {
+    [CFS_WATCHDOG_CMD_LOAD]     = { 0, 0, 0, CFS_WATCHDOG_DEFAULT_BUDGET_US },
+    [CFS_WATCHDOG_CMD_DUMP]     = { 0, 0, 0, CFS_WATCHDOG_DEFAULT_BUDGET_US },
+    [CFS_WATCHDOG_CMD_FILL]     = { 0, 0, 0, CFS_WATCHDOG_DEFAULT_BUDGET_US },
+    [CFS_WATCHDOG_CMD_SEQUENCE] = { 0, 0, 0, CFS_WATCHDOG_SEQUENCE_BUDGET_US },
+};
+
+static uint32_t g_wd_findings = 0;
+
+// 스레드별 상태 (신호 처리기는 sigev_value 로 받은 포인터로 접근)
+typedef struct {
+    timer_t                timer;
+    boolean                timer_ready;
+    volatile sig_atomic_t  active;
+    volatile sig_atomic_t  fired;
+    volatile sig_atomic_t  saved;       // 신호 처리기가 보고서를 기록함
+    CFS_WatchdogCmd_t      cmd;
+    const char *volatile   stage;
+    const char            *stuck_stage;
+    const uint8_t         *data;
+    size_t                 size;
+    uint64_t               start_ns;
+    uint64_t               deadline_ns;
+    int                    depth;
+    void                  *frames[CFS_WATCHDOG_MAX_FRAMES];
+} WatchdogThread_t;
+
+static CFS_THREAD_LOCAL WatchdogThread_t *t_wd = NULL;
+
+static pthread_once_t g_wd_once = PTHREAD_ONCE_INIT;
+static pthread_key_t  g_wd_key;
+
+static uint64_t Watchdog_NowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void Watchdog_WriteStr(const char *s) {
+    ssize_t r = write(STDERR_FILENO, s, strlen(s));
+    (void)r;
+}
+
+// 부분 쓰기를 이어서 끝까지 쓰기
+static boolean Watchdog_WriteAll(int fd, const void *data, size_t size) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (size > 0) {
+        ssize_t written = write(fd, p, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return FALSE;
+        }
+        p += written;
+        size -= (size_t)written;
+    }
+    return TRUE;
+}
+
+// 신호 처리기에서 쓸 수 있는 문자열 조립 (snprintf 대신, 넘치면 잘라냄)
+typedef struct {
+    char   buf[1024];
+    size_t len;
+} WatchdogText_t;
+
+static void Watchdog_Put(WatchdogText_t *t, const char *s) {
+    while (*s && t->len + 1 < sizeof(t->buf)) {
+        t->buf[t->len++] = *s++;
+    }
+    t->buf[t->len] = '\0';
+}
+
+static void Watchdog_PutDec(WatchdogText_t *t, uint64_t value) {
+    char digits[24];
+    int n = 0;
+    do {
+        digits[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (n > 0 && t->len + 1 < sizeof(t->buf)) {
+        t->buf[t->len++] = digits[--n];
+    }
+    t->buf[t->len] = '\0';
+}
+
+static void Watchdog_PutHex64(WatchdogText_t *t, uint64_t value) {
+    static const char hex[] = "0123456789abcdef";
+    for (int shift = 60; shift >= 0 && t->len + 1 < sizeof(t->buf); shift -= 4) {
+        t->buf[t->len++] = hex[(value >> shift) & 0xF];
+    }
+    t->buf[t->len] = '\0';
+}
+
+// "<dir>/timeout-<명령>-<입력 해시>" (보고서는 뒤에 .txt)
+static void Watchdog_FindingPath(WatchdogText_t *t, const WatchdogThread_t *wd) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < wd->size; i++) {
+        hash ^= wd->data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    t->len = 0;
+    Watchdog_Put(t, g_wd_config.dir);
+    Watchdog_Put(t, "/timeout-");
+    Watchdog_Put(t, g_wd_cmd_names[wd->cmd]);
+    Watchdog_Put(t, "-");
+    Watchdog_PutHex64(t, hash);
+}
+
+/*
+ * 예산 초과 입력과 보고서를 CFS_WATCHDOG_DIR 에 기록 (같은 입력은 파일 이름이 같아 한 번만 저장)
+ * 신호 처리기에서도 호출되므로 async-signal-safe 한 호출만 사용한다.
+ * running 이면 아직 실행 중 (신호 시점의 경과 시간)
+ * @return: 보고서를 썼으면 TRUE
+ */
+static boolean Watchdog_SaveFinding(WatchdogThread_t *wd, const char *stage, uint64_t elapsed_ns,
+                                    uint32_t budget_us, boolean running) {
+    if (__atomic_fetch_add(&g_wd_findings, 1, __ATOMIC_RELAXED) >= CFS_WATCHDOG_MAX_FINDINGS) {
+        return FALSE;
+    }
+
+    WatchdogText_t path;
+    Watchdog_FindingPath(&path, wd);
+    int fd = open(path.buf, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        if (errno == EEXIST) {
+            __atomic_fetch_sub(&g_wd_findings, 1, __ATOMIC_RELAXED);
+        }
+        return FALSE;
+    }
+    boolean ok = Watchdog_WriteAll(fd, wd->data, wd->size);
+    close(fd);
+    if (!ok) {
+        return FALSE;
+    }
+
+    Watchdog_Put(&path, ".txt");
+    fd = open(path.buf, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return FALSE;
+    }
+
+    WatchdogText_t report = { .len = 0 };
+    Watchdog_Put(&report, "command: ");
+    Watchdog_Put(&report, g_wd_cmd_names[wd->cmd]);
+    Watchdog_Put(&report, "\nstage: ");
+    Watchdog_Put(&report, stage ? stage : "unknown");
+    Watchdog_Put(&report, "\nbudget_us: ");
+    Watchdog_PutDec(&report, budget_us);
+    Watchdog_Put(&report, "\nelapsed_us: ");
+    Watchdog_PutDec(&report, elapsed_ns / 1000);
+    Watchdog_Put(&report, running ? " (still running at the timer signal)" : "");
+    Watchdog_Put(&report, "\nsize: ");
+    Watchdog_PutDec(&report, wd->size);
+    Watchdog_Put(&report, wd->fired ? "\nstack:\n"
+                                    : "\nstack: (finished before the timer signal was delivered)\n");
+    ok = Watchdog_WriteAll(fd, report.buf, report.len);
+    if (ok && wd->fired) {
+        backtrace_symbols_fd(wd->frames, wd->depth, fd);
+    }
+    close(fd);
+    return ok;
+}
+
+/*
+ * 신호 처리기 (async-signal-safe 한 호출만 사용, backtrace 는 초기화 때 미리 한 번 호출)
+ * 멈춘 입력은 End 에 도달하지 못할 수 있으므로 여기서 바로 기록한다.
+ */
+static void Watchdog_Handler(int signo, siginfo_t *info, void *context) {
+    (void)signo;
+    (void)context;
+
+    WatchdogThread_t *wd = (WatchdogThread_t *)info->si_value.sival_ptr;
+    if (!wd || !wd->active || wd->fired || Watchdog_NowNs() < wd->deadline_ns) {
+        return;
+    }
+
+    int saved_errno = errno;
+    const char *stage = wd->stage;
+    wd->stuck_stage = stage;
+    wd->depth = backtrace(wd->frames, CFS_WATCHDOG_MAX_FRAMES);
+    wd->fired = 1;
+
+    if (g_wd_config.dir[0] != '\0') {
+        wd->saved = Watchdog_SaveFinding(wd, stage, Watchdog_NowNs() - wd->start_ns,
+                                         g_wd_stats[wd->cmd].budget_us, TRUE);
+    }
+
+    if (g_wd_config.fatal) {
+        Watchdog_WriteStr("==CFS_WATCHDOG== budget exceeded: command ");
+        Watchdog_WriteStr(g_wd_cmd_names[wd->cmd]);
+        Watchdog_WriteStr(", stage ");
+        Watchdog_WriteStr(stage ? stage : "unknown");
+        Watchdog_WriteStr("\n");
+        backtrace_symbols_fd(wd->frames, wd->depth, STDERR_FILENO);
+        abort();
+    }
+    errno = saved_errno;
+}
+
+static void Watchdog_ThreadExit(void *arg) {
+    WatchdogThread_t *wd = (WatchdogThread_t *)arg;
+    if (wd->timer_ready) {
+        timer_delete(wd->timer);
+    }
+    free(wd);
+}
+
+static void Watchdog_Init(void) {
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = Watchdog_Handler;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    sigaction(WATCHDOG_SIGNAL, &sa, NULL);
+
+    pthread_key_create(&g_wd_key, Watchdog_ThreadExit);
+
+    // backtrace 의 첫 호출은 libgcc 를 적재하므로 신호 처리기 밖에서 미리 호출
+    void *frame;
+    (void)backtrace(&frame, 1);
+}
+
+// 호출 스레드의 상태와 타이머 (처음 한 번 생성)
+static WatchdogThread_t* Watchdog_Thread(void) {
+    if (t_wd) {
+        return t_wd;
+    }
+    pthread_once(&g_wd_once, Watchdog_Init);
+
+    WatchdogThread_t *wd = calloc(1, sizeof(WatchdogThread_t));
+    if (!wd) {
+        return NULL;
+    }
+
+    struct sigevent sev;
+    memset(&sev, 0, sizeof(sev));
+    sev.sigev_notify = SIGEV_THREAD_ID;
+    sev.sigev_signo = WATCHDOG_SIGNAL;
+    sev.sigev_value.sival_ptr = wd;
+    sev.sigev_notify_thread_id = (pid_t)syscall(SYS_gettid);
+    wd->timer_ready = (timer_create(CLOCK_MONOTONIC, &sev, &wd->timer) == 0);
+    if (!wd->timer_ready) {
+        CFS_WARN_PRINT("Watchdog timer unavailable (errno %d), using elapsed time only", errno);
+    }
+
+    pthread_setspecific(g_wd_key, wd);
+    t_wd = wd;
+    return wd;
+}
+
+/*
+ * 설정
+ */
+void CFS_Watchdog_SetBudget(CFS_WatchdogCmd_t cmd, uint32_t budget_us) {
+    if (cmd < CFS_WATCHDOG_CMD_COUNT) {
+        g_wd_stats[cmd].budget_us = budget_us;
+    }
+}
+
+// "load=800,fill=200" 형식의 명령별 예산
+static void Watchdog_ParseBudgets(const char *spec) {
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), "%s", spec);
+
+    char *save = NULL;
+    for (char *item = strtok_r(buffer, ",", &save); item; item = strtok_r(NULL, ",", &save)) {
+        char *eq = strchr(item, '=');
+        if (!eq) {
+            continue;
+        }
+        *eq = '\0';
+        for (int cmd = 0; cmd < CFS_WATCHDOG_CMD_COUNT; cmd++) {
+            if (strcmp(item, g_wd_cmd_names[cmd]) == 0) {
+                CFS_Watchdog_SetBudget((CFS_WatchdogCmd_t)cmd, (uint32_t)strtoul(eq + 1, NULL, 10));
+            }
+        }
+    }
+}
+
+void CFS_Watchdog_ConfigureFromEnv(void) {
+    const char *env = getenv("CFS_WATCHDOG");
+    g_wd_config.enabled = !(env && env[0] == '0');
+
+    env = getenv("CFS_WATCHDOG_FATAL");
+    g_wd_config.fatal = (env && env[0] != '\0' && env[0] != '0');
+
+    env = getenv("CFS_WATCHDOG_DIR");
+    snprintf(g_wd_config.dir, sizeof(g_wd_config.dir), "%s", env ? env : "");
+
+    env = getenv("CFS_WATCHDOG_US");
+    if (env && env[0] != '\0') {
+        uint32_t budget_us = (uint32_t)strtoul(env, NULL, 10);
+        for (int cmd = 0; cmd < CFS_WATCHDOG_CMD_COUNT; cmd++) {
+            CFS_Watchdog_SetBudget((CFS_WatchdogCmd_t)cmd, budget_us);
+        }
+    }
+
+    env = getenv("CFS_WATCHDOG_BUDGET");
+    if (env && env[0] != '\0') {
+        Watchdog_ParseBudgets(env);
+    }
+}
+
+/*
+ * 실행 감시
+ */
+void CFS_Watchdog_Begin(CFS_WatchdogCmd_t cmd, const uint8_t *data, size_t size) {
+    if (!g_wd_config.enabled || cmd >= CFS_WATCHDOG_CMD_COUNT) {
+        return;
+    }
+    WatchdogThread_t *wd = Watchdog_Thread();
+    if (!wd) {
+        return;
+    }
+
+    uint64_t budget_ns = (uint64_t)g_wd_stats[cmd].budget_us * 1000ULL;
+    wd->cmd = cmd;
+    wd->data = data;
+    wd->size = size;
+    wd->stage = NULL;
+    wd->stuck_stage = NULL;
+    wd->depth = 0;
+    wd->fired = 0;
+    wd->saved = 0;
+    wd->start_ns = Watchdog_NowNs();
+    wd->deadline_ns = wd->start_ns + budget_ns;
+    wd->active = 1;
+
+    if (wd->timer_ready && budget_ns > 0) {
+        struct itimerspec its;
+        memset(&its, 0, sizeof(its));
+        its.it_value.tv_sec = (time_t)(budget_ns / 1000000000ULL);
+        its.it_value.tv_nsec = (long)(budget_ns % 1000000000ULL);
+        timer_settime(wd->timer, 0, &its, NULL);
+    }
+}
+
+void CFS_Watchdog_Stage(const char *stage) {
+    WatchdogThread_t *wd = t_wd;
+    if (wd) {
+        wd->stage = stage;
+    }
+}
+
+// End 에서 초과를 확정한 입력 기록
+static void Watchdog_Record(WatchdogThread_t *wd, uint64_t elapsed_ns, uint32_t budget_us) {
+    const char *cmd = g_wd_cmd_names[wd->cmd];
+    const char *stage = wd->fired ? wd->stuck_stage : wd->stage;
+    if (!stage) {
+        stage = "unknown";
+    }
+
+    if (g_wd_config.dir[0] == '\0') {
+        fprintf(stderr, "==CFS_WATCHDOG== %s input (%zu bytes) took %lu us > %u us budget, stage %s\n",
+                cmd, wd->size, (unsigned long)(elapsed_ns / 1000), budget_us, stage);
+        return;
+    }
+    if (!wd->saved) {
+        (void)Watchdog_SaveFinding(wd, stage, elapsed_ns, budget_us, FALSE);
+        return;
+    }
+
+    // 신호 때 쓴 보고서에 실제로 끝난 시간을 덧붙인다
+    WatchdogText_t path;
+    Watchdog_FindingPath(&path, wd);
+    Watchdog_Put(&path, ".txt");
+    FILE *f = fopen(path.buf, "a");
+    if (f) {
+        fprintf(f, "finished_us: %lu\n", (unsigned long)(elapsed_ns / 1000));
+        fclose(f);
+    }
+}
+
+CFS_FuzzResult_t CFS_Watchdog_End(int32_t status) {
+    CFS_FuzzResult_t result;
+    if (status == CFS_REPLAY_STATUS_REJECTED) {
+        result = CFS_FUZZ_INVALID_INPUT;
+    } else {
+        result = (status == CFE_SUCCESS) ? CFS_FUZZ_SUCCESS : CFS_FUZZ_ERROR;
+    }
+
+    WatchdogThread_t *wd = t_wd;
+    if (wd && wd->active) {
+        uint64_t elapsed_ns = Watchdog_NowNs() - wd->start_ns;
+        wd->active = 0;
+
+        CFS_WatchdogStats_t *stats = &g_wd_stats[wd->cmd];
+        __atomic_fetch_add(&stats->runs, 1, __ATOMIC_RELAXED);
+        uint64_t max_ns = __atomic_load_n(&stats->max_ns, __ATOMIC_RELAXED);
+        while (elapsed_ns > max_ns &&
+               !__atomic_compare_exchange_n(&stats->max_ns, &max_ns, elapsed_ns, TRUE,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        }
+
+        uint32_t budget_us = stats->budget_us;
+        if (budget_us > 0 && (wd->fired || elapsed_ns > (uint64_t)budget_us * 1000ULL)) {
+            result = CFS_FUZZ_TIMEOUT;
+            __atomic_fetch_add(&stats->timeouts, 1, __ATOMIC_RELAXED);
+            Watchdog_Record(wd, elapsed_ns, budget_us);
+        }
+    }
+
+    CFS_UpdateFuzzStats(result);
+    return result;
+}
+
+/*
+ * 통계
+ */
+const CFS_WatchdogStats_t* CFS_Watchdog_GetStats(void) {
+    return g_wd_stats;
+}
+
+void CFS_Watchdog_PrintStats(void) {
+    if (!g_wd_config.enabled) {
+        return;
+    }
+
+    printf("\n=== Watchdog Statistics ===\n");
+    printf("%-10s %10s %10s %10s %10s\n", "Command", "Budget(us)", "Runs", "Timeouts", "Max(us)");
+    for (int cmd = 0; cmd < CFS_WATCHDOG_CMD_COUNT; cmd++) {
+        const CFS_WatchdogStats_t *stats = &g_wd_stats[cmd];
+        if (stats->runs == 0) {
+            continue;
+        }
+        printf("%-10s %10u %10lu %10lu %10lu\n", g_wd_cmd_names[cmd], stats->budget_us,
+               (unsigned long)stats->runs, (unsigned long)stats->timeouts,
+               (unsigned long)(stats->max_ns / 1000));
+    }
+    if (g_wd_config.dir[0] != '\0' && g_wd_findings > 0) {
+        printf("Timeout inputs saved in: %s\n", g_wd_config.dir);
+    }
+    printf("===========================\n");
+}
@@ -0,0 +1,81 @@
+/*
+ * CFS 실행별 워치독 헤더
+ * 입력 하나의 실행에 명령 종류별 시간 예산을 걸고, 예산을 넘긴 입력을
+ * 멈춰 있던 단계와 스택과 함께 기록한다 (성능 발견 사항).
+ *
+ * 스레드마다 CLOCK_MONOTONIC 타이머 하나를 만들어 그 스레드로 신호가 가게 하며
+ * (SIGEV_THREAD_ID), 실행마다 timer_settime 한 번으로 재무장한다.
+ * 신호 처리기는 넘긴 시점의 단계와 스택을 잡고, CFS_WATCHDOG_DIR 이 있으면 그 자리에서
+ * 입력과 보고서를 기록한다 (끝나지 않는 입력과 fatal 모드의 abort 도 남는다).
+ *
+ * 환경 변수
+ *   CFS_WATCHDOG=0            워치독 끄기 (기본: 켬)
+ *   CFS_WATCHDOG_US=N         모든 명령의 기본 예산 (마이크로초)
+ *   CFS_WATCHDOG_BUDGET=...   명령별 예산, 예: "load=800,fill=200,sequence=5000"
+ *   CFS_WATCHDOG_DIR=DIR      초과 입력과 보고서를 저장할 디렉토리 (없으면 stderr 요약만)
+ *   CFS_WATCHDOG_FATAL=1      예산 초과 시 abort (퍼저가 입력을 크래시로 저장)
+ */
+
+#ifndef CFS_WATCHDOG_H
+#define CFS_WATCHDOG_H
+
+#include "cfe_mock.h"
+#include "cfs_config.h"
+#include "utils.h"
+
+// 명령별 기본 예산 (마이크로초)
+#ifndef CFS_WATCHDOG_DEFAULT_BUDGET_US
+#define CFS_WATCHDOG_DEFAULT_BUDGET_US      5000
+#endif
+
+#ifndef CFS_WATCHDOG_SEQUENCE_BUDGET_US
+#define CFS_WATCHDOG_SEQUENCE_BUDGET_US     20000
+#endif
+
+// 보고서에 남길 최대 스택 깊이
+#define CFS_WATCHDOG_MAX_FRAMES             32
+
+// 디렉토리에 저장할 최대 입력 수 (같은 입력은 한 번만)
+#define CFS_WATCHDOG_MAX_FINDINGS           256
+
+// 예산 설정 단위
+typedef enum {
+    CFS_WATCHDOG_CMD_LOAD = 0,
+    CFS_WATCHDOG_CMD_DUMP,
+    CFS_WATCHDOG_CMD_FILL,
+    CFS_WATCHDOG_CMD_SEQUENCE,
+    CFS_WATCHDOG_CMD_COUNT
+} CFS_WatchdogCmd_t;
+
+// 명령별 통계
+typedef struct {
+    uint64_t runs;
+    uint64_t timeouts;
+    uint64_t max_ns;
+    uint32_t budget_us;
+} CFS_WatchdogStats_t;
+
+// 환경 변수로 설정 (하니스 초기화 시 한 번)
+void CFS_Watchdog_ConfigureFromEnv(void);
+
+// 명령 예산 직접 지정 (0 이면 그 명령은 감시하지 않음)
+void CFS_Watchdog_SetBudget(CFS_WatchdogCmd_t cmd, uint32_t budget_us);
+
+// 실행 시작: 예산 타이머 무장, 입력은 End 까지 유효해야 한다
+void CFS_Watchdog_Begin(CFS_WatchdogCmd_t cmd, const uint8_t *data, size_t size);
+
+// 현재 단계 표시 (문자열은 정적 수명이어야 한다)
+void CFS_Watchdog_Stage(const char *stage);
+
+/*
+ * 실행 종료: 예산 초과면 기록하고 퍼징 통계 갱신
+ *
+ * @return: CFS_FUZZ_TIMEOUT (예산 초과), CFS_FUZZ_INVALID_INPUT (status 가 REJECTED),
+ *          CFS_FUZZ_SUCCESS 또는 CFS_FUZZ_ERROR
+ */
+CFS_FuzzResult_t CFS_Watchdog_End(int32_t status);
+
+const CFS_WatchdogStats_t* CFS_Watchdog_GetStats(void);
+void CFS_Watchdog_PrintStats(void);
+
+#endif // CFS_WATCHDOG_H
@@ -0,0 +1,495 @@
+/*
+ * MM DumpMemToFile 명령을 위한 퍼징 하니스
+ * CFS(Core Flight System) MM 모듈의 메모리 → 파일 덤프 명령어 처리 함수
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+
+// CFS 공통 헤더들
+#include "../../common/cfe_mock.h"
+#include "../../common/cfs_config.h"
+#include "../../common/mm_types.h"
+#include "../../common/utils.h"
+#include "../../common/sym_cache.h"
+#include "../../common/sim_mem.h"
+#include "../../common/mission.h"
+#include "../../common/vfs.h"
+#include "../../common/dump.h"
+#include "../../common/replay.h"
+#include "../../common/fuzz_loop.h"
+#include "../../common/input.h"
+#include "../../common/profile.h"
+#include "../../common/watchdog.h"
+#include "../../common/vclock.h"
+#include "../../common/mock_trace.h"
+#include "../../common/arena.h"
+#include "../../common/target_san.h"
+
+// 하니스 설정
+#define MM_DUMP_HARNESS_VERSION "1.0.0"
+
+// 안전한 메모리 조작 매크로들
+#define CFS_SAFE_STRNCPY(dst, src, size) do { \
+    if ((dst) && (src) && (size) > 0) { \
+        strncpy(dst, src, size - 1); \
+        ((char*)(dst))[(size) - 1] = '\0'; \
+    } \
+} while(0)
+
+// 퍼징 입력의 메모리 타입 선택 (바이트 % 5)
+static const uint8_t mm_dump_mem_types[] = { MM_RAM, MM_EEPROM, MM_MEM8, MM_MEM16, MM_MEM32 };
+
+#define MM_DUMP_NUM_MEM_TYPES (sizeof(mm_dump_mem_types) / sizeof(mm_dump_mem_types[0]))
+
+/*
+ * 디코드 표 (첫 디코드 때 현재 미션으로 한 번 만든다)
+ * 심볼 이름과 "<경로>dump.bin" 을 패킷 필드 크기 레코드로 미리 조립한다.
+ */
+#define MM_DUMP_FILE_SUFFIX "dump.bin"
+
+static CFS_NameTable_t g_symbol_names;
+static CFS_NameTable_t g_file_names;
+static pthread_once_t g_decode_once = PTHREAD_ONCE_INIT;
+static const CFS_Divisor_t mm_dump_ram_bytes = CFS_DIVISOR(MM_MAX_DUMP_FILE_DATA_RAM);
+static const CFS_Divisor_t mm_dump_eeprom_bytes = CFS_DIVISOR(MM_MAX_DUMP_FILE_DATA_EEPROM);
+
+static void MM_Dump_BuildDecodeTables(void) {
+    const CFS_Mission_t *mission = CFS_Mission_Get();
+
+    if (CFS_NameTable_Build(&g_symbol_names, mission->symbols, mission->symbol_count,
+                            "", OS_MAX_API_NAME) != CFE_SUCCESS ||
+        CFS_NameTable_Build(&g_file_names, mission->paths, mission->path_count,
+                            MM_DUMP_FILE_SUFFIX, OS_MAX_PATH_LEN) != CFE_SUCCESS) {
+        fprintf(stderr, "Cannot build mm_dump decode tables\n");
+        CFS_NameTable_Free(&g_symbol_names);
+        CFS_NameTable_Free(&g_file_names);
+    }
+}
+
+/*
+ * 호스트 파일 출력 (CFS_DUMP_DIR=<디렉토리>, 초기화 시 한 번 읽음)
+ * 설정하면 VFS 대신 <디렉토리>/<'/' 를 '_' 로 바꾼 파일 이름> 에 writev 로 쓴다.
+ * 통합 실행용이며 tmpfs(/dev/shm 등) 디렉토리를 권장한다.
+ */
+static const char *g_dump_dir = NULL;
+
+static uint32_t MM_Dump_MaxBytes(uint8_t MemType) {
+    return (MemType == MM_EEPROM) ? MM_MAX_DUMP_FILE_DATA_EEPROM : MM_MAX_DUMP_FILE_DATA_RAM;
+}
+
+static uint32_t MM_Dump_AccessWidth(uint8_t MemType) {
+    switch (MemType) {
+        case MM_MEM16:
+            return 2;
+        case MM_MEM32:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+/*
+ * MM_DumpMemToFileCmd 패킷 생성 함수
+ *
+ * 입력 배치 (고정 폭 필드, 값과 무관하게 항상 자리를 차지)
+ *   [0]      MemType 선택 (RAM, EEPROM, MEM8, MEM16, MEM32)
+ *   [1..4]   NumOfBytes (1 .. 메모리 타입별 최대값)
+ *   [5]      주소 방식 (짝수 = 심볼, 홀수 = 직접 주소)
+ *   [6]      심볼 선택
+ *   [7]      심볼 오프셋
+ *   [8..15]  직접 주소 오프셋 (타겟 기본 주소 + 하위 31비트)
+ *   [16]     파일 경로 선택 (허용 경로 + dump.bin)
+ *
+ * @param Data: 퍼징 입력 데이터
+ * @param Size: 입력 데이터 크기
+ * @return: 생성된 패킷 포인터 (호출자가 해제 책임), 필드 영역보다 짧으면 NULL
+ */
+void* MM_Dump_ConstructPacket(const uint8_t *Data, size_t Size) {
+    pthread_once(&g_decode_once, MM_Dump_BuildDecodeTables);
+    if (g_file_names.count == 0) {
+        return NULL;
+    }
+
+    CFS_Input_t in;
+    CFS_Input_Init(&in, Data, Size);
+
+    uint8_t mem_type = CFS_INPUT_PICK(&in, mm_dump_mem_types);
+    uint32_t num_bytes = CFS_Input_RangeDiv(&in, 1, (mem_type == MM_EEPROM) ?
+                                            &mm_dump_eeprom_bytes : &mm_dump_ram_bytes);
+    boolean use_symbol = !CFS_Input_Bool(&in);
+    const char *symbol = CFS_NameTable_Get(&g_symbol_names, CFS_Input_Select(&in, &g_symbol_names.select));
+    uint8_t symbol_offset = CFS_Input_U8(&in);
+    uint64_t direct = CFS_Input_U64(&in);
+    const char *file_name = CFS_NameTable_Get(&g_file_names, CFS_Input_Select(&in, &g_file_names.select));
+
+    if (!CFS_Input_Complete(&in)) {
+        return NULL;
+    }
+
+    MM_DumpMemToFileCmd_t *packet = calloc(1, sizeof(MM_DumpMemToFileCmd_t));
+    if (!packet) {
+        return NULL;
+    }
+
+    // 기본 헤더 설정
+    CFE_SB_MsgId_t msg_id = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_SetMsgId((CFE_MSG_Message_t*)&packet->CmdHeader, msg_id);
+    CFE_MSG_SetSize((CFE_MSG_Message_t*)&packet->CmdHeader, sizeof(MM_DumpMemToFileCmd_t));
+    CFE_MSG_SetSequenceCount((CFE_MSG_Message_t*)&packet->CmdHeader, 0);
+    CFE_MSG_SetSegmentationFlag((CFE_MSG_Message_t*)&packet->CmdHeader, 0x3);
+    CFE_MSG_SetFcnCode((CFE_MSG_Message_t*)&packet->CmdHeader, MM_DUMP_MEM_TO_FILE_CC);
+
+    packet->MemType = mem_type;
+    packet->NumOfBytes = num_bytes;
+    if (use_symbol) {
+        memcpy(packet->SrcSymAddress.SymName, symbol, OS_MAX_API_NAME);
+        packet->SrcSymAddress.Offset = symbol_offset;
+    } else {
+        // 메모리 주소를 타겟별 기본 주소 기반으로 제한
+        uint64_t base_addr = (mem_type == MM_EEPROM) ? CFS_DEFAULT_EEPROM_ADDR : CFS_DEFAULT_RAM_ADDR;
+        packet->SrcSymAddress.Offset = base_addr + (direct & 0x7FFFFFFF);
+    }
+    memcpy(packet->FileName, file_name, OS_MAX_PATH_LEN);
+
+    CFS_DEBUG_PRINT("Constructed packet: MemType=%d, NumOfBytes=%u, File=%s",
+                     packet->MemType, packet->NumOfBytes, packet->FileName);
+
+    return packet;
+}
+
+// 호스트 출력 경로 (<디렉토리>/<파일 이름의 '/' 를 '_' 로>)
+static int32_t MM_Dump_HostPath(const char *FileName, char *HostPath, size_t Size) {
+    int written = snprintf(HostPath, Size, "%s/%s", g_dump_dir, FileName[0] == '/' ? FileName + 1 : FileName);
+    if (written < 0 || (size_t)written >= Size) {
+        return CFS_MM_ERROR_INVALID_FILE;
+    }
+    for (char *p = HostPath + strlen(g_dump_dir) + 1; *p; p++) {
+        if (*p == '/') {
+            *p = '_';
+        }
+    }
+    return CFE_SUCCESS;
+}
+
+/*
+ * 명령 검증과 덤프 파일 생성 (HK/이벤트 처리는 호출자)
+ *
+ * @param ResolvedAddr: 해석된 소스 주소 (성공 시)
+ * @param FileCrc: 덤프 데이터 CRC (성공 시)
+ * @param ErrEventID: 실패 시 보낼 이벤트 ID
+ */
+static int32_t MM_Dump_SimulateDump(const MM_DumpMemToFileCmd_t *CmdPtr, uint64_t *ResolvedAddr,
+                                    uint32_t *FileCrc, CFE_EVS_EventID_t *ErrEventID) {
+    // 파일 이름 검증
+    CFS_STAGE(CFS_STAGE_PATH);
+    *ErrEventID = MM_FILENAME_ERR_EID;
+    char file_name[OS_MAX_PATH_LEN];
+    snprintf(file_name, sizeof(file_name), "%.*s", OS_MAX_PATH_LEN - 1, CmdPtr->FileName);
+    if (MM_VerifyFileName(file_name) != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Invalid dump filename: %s", file_name);
+        return CFS_MM_ERROR_INVALID_FILE;
+    }
+
+    // 심볼 주소 해석 (심볼 캐시 경유)
+    CFS_STAGE(CFS_STAGE_RESOLVE);
+    *ErrEventID = MM_SYMNAME_ERR_EID;
+    MM_SymAddr_t src = CmdPtr->SrcSymAddress;
+    uint64_t resolved_addr = 0;
+    if (MM_ResolveSymAddr(&src, &resolved_addr) != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Symbol lookup failed: %.*s", OS_MAX_API_NAME, src.SymName);
+        return CFS_MM_ERROR_INVALID_ADDR;
+    }
+
+    // 메모리 타입 검증
+    CFS_STAGE(CFS_STAGE_VALIDATE);
+    *ErrEventID = MM_DUMP_TO_FILE_ERR_EID;
+    if (MM_VerifyMemType(CmdPtr->MemType) != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Invalid memory type: %d", CmdPtr->MemType);
+        return CFS_MM_ERROR_INVALID_MEMTYPE;
+    }
+
+    // 데이터 크기 검증
+    if (CmdPtr->NumOfBytes == 0 || CmdPtr->NumOfBytes > MM_Dump_MaxBytes(CmdPtr->MemType)) {
+        CFS_ERROR_PRINT("Invalid dump size: %u", CmdPtr->NumOfBytes);
+        return CFS_MM_ERROR_INVALID_SIZE;
+    }
+
+    // 메모리 영역 검증 (읽기 전용 영역도 덤프 가능)
+    CFS_STAGE(CFS_STAGE_REGION);
+    uint8_t region_type = (CmdPtr->MemType == MM_EEPROM) ? MM_EEPROM : MM_RAM;
+    int32_t status = CFS_ValidateMemoryRegion(resolved_addr, CmdPtr->NumOfBytes, region_type, FALSE);
+    if (status != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Invalid memory region: addr=0x%08lX, size=%u",
+                        resolved_addr, CmdPtr->NumOfBytes);
+        return status;
+    }
+
+    // 폭 제한 메모리는 주소와 크기가 접근 폭의 배수여야 한다
+    CFS_STAGE(CFS_STAGE_ALIGN);
+    uint32_t width = MM_Dump_AccessWidth(CmdPtr->MemType);
+    if ((resolved_addr % width) != 0 || (CmdPtr->NumOfBytes % width) != 0) {
+        CFS_ERROR_PRINT("Dump not aligned to %u-byte access: 0x%08lX, %u bytes",
+                        width, resolved_addr, CmdPtr->NumOfBytes);
+        return CFS_MM_ERROR_ALIGNMENT;
+    }
+
+    // 헤더 + 시뮬레이션 메모리 참조로 파일 구성 후 내보내기
+    CFS_STAGE(CFS_STAGE_TRANSFER);
+    CFS_DumpFile_t dump;
+    status = CFS_Dump_Prepare(&dump, &CmdPtr->SrcSymAddress, resolved_addr,
+                              CmdPtr->MemType, CmdPtr->NumOfBytes);
+    if (status != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Memory read failed: 0x%08lX", resolved_addr);
+        return CFS_MM_ERROR_MEMORY_ACCESS;
+    }
+
+    *ErrEventID = MM_FILE_ACCESS_ERR_EID;
+    if (g_dump_dir) {
+        char host_path[512];
+        status = MM_Dump_HostPath(file_name, host_path, sizeof(host_path));
+        if (status == CFE_SUCCESS) {
+            status = CFS_Dump_WriteHost(&dump, host_path);
+        }
+    } else {
+        status = CFS_Dump_WriteVfs(&dump, file_name);
+    }
+    if (status != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Dump file write failed: %s", file_name);
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
+    CFS_VClock_FileAccess(dump.FileSize);
+
+    *ResolvedAddr = resolved_addr;
+    *FileCrc = dump.MmHeader.Crc;
+    return CFE_SUCCESS;
+}
+
+/*
+ * MM_DumpMemToFileCmd 함수 시뮬레이션
+ * 실제 CFS 환경에서는 mm_dump.c 의 MM_DumpMemToFileCmd 함수를 호출
+ */
+int32_t MM_DumpMemToFileCmd_Simulation(MM_DumpMemToFileCmd_t *CmdPtr) {
+    if (!CmdPtr) {
+        CFS_ERROR_PRINT("Null command pointer");
+        return OS_INVALID_POINTER;
+    }
+
+    uint64_t resolved_addr = 0;
+    uint32_t crc = 0;
+    CFE_EVS_EventID_t err_event = MM_DUMP_TO_FILE_ERR_EID;
+    int32_t status = MM_Dump_SimulateDump(CmdPtr, &resolved_addr, &crc, &err_event);
+    if (status != CFE_SUCCESS) {
+        MM_AppData.ErrCounter++;
+        CFE_EVS_SendEvent(err_event, CFE_EVS_EventType_ERROR,
+                          "MM Dump simulation failed: File=%.*s, Status=%d",
+                          OS_MAX_PATH_LEN, CmdPtr->FileName, (int)status);
+        return status;
+    }
+
+    CFS_INFO_PRINT("MM Dump simulation successful: %u bytes from 0x%08lX to %s (CRC 0x%08X)",
+                   CmdPtr->NumOfBytes, resolved_addr, CmdPtr->FileName, crc);
+
+    // HK 갱신
+    MM_AppData.CmdCounter++;
+    MM_AppData.LastAction = MM_DUMP_TO_FILE;
+    MM_AppData.MemType = CmdPtr->MemType;
+    MM_AppData.Address = (uint32)resolved_addr;
+    MM_AppData.DataValue = crc;
+    MM_AppData.BytesProcessed = CmdPtr->NumOfBytes;
+    CFS_SAFE_STRNCPY(MM_AppData.FileName, CmdPtr->FileName, OS_MAX_PATH_LEN);
+
+    CFE_EVS_SendEvent(MM_DUMP_TO_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Dump Memory To File Command: Dumped %u bytes from address 0x%08lX to file %s",
+                      CmdPtr->NumOfBytes, (unsigned long)resolved_addr, MM_AppData.FileName);
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * 입력 하나 실행 (LibFuzzer 엔트리와 배치 재생에서 공용)
+ *
+ * @return: 시뮬레이션 상태 코드, 패킷 생성 불가 시 CFS_REPLAY_STATUS_REJECTED
+ */
+int32_t MM_Dump_ExecuteInput(const uint8_t *data, size_t size) {
+    CFS_Watchdog_Begin(CFS_WATCHDOG_CMD_DUMP, data, size);
+    CFS_PROFILE_BEGIN(data, size);
+    CFS_VClock_BeginInput();
+    CFS_TargetSan_BeginInput();
+    CFS_MockTrace_BeginInput(data, size);
+    // 매 입력 깨끗한 HK 상태, VFS, 시뮬레이션 메모리에서 시작 (결과 재현성)
+    MM_ResetAppData();
+    CFS_Vfs_Clear();
+    CFS_SimMem_Reset();
+    CFS_STAGE(CFS_STAGE_DECODE);
+    MM_DumpMemToFileCmd_t *packet = (MM_DumpMemToFileCmd_t*)MM_Dump_ConstructPacket(data, size);
+    int32_t status = CFS_REPLAY_STATUS_REJECTED;
+    if (packet) {
+        status = MM_DumpMemToFileCmd_Simulation(packet);
+        free(packet);
+    }
+
+    if (CFS_TargetSan_EndInput()) {
+        status = CFS_REPLAY_STATUS_TARGET_SAN;
+    }
+    (void)CFS_VClock_EndInput();
+    CFS_MockTrace_EndInput();
+    CFS_PROFILE_END();
+    (void)CFS_Watchdog_End(status);
+    return status;
+}
+
+// 환경 변수로 미션, 시뮬레이션 메모리 아레나, 호스트 출력 디렉토리, 워치독, 가상 시계, 타겟 메모리 검사와 Mock 호출 기록 설정
+// (fuzzing 이면 위반 시 abort, 호출 기록 기본 켜짐)
+static int32_t MM_Dump_Configure(boolean fuzzing) {
+    CFS_Mission_ConfigureFromEnv();
+    CFS_Arena_ConfigureFromEnv();
+    const char *env = getenv("CFS_DUMP_DIR");
+    g_dump_dir = (env && env[0] != '\0') ? env : NULL;
+    CFS_Watchdog_ConfigureFromEnv();
+    CFS_VClock_ConfigureFromEnv();
+    CFS_TargetSan_ConfigureFromEnv(fuzzing);
+    CFS_PROFILE_CONFIGURE();
+    return CFS_MockTrace_ConfigureFromEnv(fuzzing);
+}
+
+/*
+ * LibFuzzer 엔트리 포인트
+ */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    (void)MM_Dump_ExecuteInput(data, size);
+    return 0;
+}
+
+/*
+ * 초기화 함수 (LibFuzzer에서 호출)
+ */
+int LLVMFuzzerInitialize(int *argc, char ***argv) {
+    (void)argc;
+    (void)argv;
+
+    printf("CFS MM Dump Harness %s initialized\n", MM_DUMP_HARNESS_VERSION);
+    printf("Target: MM_DumpMemToFileCmd\n");
+    printf("Packet size: %zu bytes\n", sizeof(MM_DumpMemToFileCmd_t));
+
+    (void)MM_Dump_Configure(TRUE);
+    printf("Dump output: %s\n", g_dump_dir ? g_dump_dir : "in-memory VFS");
+
+    #ifdef CFS_DEBUG_MODE
+        printf("Debug mode enabled\n");
+    #endif
+
+    return 0;
+}
+
+/*
+ * 테스트용 메인 함수 (퍼저 없이 단독 테스트시 사용)
+ */
+#ifdef STANDALONE_TEST
+int main(int argc, char **argv) {
+    if (MM_Dump_Configure(FALSE) != CFE_SUCCESS) {
+        return 1;
+    }
+
+    // -fuzz 이면 프로세스 내 다중 워커 퍼징
+    if (argc > 1 && CFS_FuzzLoop_Requested(argc, argv)) {
+        CFS_TargetSan_ConfigureFromEnv(TRUE);
+        (void)CFS_MockTrace_ConfigureFromEnv(TRUE);
+        int rc = CFS_FuzzLoop_Main(argc, argv, MM_Dump_ExecuteInput);
+        CFS_TargetSan_PrintStats();
+        CFS_Arena_PrintStats();
+        CFS_Watchdog_PrintStats();
+        CFS_VClock_PrintStats();
+        return rc;
+    }
+
+    // 파일/디렉토리/코퍼스 팩이 주어지면 프로세스 내 배치 재생
+    if (argc > 1) {
+        int rc = CFS_Replay_Main(argc, argv, MM_Dump_ExecuteInput);
+        CFS_TargetSan_PrintStats();
+        CFS_Arena_PrintStats();
+        CFS_Watchdog_PrintStats();
+        CFS_VClock_PrintStats();
+        CFS_PROFILE_PRINT();
+        return rc;
+    }
+
+    printf("=== CFS MM Dump Harness Test ===\n");
+    printf("Version: %s\n", MM_DUMP_HARNESS_VERSION);
+
+    // 알려진 내용을 쓴 뒤 덤프하고 VFS 파일의 헤더/데이터/CRC 확인
+    uint8_t pattern[1000];
+    for (size_t i = 0; i < sizeof(pattern); i++) {
+        pattern[i] = (uint8_t)(i * 7 + 1);
+    }
+
+    uint8_t test_data[17] = {
+        0x00,                    // MemType choice (RAM)
+        0xE7, 0x03, 0x00, 0x00,  // NumOfBytes (1000)
+        0x00,                    // Address mode (even = use symbol)
+        0x05,                    // Symbol index
+        0x03,                    // Symbol offset
+        0, 0, 0, 0, 0, 0, 0, 0,  // Direct offset (unused)
+        0x01                     // Path choice
+    };
+
+    MM_DumpMemToFileCmd_t *packet = (MM_DumpMemToFileCmd_t*)MM_Dump_ConstructPacket(test_data, sizeof(test_data));
+    if (!packet) {
+        printf("Failed to create packet\n");
+        return 1;
+    }
+
+    uint64_t addr = 0;
+    MM_SymAddr_t src = packet->SrcSymAddress;
+    if (MM_ResolveSymAddr(&src, &addr) != CFE_SUCCESS ||
+        CFS_SimMem_Write(addr, pattern, sizeof(pattern)) != CFE_SUCCESS) {
+        printf("Failed to prepare source memory\n");
+        free(packet);
+        return 1;
+    }
+
+    printf("Test packet created:\n");
+    printf("  MemType: %u\n", packet->MemType);
+    printf("  NumOfBytes: %u\n", packet->NumOfBytes);
+    printf("  Source: %s+%lu (0x%08lX)\n", packet->SrcSymAddress.SymName,
+           (unsigned long)packet->SrcSymAddress.Offset, (unsigned long)addr);
+    printf("  FileName: %s\n", packet->FileName);
+
+    int32_t result = MM_DumpMemToFileCmd_Simulation(packet);
+    printf("Simulation result: %d\n", result);
+
+    const uint8_t *file = NULL;
+    uint32_t file_size = 0;
+    boolean match = (result == CFE_SUCCESS) && g_dump_dir == NULL &&
+                    CFS_Vfs_ReadFile(packet->FileName, &file, &file_size) == CFE_SUCCESS &&
+                    file_size == sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) + sizeof(pattern);
+    if (match) {
+        const uint8_t content_id[4] = { 'c', 'F', 'E', '1' };
+        MM_LoadDumpFileHeader_t header;
+        memcpy(&header, file + sizeof(CFE_FS_Header_t), sizeof(header));
+        uint32_t crc = MM_CalculateCRC32(pattern, sizeof(pattern), 0xFFFFFFFF) ^ 0xFFFFFFFF;
+        match = memcmp(file, content_id, sizeof(content_id)) == 0 &&
+                header.NumOfBytes == sizeof(pattern) && header.Crc == crc &&
+                memcmp(file + sizeof(CFE_FS_Header_t) + sizeof(header), pattern, sizeof(pattern)) == 0;
+        printf("  File: %u bytes, CRC 0x%08X\n", file_size, header.Crc);
+    }
+
+    printf("HK: CmdCounter=%u, ErrCounter=%u\n", MM_AppData.CmdCounter, MM_AppData.ErrCounter);
+    CFS_SymCache_PrintStats();
+    free(packet);
+    if (g_dump_dir) {
+        printf("Test completed (host output, file contents not checked)\n");
+        return result == CFE_SUCCESS ? 0 : 1;
+    }
+    if (!match) {
+        printf("Test failed: dump file mismatch\n");
+        return 1;
+    }
+    printf("Test completed successfully!\n");
+
+    return 0;
+}
+#endif
@@ -0,0 +1,430 @@
+/*
+ * MM FillMem 명령을 위한 퍼징 하니스
+ * CFS(Core Flight System) MM 모듈의 메모리 채우기 명령어 처리 함수
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+
+// CFS 공통 헤더들
+#include "../../common/cfe_mock.h"
+#include "../../common/cfs_config.h"
+#include "../../common/mm_types.h"
+#include "../../common/utils.h"
+#include "../../common/sym_cache.h"
+#include "../../common/sim_mem.h"
+#include "../../common/eeprom.h"
+#include "../../common/vfs.h"
+#include "../../common/mission.h"
+#include "../../common/fill.h"
+#include "../../common/replay.h"
+#include "../../common/fuzz_loop.h"
+#include "../../common/input.h"
+#include "../../common/profile.h"
+#include "../../common/watchdog.h"
+#include "../../common/vclock.h"
+#include "../../common/mock_trace.h"
+#include "../../common/arena.h"
+#include "../../common/target_san.h"
+
+// 하니스 설정
+#define MM_FILL_HARNESS_VERSION "1.0.0"
+
+// 안전한 메모리 조작 매크로들
+#define CFS_SAFE_STRNCPY(dst, src, size) do { \
+    if ((dst) && (src) && (size) > 0) { \
+        strncpy(dst, src, size - 1); \
+        ((char*)(dst))[(size) - 1] = '\0'; \
+    } \
+} while(0)
+
+// 퍼징 입력의 메모리 타입 선택 (바이트 % 5)
+static const uint8_t mm_fill_mem_types[] = { MM_RAM, MM_EEPROM, MM_MEM8, MM_MEM16, MM_MEM32 };
+
+#define MM_FILL_NUM_MEM_TYPES (sizeof(mm_fill_mem_types) / sizeof(mm_fill_mem_types[0]))
+
+// 디코드 표: 심볼 이름 레코드 (첫 디코드 때 현재 미션으로 만든다), NumOfBytes 범위 제수
+static CFS_NameTable_t g_symbol_names;
+static pthread_once_t g_decode_once = PTHREAD_ONCE_INIT;
+static const CFS_Divisor_t mm_fill_ram_bytes = CFS_DIVISOR(MM_MAX_FILL_DATA_RAM);
+static const CFS_Divisor_t mm_fill_eeprom_bytes = CFS_DIVISOR(MM_MAX_FILL_DATA_EEPROM);
+
+static void MM_Fill_BuildDecodeTables(void) {
+    const CFS_Mission_t *mission = CFS_Mission_Get();
+
+    if (CFS_NameTable_Build(&g_symbol_names, mission->symbols, mission->symbol_count,
+                            "", OS_MAX_API_NAME) != CFE_SUCCESS) {
+        fprintf(stderr, "Cannot build mm_fill decode tables\n");
+    }
+}
+
+/*
+ * 메모리 타입별 채우기 한도와 접근 폭 (바이트)
+ * MEM8/16/32 는 RAM 영역에 있는 폭 제한 메모리로 취급한다.
+ */
+static uint32_t MM_Fill_MaxBytes(uint8_t MemType) {
+    return (MemType == MM_EEPROM) ? MM_MAX_FILL_DATA_EEPROM : MM_MAX_FILL_DATA_RAM;
+}
+
+static uint32_t MM_Fill_AccessWidth(uint8_t MemType) {
+    switch (MemType) {
+        case MM_MEM16:
+            return 2;
+        case MM_MEM32:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+/*
+ * MM_FillMemCmd 패킷 생성 함수
+ *
+ * 입력 배치 (고정 폭 필드, 값과 무관하게 항상 자리를 차지)
+ *   [0]      MemType 선택 (RAM, EEPROM, MEM8, MEM16, MEM32)
+ *   [1..4]   NumOfBytes (1 .. 메모리 타입별 최대값)
+ *   [5..8]   FillPattern
+ *   [9]      주소 방식 (짝수 = 심볼, 홀수 = 직접 주소)
+ *   [10]     심볼 선택
+ *   [11]     심볼 오프셋 (정렬되지 않은 시작점 포함)
+ *   [12..19] 직접 주소 오프셋 (타겟 기본 주소 + 하위 31비트)
+ *
+ * @param Data: 퍼징 입력 데이터
+ * @param Size: 입력 데이터 크기
+ * @return: 생성된 패킷 포인터 (호출자가 해제 책임), 필드 영역보다 짧으면 NULL
+ */
+void* MM_Fill_ConstructPacket(const uint8_t *Data, size_t Size) {
+    pthread_once(&g_decode_once, MM_Fill_BuildDecodeTables);
+    if (g_symbol_names.count == 0) {
+        return NULL;
+    }
+
+    CFS_Input_t in;
+    CFS_Input_Init(&in, Data, Size);
+
+    uint8_t mem_type = CFS_INPUT_PICK(&in, mm_fill_mem_types);
+    uint32_t num_bytes = CFS_Input_RangeDiv(&in, 1, (mem_type == MM_EEPROM) ?
+                                            &mm_fill_eeprom_bytes : &mm_fill_ram_bytes);
+    uint32_t pattern = CFS_Input_U32(&in);
+    boolean use_symbol = !CFS_Input_Bool(&in);
+    const char *symbol = CFS_NameTable_Get(&g_symbol_names, CFS_Input_Select(&in, &g_symbol_names.select));
+    uint8_t symbol_offset = CFS_Input_U8(&in);
+    uint64_t direct = CFS_Input_U64(&in);
+
+    if (!CFS_Input_Complete(&in)) {
+        return NULL;
+    }
+
+    MM_FillMemCmd_t *packet = calloc(1, sizeof(MM_FillMemCmd_t));
+    if (!packet) {
+        return NULL;
+    }
+
+    // 기본 헤더 설정
+    CFE_SB_MsgId_t msg_id = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_SetMsgId((CFE_MSG_Message_t*)&packet->CmdHeader, msg_id);
+    CFE_MSG_SetSize((CFE_MSG_Message_t*)&packet->CmdHeader, sizeof(MM_FillMemCmd_t));
+    CFE_MSG_SetSequenceCount((CFE_MSG_Message_t*)&packet->CmdHeader, 0);
+    CFE_MSG_SetSegmentationFlag((CFE_MSG_Message_t*)&packet->CmdHeader, 0x3);
+    CFE_MSG_SetFcnCode((CFE_MSG_Message_t*)&packet->CmdHeader, MM_FILL_MEM_CC);
+
+    packet->MemType = mem_type;
+    packet->NumOfBytes = num_bytes;
+    packet->FillPattern = pattern;
+    if (use_symbol) {
+        memcpy(packet->DestSymAddress.SymName, symbol, OS_MAX_API_NAME);
+        packet->DestSymAddress.Offset = symbol_offset;
+    } else {
+        // 메모리 주소를 타겟별 기본 주소 기반으로 제한
+        uint64_t base_addr = (mem_type == MM_EEPROM) ? CFS_DEFAULT_EEPROM_ADDR : CFS_DEFAULT_RAM_ADDR;
+        packet->DestSymAddress.Offset = base_addr + (direct & 0x7FFFFFFF);
+    }
+
+    CFS_DEBUG_PRINT("Constructed packet: MemType=%d, NumOfBytes=%u, Pattern=0x%08X",
+                     packet->MemType, packet->NumOfBytes, packet->FillPattern);
+
+    return packet;
+}
+
+/*
+ * 명령 검증과 채우기 (HK/이벤트 처리는 호출자)
+ *
+ * @param ResolvedAddr: 해석된 목적지 주소 (성공 시)
+ * @param ErrEventID: 실패 시 보낼 이벤트 ID
+ */
+static int32_t MM_Fill_SimulateFill(const MM_FillMemCmd_t *CmdPtr, uint64_t *ResolvedAddr,
+                                    CFE_EVS_EventID_t *ErrEventID) {
+    // 심볼 주소 해석 (심볼 캐시 경유)
+    CFS_STAGE(CFS_STAGE_RESOLVE);
+    *ErrEventID = MM_SYMNAME_ERR_EID;
+    MM_SymAddr_t dest = CmdPtr->DestSymAddress;
+    uint64_t resolved_addr = 0;
+    if (MM_ResolveSymAddr(&dest, &resolved_addr) != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Symbol lookup failed: %.*s", OS_MAX_API_NAME, dest.SymName);
+        return CFS_MM_ERROR_INVALID_ADDR;
+    }
+
+    // 메모리 타입 검증
+    CFS_STAGE(CFS_STAGE_VALIDATE);
+    *ErrEventID = MM_FILL_ERR_EID;
+    if (MM_VerifyMemType(CmdPtr->MemType) != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Invalid memory type: %d", CmdPtr->MemType);
+        return CFS_MM_ERROR_INVALID_MEMTYPE;
+    }
+
+    // 데이터 크기 검증
+    if (CmdPtr->NumOfBytes == 0 || CmdPtr->NumOfBytes > MM_Fill_MaxBytes(CmdPtr->MemType)) {
+        CFS_ERROR_PRINT("Invalid fill size: %u", CmdPtr->NumOfBytes);
+        return CFS_MM_ERROR_INVALID_SIZE;
+    }
+
+    // 메모리 영역/쓰기 권한 검증
+    CFS_STAGE(CFS_STAGE_REGION);
+    uint8_t region_type = (CmdPtr->MemType == MM_EEPROM) ? MM_EEPROM : MM_RAM;
+    int32_t status = CFS_ValidateMemoryRegion(resolved_addr, CmdPtr->NumOfBytes, region_type, TRUE);
+    if (status != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Invalid memory region: addr=0x%08lX, size=%u",
+                        resolved_addr, CmdPtr->NumOfBytes);
+        return status;
+    }
+
+    // 폭 제한 메모리는 주소와 크기가 접근 폭의 배수여야 한다
+    CFS_STAGE(CFS_STAGE_ALIGN);
+    uint32_t width = MM_Fill_AccessWidth(CmdPtr->MemType);
+    if ((resolved_addr % width) != 0 || (CmdPtr->NumOfBytes % width) != 0) {
+        CFS_ERROR_PRINT("Fill not aligned to %u-byte access: 0x%08lX, %u bytes",
+                        width, resolved_addr, CmdPtr->NumOfBytes);
+        return CFS_MM_ERROR_ALIGNMENT;
+    }
+
+    // 중단 불가 구간 단위로 시뮬레이션 메모리에 채우기
+    CFS_STAGE(CFS_STAGE_TRANSFER);
+    uint32_t pattern = CFS_Fill_ExpandPattern(CmdPtr->FillPattern, CmdPtr->MemType);
+    if (CFS_SimMem_Fill(resolved_addr, CmdPtr->NumOfBytes, pattern,
+                        MM_MAX_UNINTERRUPTIBLE_DATA) != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Memory fill failed: 0x%08lX", resolved_addr);
+        return CFS_MM_ERROR_MEMORY_ACCESS;
+    }
+
+    *ResolvedAddr = resolved_addr;
+    return CFE_SUCCESS;
+}
+
+/*
+ * MM_FillMemCmd 함수 시뮬레이션
+ * 실제 CFS 환경에서는 mm_mem.c 의 MM_FillMemCmd 함수를 호출
+ */
+int32_t MM_FillMemCmd_Simulation(MM_FillMemCmd_t *CmdPtr) {
+    if (!CmdPtr) {
+        CFS_ERROR_PRINT("Null command pointer");
+        return OS_INVALID_POINTER;
+    }
+
+    uint64_t resolved_addr = 0;
+    CFE_EVS_EventID_t err_event = MM_FILL_ERR_EID;
+    int32_t status = MM_Fill_SimulateFill(CmdPtr, &resolved_addr, &err_event);
+    if (status != CFE_SUCCESS) {
+        MM_AppData.ErrCounter++;
+        CFE_EVS_SendEvent(err_event, CFE_EVS_EventType_ERROR,
+                          "MM Fill simulation failed: MemType=%u, Status=%d",
+                          CmdPtr->MemType, (int)status);
+        return status;
+    }
+
+    CFS_INFO_PRINT("MM Fill simulation successful: %u bytes of 0x%08X at 0x%08lX",
+                   CmdPtr->NumOfBytes, CmdPtr->FillPattern, resolved_addr);
+
+    // HK 갱신
+    MM_AppData.CmdCounter++;
+    MM_AppData.LastAction = MM_FILL;
+    MM_AppData.MemType = CmdPtr->MemType;
+    MM_AppData.Address = (uint32)resolved_addr;
+    MM_AppData.DataValue = CmdPtr->FillPattern;
+    MM_AppData.BytesProcessed = CmdPtr->NumOfBytes;
+    MM_AppData.FileName[0] = '\0';
+
+    CFE_EVS_SendEvent(MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Fill Memory Command: Filled %u bytes at address 0x%08lX with pattern 0x%08X",
+                      CmdPtr->NumOfBytes, (unsigned long)resolved_addr, CmdPtr->FillPattern);
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * 입력 하나 실행 (LibFuzzer 엔트리와 배치 재생에서 공용)
+ *
+ * @return: 시뮬레이션 상태 코드, 패킷 생성 불가 시 CFS_REPLAY_STATUS_REJECTED,
+ *          EEPROM 페이지 마모 한도 초과 시 CFS_REPLAY_STATUS_WEAR
+ */
+int32_t MM_Fill_ExecuteInput(const uint8_t *data, size_t size) {
+    CFS_Watchdog_Begin(CFS_WATCHDOG_CMD_FILL, data, size);
+    CFS_PROFILE_BEGIN(data, size);
+    CFS_Eeprom_BeginInput();
+    CFS_TargetSan_BeginInput();
+    CFS_VClock_BeginInput();
+    CFS_MockTrace_BeginInput(data, size);
+    // 매 입력 깨끗한 HK 상태, VFS, 시뮬레이션 메모리에서 시작 (결과 재현성)
+    MM_ResetAppData();
+    CFS_Vfs_Clear();
+    CFS_SimMem_Reset();
+    CFS_STAGE(CFS_STAGE_DECODE);
+    MM_FillMemCmd_t *packet = (MM_FillMemCmd_t*)MM_Fill_ConstructPacket(data, size);
+    int32_t status = CFS_REPLAY_STATUS_REJECTED;
+    if (packet) {
+        status = MM_FillMemCmd_Simulation(packet);
+        free(packet);
+    }
+    if (CFS_Eeprom_EndInput()) {
+        status = CFS_REPLAY_STATUS_WEAR;
+    }
+    if (CFS_TargetSan_EndInput()) {
+        status = CFS_REPLAY_STATUS_TARGET_SAN;
+    }
+    (void)CFS_VClock_EndInput();
+    CFS_MockTrace_EndInput();
+
+    CFS_PROFILE_END();
+    (void)CFS_Watchdog_End(status);
+    return status;
+}
+
+/*
+ * LibFuzzer 엔트리 포인트
+ */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    (void)MM_Fill_ExecuteInput(data, size);
+    return 0;
+}
+
+/*
+ * 초기화 함수 (LibFuzzer에서 호출)
+ */
+int LLVMFuzzerInitialize(int *argc, char ***argv) {
+    (void)argc;
+    (void)argv;
+
+    printf("CFS MM Fill Harness %s initialized\n", MM_FILL_HARNESS_VERSION);
+    printf("Target: MM_FillMemCmd\n");
+    printf("Packet size: %zu bytes\n", sizeof(MM_FillMemCmd_t));
+
+    CFS_Mission_ConfigureFromEnv();
+    CFS_Arena_ConfigureFromEnv();
+    CFS_Eeprom_ConfigureFromEnv(TRUE);
+    // 타겟 메모리 위반도 크래시로 남긴다
+    CFS_TargetSan_ConfigureFromEnv(TRUE);
+    CFS_Watchdog_ConfigureFromEnv();
+    CFS_VClock_ConfigureFromEnv();
+    (void)CFS_MockTrace_ConfigureFromEnv(TRUE);
+    CFS_PROFILE_CONFIGURE();
+
+    #ifdef CFS_DEBUG_MODE
+        printf("Debug mode enabled\n");
+    #endif
+
+    return 0;
+}
+
+/*
+ * 테스트용 메인 함수 (퍼저 없이 단독 테스트시 사용)
+ */
+#ifdef STANDALONE_TEST
+int main(int argc, char **argv) {
+    CFS_Mission_ConfigureFromEnv();
+    CFS_Arena_ConfigureFromEnv();
+    CFS_Eeprom_ConfigureFromEnv(FALSE);
+    CFS_TargetSan_ConfigureFromEnv(FALSE);
+    CFS_Watchdog_ConfigureFromEnv();
+    CFS_VClock_ConfigureFromEnv();
+    if (CFS_MockTrace_ConfigureFromEnv(FALSE) != CFE_SUCCESS) {
+        return 1;
+    }
+    CFS_PROFILE_CONFIGURE();
+
+    // -fuzz 이면 프로세스 내 다중 워커 퍼징
+    if (argc > 1 && CFS_FuzzLoop_Requested(argc, argv)) {
+        // 퍼징 중 마모 발견은 크래시 입력으로 남긴다
+        CFS_Eeprom_ConfigureFromEnv(TRUE);
+        CFS_TargetSan_ConfigureFromEnv(TRUE);
+        (void)CFS_MockTrace_ConfigureFromEnv(TRUE);
+        int rc = CFS_FuzzLoop_Main(argc, argv, MM_Fill_ExecuteInput);
+        CFS_Eeprom_PrintStats();
+        CFS_TargetSan_PrintStats();
+        CFS_Arena_PrintStats();
+        CFS_VClock_PrintStats();
+        CFS_Watchdog_PrintStats();
+        return rc;
+    }
+
+    // 파일/디렉토리/코퍼스 팩이 주어지면 프로세스 내 배치 재생
+    if (argc > 1) {
+        int rc = CFS_Replay_Main(argc, argv, MM_Fill_ExecuteInput);
+        CFS_Eeprom_PrintStats();
+        CFS_TargetSan_PrintStats();
+        CFS_Arena_PrintStats();
+        CFS_VClock_PrintStats();
+        CFS_Watchdog_PrintStats();
+        CFS_PROFILE_PRINT();
+        return rc;
+    }
+
+    printf("=== CFS MM Fill Harness Test ===\n");
+    printf("Version: %s\n", MM_FILL_HARNESS_VERSION);
+
+    // 메모리 타입별로 정렬되지 않은 시작점에서 채우고 결과 확인
+    int failures = 0;
+    for (size_t t = 0; t < MM_FILL_NUM_MEM_TYPES; t++) {
+        uint8_t test_data[sizeof(MM_FillMemCmd_t)] = {
+            (uint8_t)t,              // MemType choice
+            0xE7, 0x03, 0x00, 0x00,  // NumOfBytes (1000)
+            0x11, 0x22, 0x33, 0x44,  // FillPattern
+            0x00,                    // Symbol choice (even = use symbol)
+            0x05,                    // Symbol index
+            0x03                     // Symbol offset (misaligned head)
+        };
+
+        MM_FillMemCmd_t *packet = (MM_FillMemCmd_t*)MM_Fill_ConstructPacket(test_data, sizeof(test_data));
+        if (!packet) {
+            printf("Failed to create packet\n");
+            return 1;
+        }
+
+        // EEPROM 은 직접 주소, 폭 제한 타입은 정렬된 주소로 맞춘다
+        if (packet->MemType == MM_EEPROM) {
+            packet->DestSymAddress.SymName[0] = '\0';
+            packet->DestSymAddress.Offset = CFS_DEFAULT_EEPROM_ADDR + 3;
+        }
+        uint32_t width = MM_Fill_AccessWidth(packet->MemType);
+        packet->DestSymAddress.Offset -= packet->DestSymAddress.Offset % width;
+
+        int32_t result = MM_FillMemCmd_Simulation(packet);
+
+        uint64_t addr = 0;
+        MM_SymAddr_t dest = packet->DestSymAddress;
+        uint8_t readback[1000];
+        uint32_t pattern = CFS_Fill_ExpandPattern(packet->FillPattern, packet->MemType);
+        boolean match = (result == CFE_SUCCESS) &&
+                        MM_ResolveSymAddr(&dest, &addr) == CFE_SUCCESS &&
+                        CFS_SimMem_Read(addr, readback, sizeof(readback)) == CFE_SUCCESS;
+        for (uint32_t i = 0; match && i < sizeof(readback); i++) {
+            match = (readback[i] == ((const uint8_t *)&pattern)[i & 3]);
+        }
+
+        printf("  MemType %2u: %s\n", packet->MemType, match ? "PASS" : "FAIL");
+        failures += match ? 0 : 1;
+        free(packet);
+    }
+
+    printf("HK: CmdCounter=%u, ErrCounter=%u\n", MM_AppData.CmdCounter, MM_AppData.ErrCounter);
+    CFS_SymCache_PrintStats();
+    if (failures > 0) {
+        printf("Test failed: %d memory types\n", failures);
+        return 1;
+    }
+    printf("Test completed successfully!\n");
+
+    return 0;
+}
+#endif
@@ -7,15 +7,129 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <pthread.h>
 
 // CFS 공통 헤더들
 #include "../../common/cfe_mock.h"
 #include "../../common/cfs_config.h"
 #include "../../common/mm_types.h"
+#include "../../common/sym_cache.h"
+#include "../../common/sim_mem.h"
+#include "../../common/mission.h"
+#include "../../common/differential.h"
+#include "../../common/replay.h"
+#include "../../common/fuzz_loop.h"
+#include "../../common/vfs.h"
+#include "../../common/snapshot.h"
+#include "../../common/eeprom.h"
+#include "../../common/input.h"
+#include "../../common/profile.h"
+#include "../../common/watchdog.h"
+#include "../../common/vclock.h"
+#include "../../common/mock_trace.h"
+#include "../../common/arena.h"
+#include "../../common/target_san.h"
+#include "mm_load_harness.h"
 
 // 하니스 설정
 #define MM_LOAD_HARNESS_VERSION "1.0.0"
 
+/*
+ * 입력 디코더 (CFS_DECODER=legacy 이면 이전 data_offset 방식)
+ * 두 디코더의 커버리지 증가율 비교(scripts/compare_decoders.sh)용으로 남겨 둔다.
+ */
+static boolean g_legacy_decoder = FALSE;
+
+// 차분 모드 (CFS_DIFFERENTIAL=1, 초기화 시 한 번 읽음)
+static boolean g_differential = FALSE;
+
+/*
+ * 로드 방식 (CFS_LOAD_STREAM=1 이면 단일 패스 스트리밍)
+ * 기본은 CRC 를 먼저 확인하고 일치할 때만 쓰는 비행 코드 순서이며,
+ * 스트리밍은 청크마다 CRC 누적과 복사를 함께 해서 불일치를 쓴 뒤에 보고한다.
+ * 차분 모드에서는 참조 구현과 메모리 상태를 맞추기 위해 항상 먼저 확인한다.
+ */
+static CFS_SimMemLoadMode_t g_load_mode = CFS_SIMMEM_LOAD_VERIFY_FIRST;
+
+/*
+ * 시퀀스 모드 (CFS_SEQUENCE=1)
+ * 입력 = 단계 목록, 단계 = [op:1][len:2 LE][payload:len]
+ *   op % 5 == 0 - VFS 에 파일 쓰기 (payload[0] = 경로 선택, 나머지 = 내용)
+ *   op % 5 == 1 - 로드 명령 (payload = 패킷 바이트, 파일은 VFS 에서 읽음)
+ *   op % 5 == 2 - MM 카운터 리셋
+ *   op % 5 == 3 - EEPROM 쓰기 허용 (payload = Bank, 4 바이트 LE, 짧으면 0 으로 채움)
+ *   op % 5 == 4 - EEPROM 쓰기 금지 (payload 는 3 과 같음)
+ * 매 입력은 루트 스냅샷(또는 캐시된 가장 긴 접두부 스냅샷)에서 시작한다.
+ * 루트 상태의 EEPROM 뱅크는 MM_DefaultConfig.enable_eeprom_write 를 따르므로
+ * EEPROM 로드 전에 쓰기 허용 단계가 있어야 한다 (단일 명령 입력은 항상 허용).
+ * CFS_SNAPSHOT=0 이면 접두부 캐시 없이 매번 루트에서 전체 단계를 실행한다.
+ */
+#define MM_LOAD_SEQ_MAX_STEPS   16
+#define MM_LOAD_SEQ_HEADER_SIZE 3
+
+enum {
+    MM_LOAD_SEQ_PUT_FILE       = 0,
+    MM_LOAD_SEQ_LOAD           = 1,
+    MM_LOAD_SEQ_RESET          = 2,
+    MM_LOAD_SEQ_EEPROM_ENABLE  = 3,
+    MM_LOAD_SEQ_EEPROM_DISABLE = 4,
+    MM_LOAD_SEQ_OPS
+};
+
+static boolean g_sequence = FALSE;
+static boolean g_snapshot_cache = TRUE;
+static CFS_THREAD_LOCAL CFS_Snapshot_t *t_root_snapshot = NULL;
+
+/*
+ * 디코드 표 (첫 디코드 때 현재 미션으로 한 번 만든다)
+ * 심볼 이름과 "<경로>testfile.bin" 을 패킷 필드 크기 레코드로 미리 조립하고
+ * 선택값 % 개수, NumOfBytes % 최대값은 선택기 표와 상수 제수로 계산한다.
+ */
+#define MM_LOAD_FILE_SUFFIX "testfile.bin"
+
+static CFS_NameTable_t g_symbol_names;
+static CFS_NameTable_t g_file_names;
+static int32_t *g_file_name_status;     // 파일 이름 레코드별 MM_VerifyFileName 결과
+static pthread_once_t g_decode_once = PTHREAD_ONCE_INIT;
+
+// NumOfBytes 범위 (mm_load_mem_types 순서: RAM, EEPROM)
+static const CFS_Divisor_t mm_load_max_bytes[] = {
+    CFS_DIVISOR(MM_MAX_LOAD_FILE_DATA_RAM),
+    CFS_DIVISOR(MM_MAX_LOAD_FILE_DATA_EEPROM)
+};
+
+static void MM_Load_BuildDecodeTables(void) {
+    const CFS_Mission_t *mission = CFS_Mission_Get();
+
+    if (CFS_NameTable_Build(&g_symbol_names, mission->symbols, mission->symbol_count,
+                            "", OS_MAX_API_NAME) != CFE_SUCCESS ||
+        CFS_NameTable_Build(&g_file_names, mission->paths, mission->path_count,
+                            MM_LOAD_FILE_SUFFIX, OS_MAX_PATH_LEN) != CFE_SUCCESS) {
+        // 표가 비면 디코더가 모든 입력을 거부한다
+        fprintf(stderr, "Cannot build mm_load decode tables\n");
+        CFS_NameTable_Free(&g_symbol_names);
+        CFS_NameTable_Free(&g_file_names);
+        return;
+    }
+
+    // 허용 경로 검사는 레코드마다 한 번만 하고 디코드 결과로 두 구현이 공유한다
+    g_file_name_status = malloc(g_file_names.count * sizeof(*g_file_name_status));
+    if (!g_file_name_status) {
+        fprintf(stderr, "Cannot build mm_load decode tables\n");
+        CFS_NameTable_Free(&g_symbol_names);
+        CFS_NameTable_Free(&g_file_names);
+        return;
+    }
+    for (uint32_t i = 0; i < g_file_names.count; i++) {
+        g_file_name_status[i] = MM_VerifyFileName(CFS_NameTable_Get(&g_file_names, i));
+    }
+}
+
+static inline boolean MM_Load_DecodeTablesReady(void) {
+    pthread_once(&g_decode_once, MM_Load_BuildDecodeTables);
+    return g_file_names.count > 0;
+}
+
 // 안전한 메모리 조작 매크로들
 #define CFS_SAFE_MEMCPY(dst, src, size) do { \
     if ((dst) && (src) && (size) > 0) { \
@@ -48,7 +162,7 @@
 #endif
 
 /*
- * MM_LoadMemFromFileCmd 패킷 생성 함수
+ * MM_LoadMemFromFileCmd 패킷 생성 함수 (이전 data_offset 디코더, CFS_DECODER=legacy)
  * 
  * @param Data: 퍼징 입력 데이터
  * @param Size: 입력 데이터 크기
@@ -57,7 +171,7 @@
 void* MM_Load_ConstructPacket(const uint8_t *Data, size_t Size) {
     const size_t PACKET_SIZE = sizeof(MM_LoadMemFromFileCmd_t);
     
-    if (Size < PACKET_SIZE) {
+    if (Size < PACKET_SIZE || !MM_Load_DecodeTablesReady()) {
         return NULL;
     }
     
@@ -81,19 +195,18 @@ void* MM_Load_ConstructPacket(const uint8_t *Data, size_t Size) {
     
     // MemType 설정 (1=RAM, 2=EEPROM)
     if (data_offset < Size) {
-        packet->MemType = (Data[data_offset] % 2) + 1;
+        packet->MemType = (Data[data_offset] & 1) + 1;
         data_offset++;
     } else {
         packet->MemType = MM_RAM; // 기본값: RAM
     }
     
     // NumOfBytes 설정 (메모리 타입에 따른 최대값 제한)
-    uint32_t max_bytes = (packet->MemType == MM_RAM) ? 
-                        MM_MAX_LOAD_FILE_DATA_RAM : MM_MAX_LOAD_FILE_DATA_EEPROM;
+    const CFS_Divisor_t *max_bytes = &mm_load_max_bytes[packet->MemType == MM_RAM ? 0 : 1];
     
     if (data_offset + sizeof(uint32_t) <= Size) {
         CFS_SAFE_MEMCPY(&packet->NumOfBytes, Data + data_offset, sizeof(uint32_t));
-        packet->NumOfBytes = (packet->NumOfBytes % max_bytes) + 1;
+        packet->NumOfBytes = CFS_Divisor_Mod(max_bytes, packet->NumOfBytes) + 1;
         data_offset += sizeof(uint32_t);
     } else {
         packet->NumOfBytes = 1024; // 기본값
@@ -112,13 +225,12 @@ void* MM_Load_ConstructPacket(const uint8_t *Data, size_t Size) {
         uint8_t choice_byte = Data[data_offset];
         data_offset++;
         
-        if (choice_byte % 2 == 0) {
+        if ((choice_byte & 1) == 0) {
             // 심볼 이름 사용
-            if (CFS_NUM_VALID_SYMBOLS > 0 && data_offset < Size) {
-                size_t symbol_idx = Data[data_offset] % CFS_NUM_VALID_SYMBOLS;
-                CFS_SAFE_STRNCPY(packet->DestSymAddress.SymName, 
-                               cfs_valid_symbols[symbol_idx], 
-                               OS_MAX_API_NAME);
+            if (g_symbol_names.count > 0 && data_offset < Size) {
+                size_t symbol_idx = g_symbol_names.select.narrow[Data[data_offset]];
+                memcpy(packet->DestSymAddress.SymName,
+                       CFS_NameTable_Get(&g_symbol_names, symbol_idx), OS_MAX_API_NAME);
                 packet->DestSymAddress.Offset = 0;
                 data_offset++;
             }
@@ -141,17 +253,14 @@ void* MM_Load_ConstructPacket(const uint8_t *Data, size_t Size) {
     
     // 파일 이름 설정
     if (data_offset < Size) {
-        uint8_t path_choice = Data[data_offset] % CFS_NUM_VALID_PATHS;
-        CFS_SAFE_STRNCPY(packet->FileName, cfs_valid_paths[path_choice], OS_MAX_PATH_LEN);
+        size_t path_choice = g_file_names.select.narrow[Data[data_offset]];
         data_offset++;
         
-        // 파일 이름 추가
-        const char* filename_suffix = "testfile.bin";
-        size_t current_len = strlen(packet->FileName);
-        size_t remaining = OS_MAX_PATH_LEN - current_len - 1;
-        
-        if (remaining > strlen(filename_suffix)) {
-            CFS_SAFE_STRNCAT(packet->FileName, filename_suffix, OS_MAX_PATH_LEN);
+        // 파일 이름은 접미 뒤에 1 바이트 이상 남을 때만 붙인다 (아니면 경로만)
+        if (g_file_names.lengths[path_choice] + 1 < OS_MAX_PATH_LEN) {
+            memcpy(packet->FileName, CFS_NameTable_Get(&g_file_names, path_choice), OS_MAX_PATH_LEN);
+        } else {
+            CFS_SAFE_STRNCPY(packet->FileName, CFS_Mission_Get()->paths[path_choice], OS_MAX_PATH_LEN);
         }
     } else {
         CFS_SAFE_STRNCPY(packet->FileName, "/cf/apps/default.bin", OS_MAX_PATH_LEN);
@@ -164,18 +273,118 @@ void* MM_Load_ConstructPacket(const uint8_t *Data, size_t Size) {
 }
 
 /*
- * MM_LoadMemFromFileCmd 함수 시뮬레이션
- * 실제 CFS 환경에서는 mm_load.c의 MM_LoadMemFromFileCmd 함수를 호출
+ * 타입 소비기 기반 입력 배치 (고정 폭 필드 + 꼬리 페이로드)
+ *   [0]      MemType 선택 (RAM, EEPROM)
+ *   [1..4]   NumOfBytes (1 .. 메모리 타입별 최대값)
+ *   [5..8]   CRC (0 이면 검사 안 함)
+ *   [9]      주소 방식 (짝수 = 심볼, 홀수 = 직접 주소)
+ *   [10]     심볼 선택
+ *   [11..18] 직접 주소 오프셋 (타겟 기본 주소 + 하위 31비트)
+ *   [19]     파일 경로 선택
+ *   [20..]   로드할 파일 내용
+ * 주소 방식과 무관하게 모든 필드가 자리를 차지하므로 변이가 다른 필드를 밀지 않는다.
  */
-int32_t MM_LoadMemFromFileCmd_Simulation(MM_LoadMemFromFileCmd_t *CmdPtr) {
-    if (!CmdPtr) {
-        CFS_ERROR_PRINT("Null command pointer");
-        return OS_INVALID_POINTER;
+static const uint8_t mm_load_mem_types[] = { MM_RAM, MM_EEPROM };
+
+void* MM_Load_DecodeInput(const uint8_t *Data, size_t Size, MM_Load_FileImage_t *File) {
+    if (!MM_Load_DecodeTablesReady()) {
+        return NULL;
+    }
+
+    CFS_Input_t in;
+    CFS_Input_Init(&in, Data, Size);
+
+    size_t mem_index = CFS_Input_U8(&in) & 1;
+    uint8_t mem_type = mm_load_mem_types[mem_index];
+    uint32_t num_bytes = CFS_Input_RangeDiv(&in, 1, &mm_load_max_bytes[mem_index]);
+    uint32_t crc = CFS_Input_U32(&in);
+    boolean use_symbol = !CFS_Input_Bool(&in);
+    const char *symbol = CFS_NameTable_Get(&g_symbol_names, CFS_Input_Select(&in, &g_symbol_names.select));
+    uint64_t direct = CFS_Input_U64(&in);
+    size_t file_index = CFS_Input_Select(&in, &g_file_names.select);
+
+    if (!CFS_Input_Complete(&in)) {
+        return NULL;
+    }
+
+    MM_LoadMemFromFileCmd_t *packet = calloc(1, sizeof(MM_LoadMemFromFileCmd_t));
+    if (!packet) {
+        return NULL;
+    }
+
+    CFE_SB_MsgId_t msg_id = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_SetMsgId((CFE_MSG_Message_t*)&packet->CmdHeader, msg_id);
+    CFE_MSG_SetSize((CFE_MSG_Message_t*)&packet->CmdHeader, sizeof(MM_LoadMemFromFileCmd_t));
+    CFE_MSG_SetSequenceCount((CFE_MSG_Message_t*)&packet->CmdHeader, 0);
+    CFE_MSG_SetSegmentationFlag((CFE_MSG_Message_t*)&packet->CmdHeader, 0x3);
+    CFE_MSG_SetFcnCode((CFE_MSG_Message_t*)&packet->CmdHeader, MM_LOAD_MEM_FROM_FILE_CC);
+
+    packet->MemType = mem_type;
+    packet->NumOfBytes = num_bytes;
+    packet->CRC = crc;
+    if (use_symbol) {
+        memcpy(packet->DestSymAddress.SymName, symbol, OS_MAX_API_NAME);
+    } else {
+        uint64_t base_addr = (mem_type == MM_RAM) ? CFS_DEFAULT_RAM_ADDR : CFS_DEFAULT_EEPROM_ADDR;
+        packet->DestSymAddress.Offset = base_addr + (direct & 0x7FFFFFFF);
+    }
+    memcpy(packet->FileName, CFS_NameTable_Get(&g_file_names, file_index), OS_MAX_PATH_LEN);
+
+    size_t tail = 0;
+    File->Data = CFS_Input_Tail(&in, &tail);
+    File->Size = (uint32_t)tail;
+    File->NameStatus = g_file_name_status[file_index];
+
+    CFS_DEBUG_PRINT("Decoded packet: MemType=%d, NumOfBytes=%u, File=%s",
+                     packet->MemType, packet->NumOfBytes, packet->FileName);
+    return packet;
+}
+
+// 설정된 디코더로 패킷과 파일 내용 구성
+static MM_LoadMemFromFileCmd_t* MM_Load_Decode(const uint8_t *Data, size_t Size,
+                                               MM_Load_FileImage_t *File) {
+    if (!g_legacy_decoder) {
+        return (MM_LoadMemFromFileCmd_t*)MM_Load_DecodeInput(Data, Size, File);
+    }
+
+    // 이전 방식: 패킷 크기만큼이 필드 영역, 나머지 바이트가 파일 내용
+    if (Size < sizeof(MM_LoadMemFromFileCmd_t)) {
+        return NULL;
+    }
+    File->Data = Data + sizeof(MM_LoadMemFromFileCmd_t);
+    File->Size = (uint32_t)(Size - sizeof(MM_LoadMemFromFileCmd_t));
+    MM_LoadMemFromFileCmd_t *packet = (MM_LoadMemFromFileCmd_t*)MM_Load_ConstructPacket(Data, Size);
+    if (packet) {
+        File->NameStatus = MM_VerifyFileName(packet->FileName);
+    }
+    return packet;
+}
+
+/*
+ * 명령 검증과 로드 (HK/이벤트 처리는 호출자)
+ * 
+ * @param ResolvedAddr: 해석된 목적지 주소 (성공 시)
+ * @param ErrEventID: 실패 시 보낼 이벤트 ID
+ */
+static int32_t MM_Load_SimulateLoad(MM_LoadMemFromFileCmd_t *CmdPtr, const MM_Load_FileImage_t *File,
+                                    uint64_t *ResolvedAddr, CFE_EVS_EventID_t *ErrEventID) {
+    // 오류 코드와 이벤트는 비행 코드 검사 순서를 따른다 (차분 모드의 상태 코드 비교 대상)
+    CFS_STAGE(CFS_STAGE_PATH);
+    *ErrEventID = MM_FILENAME_ERR_EID;
+    if (!File || File->NameStatus != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Invalid filename: %s", CmdPtr->FileName);
+        return CFS_MM_ERROR_INVALID_FILE;
     }
     
-    CFS_DEBUG_PRINT("Processing MM Load command");
+    *ErrEventID = MM_FILE_ACCESS_ERR_EID;
+    if (!File->Data) {
+        CFS_ERROR_PRINT("Cannot open file: %s", CmdPtr->FileName);
+        return CFS_MM_ERROR_FILE_ACCESS;
+    }
     
     // 메모리 타입 검증
+    CFS_STAGE(CFS_STAGE_VALIDATE);
+    *ErrEventID = MM_LOAD_FROM_FILE_ERR_EID;
     if (CmdPtr->MemType != MM_RAM && CmdPtr->MemType != MM_EEPROM) {
         CFS_ERROR_PRINT("Invalid memory type: %d", CmdPtr->MemType);
         return CFS_MM_ERROR_INVALID_MEMTYPE;
@@ -194,33 +403,41 @@ int32_t MM_LoadMemFromFileCmd_Simulation(MM_LoadMemFromFileCmd_t *CmdPtr) {
         return CFS_MM_ERROR_INVALID_SIZE;
     }
     
-    // 파일 이름 검증
-    if (strlen(CmdPtr->FileName) == 0) {
-        CFS_ERROR_PRINT("Empty filename");
-        return CFS_MM_ERROR_INVALID_FILE;
+    // 파일 크기 검증
+    if (File->Size < CmdPtr->NumOfBytes) {
+        CFS_ERROR_PRINT("File too short: %u < %u", File->Size, CmdPtr->NumOfBytes);
+        *ErrEventID = MM_FILESIZE_ERR_EID;
+        return CFS_MM_ERROR_FILE_ACCESS;
     }
     
-    // 경로 순회 공격 방지
-    if (strstr(CmdPtr->FileName, "../") || strstr(CmdPtr->FileName, "..\\")) {
-        CFS_ERROR_PRINT("Path traversal detected in filename: %s", CmdPtr->FileName);
-        return CFS_MM_ERROR_INVALID_FILE;
+    // 먼저 확인 모드는 비행 코드처럼 주소 해석 전에 파일 CRC 를 검사한다
+    // (스트리밍 모드는 로드하면서 누적하므로 주소 오류가 먼저 보고된다)
+    uint32_t stream_crc = CmdPtr->CRC;
+    if (CmdPtr->CRC != 0 && g_load_mode == CFS_SIMMEM_LOAD_VERIFY_FIRST) {
+        CFS_STAGE(CFS_STAGE_TRANSFER);
+        uint32_t crc = MM_CalculateCRC32(File->Data, CmdPtr->NumOfBytes, 0xFFFFFFFF) ^ 0xFFFFFFFF;
+        if (crc != CmdPtr->CRC) {
+            CFS_ERROR_PRINT("CRC mismatch: computed 0x%08X, expected 0x%08X", crc, CmdPtr->CRC);
+            return CFS_MM_ERROR_CRC_MISMATCH;
+        }
+        stream_crc = 0;
     }
     
-    // 심볼 주소 해석
+    // 심볼 주소 해석 (심볼 캐시 경유)
+    CFS_STAGE(CFS_STAGE_RESOLVE);
+    *ErrEventID = MM_SYMNAME_ERR_EID;
     uint64_t resolved_addr = 0;
-    if (strlen(CmdPtr->DestSymAddress.SymName) > 0) {
-        // 심볼 이름이 있는 경우 - Mock에서는 간단히 계산
-        resolved_addr = CFS_DEFAULT_RAM_ADDR + strlen(CmdPtr->DestSymAddress.SymName) * 0x1000;
-        resolved_addr += CmdPtr->DestSymAddress.Offset;
-        CFS_DEBUG_PRINT("Using symbol: %s with offset: 0x%lx", 
-                       CmdPtr->DestSymAddress.SymName, CmdPtr->DestSymAddress.Offset);
-    } else {
-        // 직접 주소 사용
-        resolved_addr = CmdPtr->DestSymAddress.Offset;
-        CFS_DEBUG_PRINT("Using direct address: 0x%lx", resolved_addr);
+    int32_t resolve_status = MM_ResolveSymAddr(&CmdPtr->DestSymAddress, &resolved_addr);
+    if (resolve_status != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Symbol lookup failed: %.*s", OS_MAX_API_NAME, 
+                        CmdPtr->DestSymAddress.SymName);
+        return CFS_MM_ERROR_INVALID_ADDR;
     }
+    CFS_DEBUG_PRINT("Resolved destination: 0x%lx", resolved_addr);
     
     // 메모리 주소 검증
+    CFS_STAGE(CFS_STAGE_REGION);
+    *ErrEventID = MM_LOAD_FROM_FILE_ERR_EID;
     if (!CFS_IsValidMemoryAddress(resolved_addr, CmdPtr->MemType, CmdPtr->NumOfBytes)) {
         CFS_ERROR_PRINT("Invalid memory region: addr=0x%08lX, size=%u", 
                         resolved_addr, CmdPtr->NumOfBytes);
@@ -228,14 +445,71 @@ int32_t MM_LoadMemFromFileCmd_Simulation(MM_LoadMemFromFileCmd_t *CmdPtr) {
     }
     
     // 메모리 정렬 검증
+    CFS_STAGE(CFS_STAGE_ALIGN);
     if ((resolved_addr % CFS_MEMORY_ALIGNMENT) != 0) {
         CFS_ERROR_PRINT("Address not properly aligned: 0x%08lX", resolved_addr);
         return CFS_MM_ERROR_ALIGNMENT;
     }
     
+    // 시뮬레이션 타겟 메모리에 중단 불가 구간 단위로 로드 (스트리밍 모드는 파일 CRC 도 함께 검증)
+    CFS_STAGE(CFS_STAGE_TRANSFER);
+    CFS_VClock_FileAccess(CmdPtr->NumOfBytes);
+    uint32_t crc = 0;
+    int32_t load_status = CFS_SimMem_LoadStream(resolved_addr, File->Data, CmdPtr->NumOfBytes,
+                                                MM_MAX_UNINTERRUPTIBLE_DATA, g_load_mode,
+                                                stream_crc, &crc);
+    if (load_status == CFS_MM_ERROR_CRC_MISMATCH) {
+        CFS_ERROR_PRINT("CRC mismatch: computed 0x%08X, expected 0x%08X", crc, CmdPtr->CRC);
+        return CFS_MM_ERROR_CRC_MISMATCH;
+    }
+    if (load_status != CFE_SUCCESS) {
+        CFS_ERROR_PRINT("Memory write failed: 0x%08lX", resolved_addr);
+        return CFS_MM_ERROR_MEMORY_ACCESS;
+    }
+    
+    *ResolvedAddr = resolved_addr;
+    return CFE_SUCCESS;
+}
+
+/*
+ * MM_LoadMemFromFileCmd 함수 시뮬레이션
+ * 실제 CFS 환경에서는 mm_load.c의 MM_LoadMemFromFileCmd 함수를 호출
+ */
+int32_t MM_LoadMemFromFileCmd_Simulation(MM_LoadMemFromFileCmd_t *CmdPtr,
+                                         const MM_Load_FileImage_t *File) {
+    if (!CmdPtr) {
+        CFS_ERROR_PRINT("Null command pointer");
+        return OS_INVALID_POINTER;
+    }
+    
+    CFS_DEBUG_PRINT("Processing MM Load command");
+    
+    uint64_t resolved_addr = 0;
+    CFE_EVS_EventID_t err_event = MM_LOAD_FROM_FILE_ERR_EID;
+    int32_t status = MM_Load_SimulateLoad(CmdPtr, File, &resolved_addr, &err_event);
+    if (status != CFE_SUCCESS) {
+        MM_AppData.ErrCounter++;
+        CFE_EVS_SendEvent(err_event, CFE_EVS_EventType_ERROR,
+                          "MM Load simulation failed: File=%s, Status=%d",
+                          CmdPtr->FileName, (int)status);
+        return status;
+    }
+    
     CFS_INFO_PRINT("MM Load simulation successful: %u bytes from %s to 0x%08lX", 
                    CmdPtr->NumOfBytes, CmdPtr->FileName, resolved_addr);
     
+    // HK 갱신
+    MM_AppData.CmdCounter++;
+    MM_AppData.LastAction = MM_LOAD_FROM_FILE;
+    MM_AppData.MemType = CmdPtr->MemType;
+    MM_AppData.Address = (uint32)resolved_addr;
+    MM_AppData.BytesProcessed = CmdPtr->NumOfBytes;
+    CFS_SAFE_STRNCPY(MM_AppData.FileName, CmdPtr->FileName, OS_MAX_PATH_LEN);
+    
+    CFE_EVS_SendEvent(MM_LOAD_FROM_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "MM Load simulation: %u bytes from %s to 0x%08lX",
+                      CmdPtr->NumOfBytes, CmdPtr->FileName, (unsigned long)resolved_addr);
+    
     // 실제 환경에서는 여기서 파일을 읽어 메모리에 로드
     #ifndef CFS_FUZZING_MODE
         #ifdef CFS_ENVIRONMENT
@@ -247,28 +521,297 @@ int32_t MM_LoadMemFromFileCmd_Simulation(MM_LoadMemFromFileCmd_t *CmdPtr) {
     return CFE_SUCCESS;
 }
 
+// 차분 실행용 어댑터
+static int32_t MM_Load_SimulationSide(void *cmd, void *arg) {
+    return MM_LoadMemFromFileCmd_Simulation((MM_LoadMemFromFileCmd_t *)cmd,
+                                            (const MM_Load_FileImage_t *)arg);
+}
+
+static int32_t MM_Load_ReferenceSide(void *cmd, void *arg) {
+    return MM_LoadMemFromFileCmd_Reference((MM_LoadMemFromFileCmd_t *)cmd,
+                                           (const MM_Load_FileImage_t *)arg);
+}
+
+// 환경 변수로 차분 모드와 로드 방식 설정
+static void MM_Load_ConfigureDifferential(boolean default_fatal) {
+    const char *env = getenv("CFS_DIFFERENTIAL");
+    g_differential = (env && env[0] != '\0' && env[0] != '0');
+    if (g_differential) {
+        CFS_Diff_ConfigureFromEnv(default_fatal);
+    }
+
+    env = getenv("CFS_LOAD_STREAM");
+    boolean stream = (env && env[0] != '\0' && env[0] != '0');
+    g_load_mode = (stream && !g_differential) ? CFS_SIMMEM_LOAD_STREAM : CFS_SIMMEM_LOAD_VERIFY_FIRST;
+}
+
+// 워커 스레드 종료 시 루트 스냅샷 해제 (CFS_Replay_ReleaseThread)
+static void MM_Load_ReleaseThread(void) {
+    CFS_Snapshot_Free(t_root_snapshot);
+    t_root_snapshot = NULL;
+}
+
+// 환경 변수로 시퀀스/스냅샷 모드와 입력 디코더 설정
+static void MM_Load_ConfigureSequence(void) {
+    const char *env = getenv("CFS_DECODER");
+    g_legacy_decoder = (env && strcmp(env, "legacy") == 0);
+    env = getenv("CFS_SEQUENCE");
+    g_sequence = (env && env[0] != '\0' && env[0] != '0');
+    env = getenv("CFS_SNAPSHOT");
+    g_snapshot_cache = !(env && env[0] == '0');
+    CFS_Replay_SetThreadRelease(MM_Load_ReleaseThread);
+}
+
+// 로드 명령 하나 실행 (차분 모드에서는 같은 패킷/메모리 상태로 참조 구현과 비교)
+static int32_t MM_Load_RunCommand(MM_LoadMemFromFileCmd_t *packet, MM_Load_FileImage_t *file) {
+    if (g_differential) {
+        boolean diverged = FALSE;
+        int32_t status = CFS_Diff_Run("MM_LoadMemFromFileCmd", packet, file,
+                                      MM_Load_ReferenceSide, MM_Load_SimulationSide, &diverged);
+        return diverged ? CFS_REPLAY_STATUS_DIVERGED : status;
+    }
+    return MM_LoadMemFromFileCmd_Simulation(packet, file);
+}
+
 /*
- * LibFuzzer 엔트리 포인트
+ * MM_EepromWriteEnaCmd / MM_EepromWriteDisCmd 시뮬레이션
+ * 미션에 없는 뱅크면 실패 (CFE_PSP_EepromWriteEnable 이 오류를 돌려주는 경우)
  */
-int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
-    // 최소 패킷 크기 확인
-    if (size < sizeof(MM_LoadMemFromFileCmd_t)) {
-        return 0;
+static int32_t MM_Load_EepromWriteCmd(const MM_EepromWriteEnaCmd_t *CmdPtr, boolean enable) {
+    int32_t status = CFS_Eeprom_SetWriteEnable(CmdPtr->Bank, enable);
+    if (status != CFE_SUCCESS) {
+        MM_AppData.ErrCounter++;
+        CFE_EVS_SendEvent(enable ? MM_EEPROM_WRITE_ENA_ERR_EID : MM_EEPROM_WRITE_DIS_ERR_EID,
+                          CFE_EVS_EventType_ERROR, "EEPROM bank %u write %s failed",
+                          (unsigned)CmdPtr->Bank, enable ? "enable" : "disable");
+        return status;
+    }
+
+    MM_AppData.CmdCounter++;
+    MM_AppData.LastAction = enable ? MM_EEPROMWRITE_ENA : MM_EEPROMWRITE_DIS;
+    CFE_EVS_SendEvent(enable ? MM_EEPROM_WRITE_ENA_INF_EID : MM_EEPROM_WRITE_DIS_INF_EID,
+                      CFE_EVS_EventType_INFORMATION, "EEPROM bank %u write %s",
+                      (unsigned)CmdPtr->Bank, enable ? "enabled" : "disabled");
+    return CFE_SUCCESS;
+}
+
+// 시퀀스 단계 하나 실행
+static int32_t MM_Load_RunStep(uint8_t op, const uint8_t *payload, uint16_t len) {
+    switch (op % MM_LOAD_SEQ_OPS) {
+        case MM_LOAD_SEQ_PUT_FILE: {
+            if (len == 0) {
+                return CFE_SUCCESS;
+            }
+            if (!MM_Load_DecodeTablesReady()) {
+                return CFS_MM_ERROR_RESOURCE_LIMIT;
+            }
+            const char *path = CFS_NameTable_Get(&g_file_names, g_file_names.select.narrow[payload[0]]);
+            return CFS_Vfs_WriteFile(path, payload + 1, (uint32_t)(len - 1));
+        }
+        
+        case MM_LOAD_SEQ_LOAD: {
+            // 짧은 payload 는 0 으로 채워 패킷 크기를 맞춘다
+            uint8_t raw[sizeof(MM_LoadMemFromFileCmd_t)] = {0};
+            memcpy(raw, payload, len < sizeof(raw) ? len : sizeof(raw));
+            CFS_STAGE(CFS_STAGE_DECODE);
+            
+            MM_Load_FileImage_t file = { NULL, 0, CFS_MM_ERROR_INVALID_FILE };
+            MM_LoadMemFromFileCmd_t *packet = MM_Load_Decode(raw, sizeof(raw), &file);
+            if (!packet) {
+                return CFS_MM_ERROR_RESOURCE_LIMIT;
+            }
+            
+            // 파일 내용은 페이로드 꼬리가 아니라 VFS 에서 읽는다
+            file.Data = NULL;
+            file.Size = 0;
+            (void)CFS_Vfs_ReadFile(packet->FileName, &file.Data, &file.Size);
+            int32_t status = MM_Load_RunCommand(packet, &file);
+            free(packet);
+            return status;
+        }
+        
+        case MM_LOAD_SEQ_EEPROM_ENABLE:
+        case MM_LOAD_SEQ_EEPROM_DISABLE: {
+            uint8_t bank[4] = {0};
+            memcpy(bank, payload, len < sizeof(bank) ? len : sizeof(bank));
+            MM_EepromWriteEnaCmd_t cmd;
+            memset(&cmd, 0, sizeof(cmd));
+            cmd.Bank = (uint32)bank[0] | ((uint32)bank[1] << 8) | ((uint32)bank[2] << 16) |
+                       ((uint32)bank[3] << 24);
+            return MM_Load_EepromWriteCmd(&cmd, op % MM_LOAD_SEQ_OPS == MM_LOAD_SEQ_EEPROM_ENABLE);
+        }
+        
+        default:
+            MM_AppData.CmdCounter = 0;
+            MM_AppData.ErrCounter = 0;
+            return CFE_SUCCESS;
+    }
+}
+
+/*
+ * 접두부 키 누적 (단계 헤더 + 페이로드 앞/뒤 표본만 해시)
+ * 큰 파일 단계를 매 실행마다 전부 해시하지 않기 위한 것으로,
+ * 정확한 일치는 스냅샷 캐시가 접두부 바이트 비교로 확인한다.
+ */
+#define MM_LOAD_SEQ_KEY_SAMPLE  32
+
+static uint64_t MM_Load_HashBytes(uint64_t hash, const uint8_t *data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static uint64_t MM_Load_HashStep(uint64_t hash, const uint8_t *step, uint16_t len) {
+    const uint8_t *payload = step + MM_LOAD_SEQ_HEADER_SIZE;
+    
+    hash = MM_Load_HashBytes(hash, step, MM_LOAD_SEQ_HEADER_SIZE);
+    if (len <= 2 * MM_LOAD_SEQ_KEY_SAMPLE) {
+        return MM_Load_HashBytes(hash, payload, len);
+    }
+    hash = MM_Load_HashBytes(hash, payload, MM_LOAD_SEQ_KEY_SAMPLE);
+    return MM_Load_HashBytes(hash, payload + len - MM_LOAD_SEQ_KEY_SAMPLE, MM_LOAD_SEQ_KEY_SAMPLE);
+}
+
+// HK 상태, VFS, 시뮬레이션 메모리를 처음 상태로 (입력 사이에 남지 않게)
+static void MM_Load_ResetState(void) {
+    MM_ResetAppData();
+    CFS_Vfs_Clear();
+    CFS_SimMem_Reset();
+}
+
+/*
+ * 명령 시퀀스 실행
+ * 
+ * @return: 마지막 로드 명령의 상태 코드 (불일치가 있었으면 CFS_REPLAY_STATUS_DIVERGED)
+ */
+static int32_t MM_Load_ExecuteSequence(const uint8_t *data, size_t size) {
+    size_t   offsets[MM_LOAD_SEQ_MAX_STEPS];
+    uint16_t lengths[MM_LOAD_SEQ_MAX_STEPS];
+    uint64_t prefix[MM_LOAD_SEQ_MAX_STEPS];
+    uint32_t steps = 0;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    
+    // 단계 분해 (마지막 단계의 길이가 넘치면 남은 바이트까지만)
+    size_t pos = 0;
+    while (steps < MM_LOAD_SEQ_MAX_STEPS && pos + MM_LOAD_SEQ_HEADER_SIZE <= size) {
+        uint16_t len = (uint16_t)(data[pos + 1] | (data[pos + 2] << 8));
+        if (len > size - pos - MM_LOAD_SEQ_HEADER_SIZE) {
+            len = (uint16_t)(size - pos - MM_LOAD_SEQ_HEADER_SIZE);
+        }
+        offsets[steps] = pos;
+        lengths[steps] = len;
+        hash = MM_Load_HashStep(hash, data + pos, len);
+        prefix[steps++] = hash;
+        pos += MM_LOAD_SEQ_HEADER_SIZE + (size_t)len;
+    }
+    if (steps == 0) {
+        return CFS_REPLAY_STATUS_REJECTED;
+    }
+    
+    // 루트 스냅샷은 스레드별로 깨끗한 상태에서 한 번 캡처
+    if (!t_root_snapshot) {
+        MM_Load_ResetState();
+        CFS_Eeprom_Reset(MM_DefaultConfig.enable_eeprom_write);
+        t_root_snapshot = CFS_Snapshot_Capture();
+        if (!t_root_snapshot) {
+            return CFS_MM_ERROR_RESOURCE_LIMIT;
+        }
+    }
+    
+    // 캐시된 가장 긴 접두부 (마지막 단계 제외)에서 시작
+    const CFS_Snapshot_t *start_snap = t_root_snapshot;
+    uint32_t start = 0;
+    if (g_snapshot_cache) {
+        for (uint32_t i = steps - 1; i > 0; i--) {
+            CFS_Snapshot_t *cached = CFS_SnapshotCache_Find(prefix[i - 1], data, offsets[i]);
+            if (cached) {
+                start_snap = cached;
+                start = i;
+                break;
+            }
+        }
+    }
+    CFS_STAGE(CFS_STAGE_SNAPSHOT);
+    if (CFS_Snapshot_Restore(start_snap) != CFE_SUCCESS) {
+        return CFS_MM_ERROR_RESOURCE_LIMIT;
     }
     
-    // 패킷 생성
-    MM_LoadMemFromFileCmd_t *packet = (MM_LoadMemFromFileCmd_t*)MM_Load_ConstructPacket(data, size);
+    int32_t status = CFE_SUCCESS;
+    boolean diverged = FALSE;
+    for (uint32_t i = start; i < steps; i++) {
+        uint8_t op = data[offsets[i]];
+        int32_t step_status = MM_Load_RunStep(op, data + offsets[i] + MM_LOAD_SEQ_HEADER_SIZE, lengths[i]);
+        if (op % MM_LOAD_SEQ_OPS == MM_LOAD_SEQ_LOAD) {
+            status = step_status;
+            diverged |= (step_status == CFS_REPLAY_STATUS_DIVERGED);
+        }
+        
+        // 반복해서 보이는 접두부는 마지막 단계 직전 상태를 캐시
+        if (g_snapshot_cache && i + 2 == steps && CFS_SnapshotCache_ShouldCapture(prefix[i])) {
+            CFS_STAGE(CFS_STAGE_SNAPSHOT);
+            CFS_SnapshotCache_Insert(prefix[i], data, offsets[i + 1], CFS_Snapshot_Capture());
+        }
+    }
+    
+    return diverged ? CFS_REPLAY_STATUS_DIVERGED : status;
+}
+
+// 단일 로드 명령 입력 실행 (매 입력 깨끗한 상태에서 시작)
+static int32_t MM_Load_ExecuteCommand(const uint8_t *data, size_t size) {
+    MM_Load_ResetState();
+    
+    // 패킷 생성 (필드 영역 뒤의 나머지 바이트가 로드할 파일 내용)
+    CFS_STAGE(CFS_STAGE_DECODE);
+    MM_Load_FileImage_t file = { NULL, 0, CFS_MM_ERROR_INVALID_FILE };
+    MM_LoadMemFromFileCmd_t *packet = MM_Load_Decode(data, size, &file);
     if (!packet) {
-        return 0;
+        return CFS_REPLAY_STATUS_REJECTED;
     }
     
-    // 함수 테스트
-    int32_t status = MM_LoadMemFromFileCmd_Simulation(packet);
-    (void)status; // 사용되지 않는 변수 경고 방지
+    int32_t status = MM_Load_RunCommand(packet, &file);
     
     // 메모리 해제
     free(packet);
     
+    return status;
+}
+
+/*
+ * 입력 하나 실행 (LibFuzzer 엔트리와 배치 재생에서 공용)
+ * 명령 종류별 예산을 넘기면 워치독이 입력과 멈춘 단계를 기록한다.
+ * 
+ * @return: 시뮬레이션 상태 코드, 패킷 생성 불가 시 CFS_REPLAY_STATUS_REJECTED,
+ *          EEPROM 페이지 마모 한도 초과 시 CFS_REPLAY_STATUS_WEAR
+ */
+int32_t MM_Load_ExecuteInput(const uint8_t *data, size_t size) {
+    CFS_Watchdog_Begin(g_sequence ? CFS_WATCHDOG_CMD_SEQUENCE : CFS_WATCHDOG_CMD_LOAD, data, size);
+    CFS_PROFILE_BEGIN(data, size);
+    CFS_Eeprom_BeginInput();
+    CFS_TargetSan_BeginInput();
+    CFS_VClock_BeginInput();
+    CFS_MockTrace_BeginInput(data, size);
+    int32_t status = g_sequence ? MM_Load_ExecuteSequence(data, size)
+                                : MM_Load_ExecuteCommand(data, size);
+    if (CFS_Eeprom_EndInput()) {
+        status = CFS_REPLAY_STATUS_WEAR;
+    }
+    if (CFS_TargetSan_EndInput()) {
+        status = CFS_REPLAY_STATUS_TARGET_SAN;
+    }
+    (void)CFS_VClock_EndInput();
+    CFS_MockTrace_EndInput();
+    CFS_PROFILE_END();
+    (void)CFS_Watchdog_End(status);
+    return status;
+}
+
+/*
+ * LibFuzzer 엔트리 포인트
+ */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    (void)MM_Load_ExecuteInput(data, size);
     return 0;
 }
 
@@ -283,6 +826,32 @@ int LLVMFuzzerInitialize(int *argc, char ***argv) {
     printf("Target: MM_LoadMemFromFileCmd\n");
     printf("Packet size: %zu bytes\n", sizeof(MM_LoadMemFromFileCmd_t));
     
+    CFS_Mission_ConfigureFromEnv();
+    CFS_Arena_ConfigureFromEnv();
+
+    // 차분 모드는 불일치 시 abort 하여 퍼저가 입력을 저장하게 한다
+    MM_Load_ConfigureDifferential(TRUE);
+    if (g_differential) {
+        printf("Differential mode: simulation vs reference\n");
+    }
+    MM_Load_ConfigureSequence();
+    if (g_sequence) {
+        printf("Sequence mode: prefix snapshot cache %s\n", g_snapshot_cache ? "on" : "off");
+    }
+    if (g_load_mode == CFS_SIMMEM_LOAD_STREAM) {
+        printf("Load mode: single-pass streaming CRC\n");
+    }
+    printf("Input decoder: %s\n", g_legacy_decoder ? "legacy" : "typed");
+    // 마모 발견 시 abort 하여 퍼저가 입력을 저장하게 한다
+    CFS_Eeprom_ConfigureFromEnv(TRUE);
+    // 타겟 메모리 위반도 크래시로 남긴다
+    CFS_TargetSan_ConfigureFromEnv(TRUE);
+    CFS_Watchdog_ConfigureFromEnv();
+    CFS_VClock_ConfigureFromEnv();
+    // 크래시 입력과 함께 Mock 호출 기록을 남긴다
+    (void)CFS_MockTrace_ConfigureFromEnv(TRUE);
+    CFS_PROFILE_CONFIGURE();
+    
     #ifdef CFS_DEBUG_MODE
         printf("Debug mode enabled\n");
     #endif
@@ -295,25 +864,72 @@ int LLVMFuzzerInitialize(int *argc, char ***argv) {
  */
 #ifdef STANDALONE_TEST
 int main(int argc, char **argv) {
-    (void)argc;
-    (void)argv;
+    CFS_Mission_ConfigureFromEnv();
+    CFS_Arena_ConfigureFromEnv();
+
+    // 재생 중에는 불일치를 입력별 상태로 보고하고 계속 진행
+    MM_Load_ConfigureDifferential(FALSE);
+    MM_Load_ConfigureSequence();
+    CFS_Eeprom_ConfigureFromEnv(FALSE);
+    CFS_TargetSan_ConfigureFromEnv(FALSE);
+    CFS_Watchdog_ConfigureFromEnv();
+    CFS_VClock_ConfigureFromEnv();
+    if (CFS_MockTrace_ConfigureFromEnv(FALSE) != CFE_SUCCESS) {
+        return 1;
+    }
+    CFS_PROFILE_CONFIGURE();
+    
+    // -fuzz 이면 프로세스 내 다중 워커 퍼징
+    if (argc > 1 && CFS_FuzzLoop_Requested(argc, argv)) {
+        // 퍼징 중 마모 발견은 크래시 입력으로 남긴다
+        CFS_Eeprom_ConfigureFromEnv(TRUE);
+        CFS_TargetSan_ConfigureFromEnv(TRUE);
+        (void)CFS_MockTrace_ConfigureFromEnv(TRUE);
+        int rc = CFS_FuzzLoop_Main(argc, argv, MM_Load_ExecuteInput);
+        CFS_Eeprom_PrintStats();
+        CFS_TargetSan_PrintStats();
+        CFS_Arena_PrintStats();
+        CFS_VClock_PrintStats();
+        CFS_Watchdog_PrintStats();
+        return rc;
+    }
+
+    // 파일/디렉토리/코퍼스 팩이 주어지면 프로세스 내 배치 재생
+    if (argc > 1) {
+        int rc = CFS_Replay_Main(argc, argv, MM_Load_ExecuteInput);
+        if (g_differential) {
+            CFS_Diff_PrintStats();
+        }
+        if (g_sequence) {
+            CFS_Snapshot_PrintStats();
+        }
+        CFS_Eeprom_PrintStats();
+        CFS_TargetSan_PrintStats();
+        CFS_Arena_PrintStats();
+        CFS_VClock_PrintStats();
+        CFS_Watchdog_PrintStats();
+        CFS_PROFILE_PRINT();
+        return rc;
+    }
     
     printf("=== CFS MM Load Harness Test ===\n");
     printf("Version: %s\n", MM_LOAD_HARNESS_VERSION);
     
-    // 테스트 데이터 생성
-    uint8_t test_data[] = {
-        0x01,                    // MemType choice
-        0x00, 0x10, 0x00, 0x00, // NumOfBytes (4096)
-        0x12, 0x34, 0x56, 0x78, // CRC
-        0x00,                    // Symbol choice (even = use symbol)
+    // 테스트 데이터 생성 (필드 영역 20 바이트 뒤 64 바이트가 파일 내용)
+    uint8_t test_data[20 + 64] = {
+        0x00,                    // MemType choice (RAM)
+        0x3F, 0x00, 0x00, 0x00, // NumOfBytes (64)
+        0x00, 0x00, 0x00, 0x00, // CRC (검사 안 함)
+        0x00,                    // Address mode (even = use symbol)
         0x02,                    // Symbol index
+        0, 0, 0, 0, 0, 0, 0, 0,  // Direct offset (unused)
         0x01                     // File path choice
     };
     
     printf("Test data size: %zu bytes\n", sizeof(test_data));
     
-    MM_LoadMemFromFileCmd_t *packet = (MM_LoadMemFromFileCmd_t*)MM_Load_ConstructPacket(test_data, sizeof(test_data));
+    MM_Load_FileImage_t file = { NULL, 0, CFS_MM_ERROR_INVALID_FILE };
+    MM_LoadMemFromFileCmd_t *packet = MM_Load_Decode(test_data, sizeof(test_data), &file);
     if (packet) {
         printf("Packet created successfully:\n");
         printf("  MemType: %u\n", packet->MemType);
@@ -322,9 +938,10 @@ int main(int argc, char **argv) {
         printf("  Symbol: %s\n", packet->DestSymAddress.SymName);
         printf("  Offset: 0x%lx\n", packet->DestSymAddress.Offset);
         printf("  FileName: %s\n", packet->FileName);
+        printf("  File bytes: %u\n", file.Size);
         
         printf("\nTesting MM_LoadMemFromFileCmd simulation...\n");
-        int32_t result = MM_LoadMemFromFileCmd_Simulation(packet);
+        int32_t result = MM_LoadMemFromFileCmd_Simulation(packet, &file);
         printf("Result: %d (%s)\n", result, (result == CFE_SUCCESS) ? "SUCCESS" : "ERROR");
         
         // 여러 번 실행하여 다양한 케이스 테스트
@@ -333,18 +950,19 @@ int main(int argc, char **argv) {
             // 약간씩 다른 데이터로 테스트
             uint8_t modified_data[sizeof(test_data)];
             memcpy(modified_data, test_data, sizeof(test_data));
-            modified_data[0] = (i % 2) + 1; // MemType 변경
+            modified_data[0] = (uint8_t)i; // MemType 변경
             
-            MM_LoadMemFromFileCmd_t *test_packet = (MM_LoadMemFromFileCmd_t*)MM_Load_ConstructPacket(modified_data, sizeof(modified_data));
-            if (test_packet) {
-                int32_t test_result = MM_LoadMemFromFileCmd_Simulation(test_packet);
-                printf("  Iteration %d: %s\n", i+1, (test_result == CFE_SUCCESS) ? "PASS" : "FAIL");
-                free(test_packet);
-            }
+            int32_t test_result = MM_Load_ExecuteInput(modified_data, sizeof(modified_data));
+            printf("  Iteration %d: %s\n", i+1, (test_result == CFE_SUCCESS) ? "PASS" : "FAIL");
         }
         
         free(packet);
-        printf("\nTest completed successfully!\n");
+        printf("HK: CmdCounter=%u, ErrCounter=%u\n", MM_AppData.CmdCounter, MM_AppData.ErrCounter);
+        CFS_SymCache_PrintStats();
+        if (g_differential) {
+            CFS_Diff_PrintStats();
+        }
+        printf("Test completed successfully!\n");
     } else {
         printf("Failed to create packet\n");
         return 1;
@@ -0,0 +1,28 @@
+/*
+ * MM LoadMemFromFile 하니스 내부 헤더
+ * 시뮬레이션과 참조 구현이 공유하는 타입/프로토타입
+ */
+
+#ifndef MM_LOAD_HARNESS_H
+#define MM_LOAD_HARNESS_H
+
+#include "../../common/cfe_mock.h"
+#include "../../common/cfs_config.h"
+#include "../../common/mm_types.h"
+
+// 로드할 파일 내용 (퍼징 입력 중 패킷 뒤의 나머지 바이트)
+typedef struct {
+    const uint8_t *Data;
+    uint32_t       Size;
+    int32_t        NameStatus;  // 디코더가 한 번 계산한 MM_VerifyFileName 결과
+} MM_Load_FileImage_t;
+
+// 하니스 시뮬레이션
+int32_t MM_LoadMemFromFileCmd_Simulation(MM_LoadMemFromFileCmd_t *CmdPtr,
+                                         const MM_Load_FileImage_t *File);
+
+// 비행 소프트웨어 mm_load.c 의 처리 순서를 따르는 참조 구현 (차분 모드)
+int32_t MM_LoadMemFromFileCmd_Reference(MM_LoadMemFromFileCmd_t *CmdPtr,
+                                        const MM_Load_FileImage_t *File);
+
+#endif // MM_LOAD_HARNESS_H
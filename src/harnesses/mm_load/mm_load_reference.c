@@ -0,0 +1,120 @@
+/*
+ * MM_LoadMemFromFileCmd 참조 구현 (차분 모드용)
+ *
+ * 비행 소프트웨어 mm_load.c 의 처리 순서를 그대로 따른다.
+ *   파일 이름 → 파일 열기 → 로드 파라미터/파일 크기 → CRC
+ *   → 심볼 해석 → 메모리 범위/권한 → 정렬 → 로드 (EEPROM 은 분할 쓰기)
+ * 하니스 시뮬레이션도 같은 순서로 검사하므로, 두 구현이 서로 다른 결과
+ * (양쪽 모두 실패한 경우의 상태 코드 포함)를 내면 시뮬레이션이 비행 코드와 어긋난 것이다.
+ *
+ * CFS_ENVIRONMENT 에서는 실제 MM_LoadMemFromFileCmd 를 연결할 자리이다.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "mm_load_harness.h"
+#include "../../common/sim_mem.h"
+#include "../../common/utils.h"
+
+static int32_t MM_Load_RefError(CFE_EVS_EventID_t EventID, int32_t Status, const char *Reason,
+                                const MM_LoadMemFromFileCmd_t *CmdPtr) {
+    MM_AppData.ErrCounter++;
+    CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_ERROR,
+                      "Load from file failed: %s, File=%s, Status=%d",
+                      Reason, CmdPtr->FileName, (int)Status);
+    return Status;
+}
+
+int32_t MM_LoadMemFromFileCmd_Reference(MM_LoadMemFromFileCmd_t *CmdPtr,
+                                        const MM_Load_FileImage_t *File) {
+    if (!CmdPtr) {
+        return OS_INVALID_POINTER;
+    }
+
+    // 파일 이름 (경로 순회, 허용 경로 포함): 같은 이름에 대한 디코더의 검사 결과를 쓴다
+    int32_t status = File ? File->NameStatus : MM_VerifyFileName(CmdPtr->FileName);
+    if (status != CFE_SUCCESS) {
+        return MM_Load_RefError(MM_FILENAME_ERR_EID, CFS_MM_ERROR_INVALID_FILE,
+                                "invalid filename", CmdPtr);
+    }
+
+    // 파일 열기
+    if (!File || !File->Data) {
+        return MM_Load_RefError(MM_FILE_ACCESS_ERR_EID, CFS_MM_ERROR_FILE_ACCESS,
+                                "open failed", CmdPtr);
+    }
+
+    // 로드 파라미터 (MM_VerifyLoadFileSize)
+    if (CmdPtr->MemType != MM_RAM && CmdPtr->MemType != MM_EEPROM) {
+        return MM_Load_RefError(MM_LOAD_FROM_FILE_ERR_EID, CFS_MM_ERROR_INVALID_MEMTYPE,
+                                "invalid memory type", CmdPtr);
+    }
+
+    uint32_t max_size = (CmdPtr->MemType == MM_RAM) ?
+                        MM_DefaultConfig.max_ram_load_size : MM_DefaultConfig.max_eeprom_load_size;
+    if (CmdPtr->NumOfBytes == 0 || CmdPtr->NumOfBytes > max_size) {
+        return MM_Load_RefError(MM_LOAD_FROM_FILE_ERR_EID, CFS_MM_ERROR_INVALID_SIZE,
+                                "invalid load size", CmdPtr);
+    }
+
+    if (File->Size < CmdPtr->NumOfBytes) {
+        return MM_Load_RefError(MM_FILESIZE_ERR_EID, CFS_MM_ERROR_FILE_ACCESS,
+                                "file shorter than load size", CmdPtr);
+    }
+
+    // 파일 데이터 CRC (명령 CRC 가 0 이면 검사 생략)
+    if (CmdPtr->CRC != 0 && MM_DefaultConfig.enable_crc_check) {
+        uint32_t crc = MM_CalculateCRC32(File->Data, CmdPtr->NumOfBytes, 0xFFFFFFFF) ^ 0xFFFFFFFF;
+        if (crc != CmdPtr->CRC) {
+            return MM_Load_RefError(MM_LOAD_FROM_FILE_ERR_EID, CFS_MM_ERROR_CRC_MISMATCH,
+                                    "CRC mismatch", CmdPtr);
+        }
+    }
+
+    // 목적지 심볼 해석
+    uint64_t dest_addr = 0;
+    if (MM_ResolveSymAddr(&CmdPtr->DestSymAddress, &dest_addr) != CFE_SUCCESS) {
+        return MM_Load_RefError(MM_SYMNAME_ERR_EID, CFS_MM_ERROR_INVALID_ADDR,
+                                "symbol lookup failed", CmdPtr);
+    }
+
+    // 메모리 범위와 쓰기 권한 (MM_VerifyLoadDumpParams)
+    status = CFS_ValidateMemoryRegion(dest_addr, CmdPtr->NumOfBytes, CmdPtr->MemType, TRUE);
+    if (status != CFE_SUCCESS) {
+        return MM_Load_RefError(MM_LOAD_FROM_FILE_ERR_EID, status,
+                                "invalid destination range", CmdPtr);
+    }
+
+    if ((dest_addr % CFS_MEMORY_ALIGNMENT) != 0) {
+        return MM_Load_RefError(MM_LOAD_FROM_FILE_ERR_EID, CFS_MM_ERROR_ALIGNMENT,
+                                "destination not aligned", CmdPtr);
+    }
+
+    // 로드 (EEPROM 은 MM_MAX_UNINTERRUPTIBLE_DATA 단위로 분할)
+    uint32_t chunk = (CmdPtr->MemType == MM_EEPROM) ? MM_MAX_UNINTERRUPTIBLE_DATA : CmdPtr->NumOfBytes;
+    for (uint32_t offset = 0; offset < CmdPtr->NumOfBytes; offset += chunk) {
+        uint32_t length = CmdPtr->NumOfBytes - offset;
+        if (length > chunk) {
+            length = chunk;
+        }
+        if (CFS_SimMem_Write(dest_addr + offset, File->Data + offset, length) != CFE_SUCCESS) {
+            return MM_Load_RefError(MM_LOAD_FROM_FILE_ERR_EID, CFS_MM_ERROR_MEMORY_ACCESS,
+                                    "memory write failed", CmdPtr);
+        }
+    }
+
+    MM_AppData.CmdCounter++;
+    MM_AppData.LastAction = MM_LOAD_FROM_FILE;
+    MM_AppData.MemType = CmdPtr->MemType;
+    MM_AppData.Address = (uint32)dest_addr;
+    MM_AppData.BytesProcessed = CmdPtr->NumOfBytes;
+    strncpy(MM_AppData.FileName, CmdPtr->FileName, OS_MAX_PATH_LEN - 1);
+    MM_AppData.FileName[OS_MAX_PATH_LEN - 1] = '\0';
+
+    CFE_EVS_SendEvent(MM_LOAD_FROM_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Load Memory From File Command: Loaded %u bytes to address 0x%08lX from file '%s'",
+                      CmdPtr->NumOfBytes, (unsigned long)dest_addr, CmdPtr->FileName);
+
+    return CFE_SUCCESS;
+}
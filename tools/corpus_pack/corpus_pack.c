@@ -0,0 +1,109 @@
+/*
+ * CFS 코퍼스 팩 도구
+ * 디렉토리 코퍼스와 팩 파일 간 변환, 검증, 목록 출력
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "../../src/common/corpus_pack.h"
+
+static void usage(const char *prog) {
+    printf("Usage: %s <command> [args]\n", prog);
+    printf("Commands:\n");
+    printf("  pack   <corpus_dir> <out.pack>   Pack a libFuzzer/AFL corpus directory\n");
+    printf("  unpack <in.pack> <corpus_dir>    Expand a pack into one file per input\n");
+    printf("  verify <in.pack>                 Check header, index and payload CRCs\n");
+    printf("  list   <in.pack>                 List entries (name, size, crc)\n");
+    printf("  info   <in.pack>                 Show pack summary\n");
+}
+
+static int open_pack(CFS_CorpusPack_t *pack, const char *path) {
+    int32_t status = CFS_CorpusPack_Open(pack, path);
+    if (status != CFE_SUCCESS) {
+        fprintf(stderr, "Failed to open pack %s (status %d)\n", path, status);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    const char *command = argv[1];
+    CFS_CorpusPack_t pack;
+    uint32_t count = 0;
+
+    if (strcmp(command, "pack") == 0 && argc == 4) {
+        int32_t status = CFS_CorpusPack_FromDirectory(argv[2], argv[3], &count);
+        if (status != CFE_SUCCESS) {
+            fprintf(stderr, "Failed to pack %s (status %d)\n", argv[2], status);
+            return 1;
+        }
+        printf("Packed %u inputs into %s\n", count, argv[3]);
+        return 0;
+    }
+
+    if (strcmp(command, "unpack") == 0 && argc == 4) {
+        if (open_pack(&pack, argv[2]) != 0) {
+            return 1;
+        }
+        int32_t status = CFS_CorpusPack_ToDirectory(&pack, argv[3], &count);
+        CFS_CorpusPack_Close(&pack);
+        if (status != CFE_SUCCESS) {
+            fprintf(stderr, "Failed to unpack into %s (status %d)\n", argv[3], status);
+            return 1;
+        }
+        printf("Unpacked %u inputs into %s\n", count, argv[3]);
+        return 0;
+    }
+
+    if (strcmp(command, "verify") == 0) {
+        if (open_pack(&pack, argv[2]) != 0) {
+            return 1;
+        }
+        uint32_t bad = 0;
+        int32_t status = CFS_CorpusPack_Verify(&pack, &bad);
+        if (status != CFE_SUCCESS) {
+            fprintf(stderr, "CRC mismatch at entry %u (%s)\n", bad, CFS_CorpusPack_GetName(&pack, bad));
+        } else {
+            printf("OK: %u entries\n", CFS_CorpusPack_Count(&pack));
+        }
+        CFS_CorpusPack_Close(&pack);
+        return status == CFE_SUCCESS ? 0 : 1;
+    }
+
+    if (strcmp(command, "list") == 0) {
+        if (open_pack(&pack, argv[2]) != 0) {
+            return 1;
+        }
+        for (uint32_t i = 0; i < CFS_CorpusPack_Count(&pack); i++) {
+            printf("%8u  %08X  %s\n", pack.entries[i].size, pack.entries[i].crc,
+                   CFS_CorpusPack_GetName(&pack, i));
+        }
+        CFS_CorpusPack_Close(&pack);
+        return 0;
+    }
+
+    if (strcmp(command, "info") == 0) {
+        if (open_pack(&pack, argv[2]) != 0) {
+            return 1;
+        }
+        uint64_t payload = pack.header->total_size - pack.header->payload_offset;
+        printf("Entries: %u\n", CFS_CorpusPack_Count(&pack));
+        printf("Total Size: %lu bytes\n", pack.header->total_size);
+        printf("Payload Size: %lu bytes\n", payload);
+        printf("Average Input: %.1f bytes\n",
+               CFS_CorpusPack_Count(&pack) ? (double)payload / CFS_CorpusPack_Count(&pack) : 0.0);
+        CFS_CorpusPack_Close(&pack);
+        return 0;
+    }
+
+    usage(argv[0]);
+    return 1;
+}
@@ -0,0 +1,126 @@
+/*
+ * CFS 미션 파일 검사 도구
+ * CFS_MISSION 으로 넘기기 전에 미션 파일을 읽어 표를 출력하고,
+ * selftest 는 로더의 정상/거부 사례를 임시 파일로 확인한다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "../../src/common/mission.h"
+
+static void usage(const char *prog) {
+    printf("Usage: %s <command> [args]\n", prog);
+    printf("Commands:\n");
+    printf("  check <file.mission>   Load a mission file and print its tables\n");
+    printf("  selftest               Run mission loader test cases\n");
+}
+
+// 로더 사례: 파일 내용, 기대 상태, 거부면 오류 메시지에 있어야 할 "<경로>:<줄>:" 의 줄 번호
+typedef struct {
+    const char *name;
+    const char *text;
+    int32_t     status;
+    uint32_t    error_line;
+} MissionCase_t;
+
+#define MISSION_CASE_HEADER \
+    "mission selftest\n" \
+    "symbol MM_AppData\n" \
+    "path /cf/\n"
+
+static const MissionCase_t g_cases[] = {
+    { "aligned regions",
+      MISSION_CASE_HEADER
+      "region SRAM   0x20000000 0x2007FFFF ram rw x\n"
+      "region EEPROM 0x08080000 0x080FFFFF eeprom rw\n",
+      CFE_SUCCESS, 0 },
+    { "end + 1 not page aligned",
+      MISSION_CASE_HEADER
+      "region SRAM   0x20080000 0x2008FFFF ram rw\n"
+      "region TINY   0x20000000 0x200000FF ram rw\n",
+      CFS_MM_ERROR_INVALID_FILE, 5 },
+    { "start not page aligned",
+      MISSION_CASE_HEADER
+      "region TINY   0x20000100 0x20000FFF ram rw\n",
+      CFS_MM_ERROR_INVALID_FILE, 4 },
+    { "overlapping regions",
+      MISSION_CASE_HEADER
+      "region A      0x20000000 0x20001FFF ram rw\n"
+      "region B      0x20001000 0x20002FFF ram rw\n",
+      CFS_MM_ERROR_INVALID_FILE, 0 },
+};
+
+// 사례 하나 실행 (stderr 를 임시 파일로 받아 줄 번호 확인)
+static int run_case(const MissionCase_t *c) {
+    char path[] = "/tmp/cfs_mission_XXXXXX";
+    char err_path[] = "/tmp/cfs_mission_err_XXXXXX";
+    int fd = mkstemp(path);
+    int err_fd = mkstemp(err_path);
+    if (fd < 0 || err_fd < 0) {
+        fprintf(stderr, "Cannot create temporary files\n");
+        return 1;
+    }
+    size_t length = strlen(c->text);
+    boolean written = (write(fd, c->text, length) == (ssize_t)length);
+    close(fd);
+
+    fflush(stderr);
+    int saved_stderr = dup(STDERR_FILENO);
+    dup2(err_fd, STDERR_FILENO);
+    int32_t status = written ? CFS_Mission_Load(path) : CFS_MM_ERROR_FILE_ACCESS;
+    fflush(stderr);
+    dup2(saved_stderr, STDERR_FILENO);
+    close(saved_stderr);
+
+    char message[512] = "";
+    ssize_t got = pread(err_fd, message, sizeof(message) - 1, 0);
+    message[got > 0 ? got : 0] = '\0';
+    close(err_fd);
+
+    int failed = (status != c->status);
+    if (!failed && c->error_line) {
+        char expected[64];
+        snprintf(expected, sizeof(expected), "%s:%u:", path, c->error_line);
+        failed = (strstr(message, expected) == NULL);
+    }
+    unlink(path);
+    unlink(err_path);
+
+    printf("%-6s %s (status %d)\n", failed ? "FAIL" : "ok", c->name, status);
+    if (failed && message[0]) {
+        printf("       %s", message);
+    }
+    return failed;
+}
+
+static int selftest(void) {
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++) {
+        failures += run_case(&g_cases[i]);
+    }
+    printf("%d failure(s)\n", failures);
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "selftest") == 0) {
+        return selftest();
+    }
+
+    if (argc == 3 && strcmp(argv[1], "check") == 0) {
+        if (CFS_Mission_Load(argv[2]) != CFE_SUCCESS) {
+            return 1;
+        }
+        CFS_Mission_Print();
+        return 0;
+    }
+
+    usage(argv[0]);
+    return 1;
+}
@@ -0,0 +1,1007 @@
+/*
+ * CFS MM 엔진 벤치마크 도구
+ * 시뮬레이션 엔진의 처리량을 기준 구현(memset/바이트 루프 등)과 비교
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include "../../src/common/arena.h"
+#include "../../src/common/dump.h"
+#include "../../src/common/fill.h"
+#include "../../src/common/hexdump.h"
+#include "../../src/common/input.h"
+#include "../../src/common/mission.h"
+#include "../../src/common/mm_types.h"
+#include "../../src/common/rng.h"
+#include "../../src/common/sim_mem.h"
+#include "../../src/common/utils.h"
+#include "../../src/common/vfs.h"
+
+// 측정당 최소 처리 바이트 (작은 크기도 충분히 반복)
+#define BENCH_TARGET_BYTES  (256u * 1024 * 1024)
+
+// 시뮬레이션 메모리 벤치마크 주소 (SDRAM_EXTERNAL, 정렬되지 않은 시작점)
+#define BENCH_SIM_ADDR      0x60000001ULL
+
+#define CFS_BENCH_XSTR(x)   #x
+#define CFS_BENCH_STR(x)    CFS_BENCH_XSTR(x)
+
+static volatile uint8_t g_sink;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static uint32_t bench_iterations(size_t size) {
+    size_t n = BENCH_TARGET_BYTES / size;
+    return (uint32_t)(n < 16 ? 16 : n);
+}
+
+static double gbps(size_t size, uint32_t iterations, double seconds) {
+    return seconds > 0 ? ((double)size * iterations) / seconds / 1e9 : 0.0;
+}
+
+// 비교 기준: 바이트 루프 (기존 시뮬레이션 방식)
+static void fill_byte_loop(uint8_t *dst, size_t size, uint32_t pattern) {
+    const uint8_t *bytes = (const uint8_t *)&pattern;
+    for (size_t i = 0; i < size; i++) {
+        dst[i] = bytes[i & 3];
+    }
+}
+
+// 엔진 결과를 바이트 루프와 비교 (크기/시작 정렬/위상 조합)
+static int fill_verify(void) {
+    uint8_t *buf = malloc(4096 + 64);
+    uint8_t *ref = malloc(4096 + 64);
+    uint32_t pattern = 0x44332211u;
+    int failures = 0;
+
+    if (!buf || !ref) {
+        free(buf);
+        free(ref);
+        return 1;
+    }
+
+    for (size_t align = 0; align < 16; align++) {
+        for (size_t size = 0; size < 300; size += (size < 70) ? 1 : 37) {
+            for (uint32_t phase = 0; phase < 4; phase++) {
+                memset(buf, 0xEE, 4096 + 64);
+                memset(ref, 0xEE, 4096 + 64);
+                CFS_Fill_Pattern32(buf + align, size, pattern, phase);
+                for (size_t i = 0; i < size; i++) {
+                    ref[align + i] = ((const uint8_t *)&pattern)[(phase + i) & 3];
+                }
+                if (memcmp(buf, ref, 4096 + 64) != 0) {
+                    failures++;
+                }
+            }
+        }
+    }
+
+    free(buf);
+    free(ref);
+    printf("Verify: %s (%d mismatches)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
+
+static int bench_fill(void) {
+    static const size_t sizes[] = { 64, 200, 4096, 65536, 1024 * 1024 };
+    uint8_t *buf = malloc(1024 * 1024 + 64);
+
+    if (!buf) {
+        return 1;
+    }
+    memset(buf, 0, 1024 * 1024 + 64);
+
+    if (fill_verify() != 0) {
+        free(buf);
+        return 1;
+    }
+
+    printf("\n%-10s %-6s %12s %12s %12s\n", "Size", "Align", "memset", "byte loop", "engine");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (size_t align = 0; align < 4; align += 3) {
+            size_t size = sizes[s];
+            uint8_t *dst = buf + align;
+            uint32_t iterations = bench_iterations(size);
+            double t0, t_memset, t_loop, t_engine;
+
+            t0 = now_sec();
+            for (uint32_t i = 0; i < iterations; i++) {
+                memset(dst, (int)(i & 0xFF), size);
+                g_sink = dst[size - 1];
+            }
+            t_memset = now_sec() - t0;
+
+            // 바이트 루프는 느리므로 반복 수를 줄여 측정
+            uint32_t loop_iterations = iterations / 8 + 1;
+            t0 = now_sec();
+            for (uint32_t i = 0; i < loop_iterations; i++) {
+                fill_byte_loop(dst, size, 0xA5A55A5Au + i);
+                g_sink = dst[size - 1];
+            }
+            t_loop = now_sec() - t0;
+
+            t0 = now_sec();
+            for (uint32_t i = 0; i < iterations; i++) {
+                CFS_Fill_Pattern32(dst, size, 0xA5A55A5Au + i, 0);
+                g_sink = dst[size - 1];
+            }
+            t_engine = now_sec() - t0;
+
+            printf("%-10zu %-6zu %9.2f GB/s %7.2f GB/s %7.2f GB/s\n", size, align,
+                   gbps(size, iterations, t_memset),
+                   gbps(size, loop_iterations, t_loop),
+                   gbps(size, iterations, t_engine));
+        }
+    }
+
+    // 시뮬레이션 메모리 경유 (저널 off), 중단 불가 구간 분할 비용
+    printf("\n%-10s %16s %16s\n", "SimMem", "segment=whole", "segment=" CFS_BENCH_STR(MM_MAX_UNINTERRUPTIBLE_DATA));
+    for (size_t s = 2; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        uint32_t iterations = bench_iterations(size);
+        double t0, t_whole, t_segmented;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            CFS_SimMem_Fill(BENCH_SIM_ADDR, (uint32_t)size, 0x11223344u + i, 0);
+        }
+        t_whole = now_sec() - t0;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            CFS_SimMem_Fill(BENCH_SIM_ADDR, (uint32_t)size, 0x11223344u + i,
+                            MM_MAX_UNINTERRUPTIBLE_DATA);
+        }
+        t_segmented = now_sec() - t0;
+
+        printf("%-10zu %11.2f GB/s %11.2f GB/s\n", size,
+               gbps(size, iterations, t_whole), gbps(size, iterations, t_segmented));
+    }
+
+    CFS_SimMem_Release();
+    free(buf);
+    return 0;
+}
+
+// 비교 기준: 바이트 테이블 CRC32 (기존 MM_CalculateCRC32 방식)
+static uint32_t g_crc_bytewise_table[256];
+
+static void crc_bytewise_init(void) {
+    for (uint32_t b = 0; b < 256; b++) {
+        uint32_t c = b;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        g_crc_bytewise_table[b] = c;
+    }
+}
+
+static uint32_t crc_bytewise(const uint8_t *data, size_t size, uint32_t crc) {
+    for (size_t i = 0; i < size; i++) {
+        crc = g_crc_bytewise_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+// CRC 결과 (길이/정렬/분할) 와 스트리밍 로드 결과를 기준과 비교
+static int load_verify(const uint8_t *src) {
+    int failures = 0;
+
+    for (size_t align = 0; align < 8; align++) {
+        for (size_t size = 0; size < 300; size += (size < 40) ? 1 : 23) {
+            uint32_t expected = crc_bytewise(src + align, size, 0xFFFFFFFF);
+            if (MM_CalculateCRC32(src + align, size, 0xFFFFFFFF) != expected) {
+                failures++;
+            }
+            // 임의 지점에서 나눠 누적해도 같은 값
+            size_t split = size / 3;
+            uint32_t crc = MM_CalculateCRC32(src + align, split, 0xFFFFFFFF);
+            if (MM_CalculateCRC32(src + align + split, size - split, crc) != expected) {
+                failures++;
+            }
+        }
+    }
+
+    const uint32_t size = 100000;
+    const uint32_t expected = crc_bytewise(src, size, 0xFFFFFFFF) ^ 0xFFFFFFFF;
+    uint8_t *readback = malloc(size);
+    if (!readback) {
+        return 1;
+    }
+    for (int mode = CFS_SIMMEM_LOAD_STREAM; mode <= CFS_SIMMEM_LOAD_VERIFY_FIRST; mode++) {
+        uint32_t crc = 0;
+        CFS_SimMem_Release();
+        if (CFS_SimMem_LoadStream(BENCH_SIM_ADDR, src, size, MM_MAX_UNINTERRUPTIBLE_DATA,
+                                  (CFS_SimMemLoadMode_t)mode, expected, &crc) != CFE_SUCCESS ||
+            crc != expected ||
+            CFS_SimMem_Read(BENCH_SIM_ADDR, readback, size) != CFE_SUCCESS ||
+            memcmp(readback, src, size) != 0) {
+            failures++;
+        }
+        // 불일치: 먼저 확인하는 방식은 타겟을 바꾸지 않아야 함
+        CFS_SimMem_Release();
+        if (CFS_SimMem_LoadStream(BENCH_SIM_ADDR, src, size, MM_MAX_UNINTERRUPTIBLE_DATA,
+                                  (CFS_SimMemLoadMode_t)mode, expected ^ 1, &crc) !=
+            CFS_MM_ERROR_CRC_MISMATCH) {
+            failures++;
+        }
+        if (mode == CFS_SIMMEM_LOAD_VERIFY_FIRST) {
+            CFS_SimMem_Read(BENCH_SIM_ADDR, readback, size);
+            for (uint32_t i = 0; i < size; i++) {
+                if (readback[i] != 0) {
+                    failures++;
+                    break;
+                }
+            }
+        }
+    }
+    CFS_SimMem_Release();
+    free(readback);
+
+    printf("Verify: %s (%d mismatches)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
+
+static int bench_load(void) {
+    static const size_t sizes[] = { 4096, 65536, 1024 * 1024 };
+    const size_t max_size = MM_MAX_LOAD_FILE_DATA_RAM;
+    uint8_t *src = malloc(max_size);
+    uint8_t *staging = malloc(max_size);
+
+    if (!src || !staging) {
+        free(src);
+        free(staging);
+        return 1;
+    }
+    for (size_t i = 0; i < max_size; i++) {
+        src[i] = (uint8_t)(i * 131u + (i >> 9));
+    }
+    crc_bytewise_init();
+
+    if (load_verify(src) != 0) {
+        free(src);
+        free(staging);
+        return 1;
+    }
+
+    // CRC 단독 처리량
+    printf("\n%-10s %14s %14s\n", "CRC32", "byte table", "slice-by-8");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        uint32_t iterations = bench_iterations(size) / 4 + 1;
+        uint32_t crc = 0;
+        double t0, t_byte, t_slice;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            crc ^= crc_bytewise(src, size, 0xFFFFFFFF);
+        }
+        t_byte = now_sec() - t0;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            crc ^= MM_CalculateCRC32(src, size, 0xFFFFFFFF);
+        }
+        t_slice = now_sec() - t0;
+
+        g_sink = (uint8_t)crc;
+        printf("%-10zu %9.2f GB/s %9.2f GB/s\n", size,
+               gbps(size, iterations, t_byte), gbps(size, iterations, t_slice));
+    }
+
+    /*
+     * 로드 경로 (CRC 일치, 시뮬레이션 메모리 대상)
+     *   3-pass       - 파일 버퍼로 읽기, 전체 CRC, 전체 복사
+     *   verify-first - 전체 CRC 후 구간 단위 복사 (불일치 시 타겟 불변)
+     *   stream       - 구간마다 CRC 누적 + 복사 (단일 패스)
+     */
+    printf("\n%-10s %14s %14s %14s\n", "Load", "3-pass", "verify-first", "stream");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        uint32_t iterations = bench_iterations(size) / 4 + 1;
+        uint32_t crc = MM_CalculateCRC32(src, size, 0xFFFFFFFF) ^ 0xFFFFFFFF;
+        double t0, t_three, t_verify, t_stream;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            memcpy(staging, src, size);
+            if ((MM_CalculateCRC32(staging, size, 0xFFFFFFFF) ^ 0xFFFFFFFF) == crc) {
+                CFS_SimMem_Write(BENCH_SIM_ADDR, staging, (uint32_t)size);
+            }
+        }
+        t_three = now_sec() - t0;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            CFS_SimMem_LoadStream(BENCH_SIM_ADDR, src, (uint32_t)size, MM_MAX_UNINTERRUPTIBLE_DATA,
+                                  CFS_SIMMEM_LOAD_VERIFY_FIRST, crc, NULL);
+        }
+        t_verify = now_sec() - t0;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            CFS_SimMem_LoadStream(BENCH_SIM_ADDR, src, (uint32_t)size, MM_MAX_UNINTERRUPTIBLE_DATA,
+                                  CFS_SIMMEM_LOAD_STREAM, crc, NULL);
+        }
+        t_stream = now_sec() - t0;
+
+        printf("%-10zu %9.2f GB/s %9.2f GB/s %9.2f GB/s\n", size,
+               gbps(size, iterations, t_three), gbps(size, iterations, t_verify),
+               gbps(size, iterations, t_stream));
+    }
+
+    CFS_SimMem_Release();
+    free(src);
+    free(staging);
+    return 0;
+}
+
+// tmpfs 출력 파일 (없으면 호스트 출력 측정 생략)
+#define BENCH_DUMP_HOST_PATH    "/dev/shm/cfs_mm_bench_dump.bin"
+
+static int bench_dump(void) {
+    static const size_t sizes[] = { 4096, 65536, 1024 * 1024 };
+    const size_t max_size = MM_MAX_DUMP_FILE_DATA_RAM;
+    const size_t header_size = sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t);
+    uint8_t *staging = malloc(header_size + max_size);
+    MM_SymAddr_t sym;
+    CFS_DumpFile_t dump;
+
+    if (!staging) {
+        return 1;
+    }
+    memset(&sym, 0, sizeof(sym));
+    sym.Offset = BENCH_SIM_ADDR;
+    for (size_t i = 0; i < max_size; i++) {
+        staging[i] = (uint8_t)(i * 131u + (i >> 9));
+    }
+    CFS_SimMem_Write(BENCH_SIM_ADDR, staging, (uint32_t)max_size);
+
+    // 두 출력 경로의 파일 내용이 같고 CRC 가 데이터와 맞는지 확인
+    int failures = 0;
+    uint32_t expected = MM_CalculateCRC32(staging, max_size, 0xFFFFFFFF) ^ 0xFFFFFFFF;
+    const uint8_t *file = NULL;
+    uint32_t file_size = 0;
+    boolean host = FALSE;
+    if (CFS_Dump_Prepare(&dump, &sym, BENCH_SIM_ADDR, MM_RAM, (uint32_t)max_size) != CFE_SUCCESS ||
+        CFS_Dump_WriteVfs(&dump, "/ram/bench.bin") != CFE_SUCCESS ||
+        dump.MmHeader.Crc != expected ||
+        CFS_Vfs_ReadFile("/ram/bench.bin", &file, &file_size) != CFE_SUCCESS ||
+        file_size != header_size + max_size) {
+        failures++;
+    } else if (CFS_Dump_Prepare(&dump, &sym, BENCH_SIM_ADDR, MM_RAM, (uint32_t)max_size) == CFE_SUCCESS &&
+               CFS_Dump_WriteHost(&dump, BENCH_DUMP_HOST_PATH) == CFE_SUCCESS) {
+        FILE *fp = fopen(BENCH_DUMP_HOST_PATH, "rb");
+        host = TRUE;
+        if (!fp || fread(staging, 1, header_size + max_size, fp) != header_size + max_size ||
+            memcmp(staging, file, file_size) != 0) {
+            failures++;
+        }
+        if (fp) {
+            fclose(fp);
+        }
+    }
+    printf("Verify: %s (%d mismatches%s)\n", failures == 0 ? "PASS" : "FAIL", failures,
+           host ? "" : ", tmpfs output unavailable");
+    if (failures > 0) {
+        free(staging);
+        return 1;
+    }
+
+    /*
+     * 덤프 경로
+     *   buffered - 영역을 중간 버퍼로 복사, CRC 패스, 헤더와 함께 VFS 로 복사
+     *   vfs      - iovec 에서 VFS 블록으로 바로 모으며 구간마다 CRC 누적
+     *   tmpfs    - writev 로 헤더 + 구간 출력, 끝에 pwrite 로 CRC 기록
+     */
+    printf("\n%-10s %14s %14s %14s\n", "Dump", "buffered", "vfs", "tmpfs");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        uint32_t iterations = bench_iterations(size) / 4 + 1;
+        double t0, t_buffered, t_vfs, t_host = 0;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            CFS_SimMem_Read(BENCH_SIM_ADDR, staging + header_size, (uint32_t)size);
+            CFS_Dump_Prepare(&dump, &sym, BENCH_SIM_ADDR, MM_RAM, (uint32_t)size);
+            dump.MmHeader.Crc = MM_CalculateCRC32(staging + header_size, size, 0xFFFFFFFF) ^ 0xFFFFFFFF;
+            memcpy(staging, &dump.FsHeader, sizeof(dump.FsHeader));
+            memcpy(staging + sizeof(dump.FsHeader), &dump.MmHeader, sizeof(dump.MmHeader));
+            CFS_Vfs_WriteFile("/ram/bench.bin", staging, (uint32_t)(header_size + size));
+        }
+        t_buffered = now_sec() - t0;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            CFS_Dump_Prepare(&dump, &sym, BENCH_SIM_ADDR, MM_RAM, (uint32_t)size);
+            CFS_Dump_WriteVfs(&dump, "/ram/bench.bin");
+        }
+        t_vfs = now_sec() - t0;
+
+        if (host) {
+            t0 = now_sec();
+            for (uint32_t i = 0; i < iterations; i++) {
+                CFS_Dump_Prepare(&dump, &sym, BENCH_SIM_ADDR, MM_RAM, (uint32_t)size);
+                CFS_Dump_WriteHost(&dump, BENCH_DUMP_HOST_PATH);
+            }
+            t_host = now_sec() - t0;
+        }
+
+        printf("%-10zu %9.2f GB/s %9.2f GB/s %9.2f GB/s\n", size,
+               gbps(size, iterations, t_buffered), gbps(size, iterations, t_vfs),
+               gbps(size, iterations, t_host));
+    }
+
+    if (host) {
+        unlink(BENCH_DUMP_HOST_PATH);
+    }
+    CFS_Vfs_Clear();
+    CFS_SimMem_Release();
+    free(staging);
+    return 0;
+}
+
+/*
+ * 입력 디코드 (MM_LoadMemFromFileCmd 필드 영역 20 바이트)
+ *   modulo - 선택값 % 개수, Range32 의 %, strncpy 와 snprintf 로 이름 조립
+ *   tables - 선택기 표, 상수 제수, 미리 조립한 이름 레코드 memcpy
+ */
+#define BENCH_DECODE_INPUTS     4096
+#define BENCH_DECODE_FIELDS     20
+#define BENCH_DECODE_ROUNDS     2000
+
+static void decode_modulo(CFS_Input_t *in, const CFS_Mission_t *m, MM_LoadMemFromFileCmd_t *pkt) {
+    static const uint8_t mem_types[] = { MM_RAM, MM_EEPROM };
+    uint8_t mem_type = CFS_INPUT_PICK(in, mem_types);
+    uint32_t max_bytes = (mem_type == MM_RAM) ? MM_MAX_LOAD_FILE_DATA_RAM : MM_MAX_LOAD_FILE_DATA_EEPROM;
+
+    pkt->MemType = mem_type;
+    pkt->NumOfBytes = CFS_Input_Range32(in, 1, max_bytes);
+    pkt->CRC = CFS_Input_U32(in);
+    boolean use_symbol = !CFS_Input_Bool(in);
+    const char *symbol = m->symbols[CFS_Input_Index(in, m->symbol_count)];
+    uint64_t direct = CFS_Input_U64(in);
+    const char *path = m->paths[CFS_Input_Index(in, m->path_count)];
+    if (use_symbol) {
+        strncpy(pkt->DestSymAddress.SymName, symbol, OS_MAX_API_NAME - 1);
+    } else {
+        pkt->DestSymAddress.Offset = direct & 0x7FFFFFFF;
+    }
+    snprintf(pkt->FileName, OS_MAX_PATH_LEN, "%stestfile.bin", path);
+}
+
+static void decode_tables(CFS_Input_t *in, const CFS_NameTable_t *symbols, const CFS_NameTable_t *files,
+                          MM_LoadMemFromFileCmd_t *pkt) {
+    static const uint8_t mem_types[] = { MM_RAM, MM_EEPROM };
+    static const CFS_Divisor_t max_bytes[] = {
+        CFS_DIVISOR(MM_MAX_LOAD_FILE_DATA_RAM), CFS_DIVISOR(MM_MAX_LOAD_FILE_DATA_EEPROM)
+    };
+    size_t mem_index = CFS_Input_U8(in) & 1;
+
+    pkt->MemType = mem_types[mem_index];
+    pkt->NumOfBytes = CFS_Input_RangeDiv(in, 1, &max_bytes[mem_index]);
+    pkt->CRC = CFS_Input_U32(in);
+    boolean use_symbol = !CFS_Input_Bool(in);
+    const char *symbol = CFS_NameTable_Get(symbols, CFS_Input_Select(in, &symbols->select));
+    uint64_t direct = CFS_Input_U64(in);
+    const char *file_name = CFS_NameTable_Get(files, CFS_Input_Select(in, &files->select));
+    if (use_symbol) {
+        memcpy(pkt->DestSymAddress.SymName, symbol, OS_MAX_API_NAME);
+    } else {
+        pkt->DestSymAddress.Offset = direct & 0x7FFFFFFF;
+    }
+    memcpy(pkt->FileName, file_name, OS_MAX_PATH_LEN);
+}
+
+// 제수/선택기가 % 와 같은 값을 내는지 (경계값 + 의사 난수)
+static int divisor_verify(void) {
+    static const uint32_t divisors[] = { 1, 2, 3, 5, 7, 24, 255, 256, 257, 1000, 65535,
+                                         128 * 1024, 1024 * 1024, 0x7FFFFFFFu, 0xFFFFFFFFu };
+    static const uint32_t edges[] = { 0, 1, 2, 255, 256, 65535, 65536, 0x7FFFFFFFu, 0x80000000u,
+                                      0xFFFFFFFEu, 0xFFFFFFFFu };
+    uint32_t x = 0x12345678u;
+    int failures = 0;
+
+    for (size_t d = 0; d < sizeof(divisors) / sizeof(divisors[0]); d++) {
+        CFS_Divisor_t div;
+        CFS_Divisor_Init(&div, divisors[d]);
+        for (size_t e = 0; e < sizeof(edges) / sizeof(edges[0]); e++) {
+            failures += CFS_Divisor_Mod(&div, edges[e]) != edges[e] % divisors[d];
+        }
+        for (uint32_t i = 0; i < 100000; i++) {
+            x = x * 1664525u + 1013904223u;
+            failures += CFS_Divisor_Mod(&div, x) != x % divisors[d];
+        }
+    }
+
+    for (uint32_t count = 0; count < 600; count += (count < 300) ? 1 : 37) {
+        CFS_Selector_t sel;
+        CFS_Selector_Init(&sel, count);
+        for (uint32_t v = 0; v < 65536; v += (count <= 256) ? 1 : 7) {
+            uint8_t raw[2] = { (uint8_t)v, (uint8_t)(v >> 8) };
+            CFS_Input_t a, b;
+            CFS_Input_Init(&a, raw, sizeof(raw));
+            CFS_Input_Init(&b, raw, sizeof(raw));
+            failures += CFS_Input_Select(&a, &sel) != CFS_Input_Index(&b, count);
+            if (count <= 256 && v >= 256) {
+                break;
+            }
+        }
+    }
+    return failures;
+}
+
+static int bench_decode(void) {
+    const CFS_Mission_t *mission = CFS_Mission_Get();
+    uint8_t *inputs = malloc(BENCH_DECODE_INPUTS * BENCH_DECODE_FIELDS);
+    CFS_NameTable_t symbols, files;
+    MM_LoadMemFromFileCmd_t a, b;
+    uint32_t x = 0x9E3779B9u;
+    int failures;
+
+    if (!inputs ||
+        CFS_NameTable_Build(&symbols, mission->symbols, mission->symbol_count, "", OS_MAX_API_NAME) != CFE_SUCCESS ||
+        CFS_NameTable_Build(&files, mission->paths, mission->path_count, "testfile.bin", OS_MAX_PATH_LEN) != CFE_SUCCESS) {
+        free(inputs);
+        return 1;
+    }
+    for (size_t i = 0; i < BENCH_DECODE_INPUTS * BENCH_DECODE_FIELDS; i++) {
+        x = x * 1664525u + 1013904223u;
+        inputs[i] = (uint8_t)(x >> 24);
+    }
+
+    // 두 디코드의 패킷 바이트가 같은지
+    failures = divisor_verify();
+    for (size_t i = 0; i < BENCH_DECODE_INPUTS; i++) {
+        CFS_Input_t in;
+        memset(&a, 0, sizeof(a));
+        memset(&b, 0, sizeof(b));
+        CFS_Input_Init(&in, inputs + i * BENCH_DECODE_FIELDS, BENCH_DECODE_FIELDS);
+        decode_modulo(&in, mission, &a);
+        CFS_Input_Init(&in, inputs + i * BENCH_DECODE_FIELDS, BENCH_DECODE_FIELDS);
+        decode_tables(&in, &symbols, &files, &b);
+        failures += memcmp(&a, &b, sizeof(a)) != 0;
+    }
+    printf("Verify: %s (%d mismatches)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    if (failures > 0) {
+        CFS_NameTable_Free(&symbols);
+        CFS_NameTable_Free(&files);
+        free(inputs);
+        return 1;
+    }
+
+    const double execs = (double)BENCH_DECODE_INPUTS * BENCH_DECODE_ROUNDS;
+    double t0, t_modulo, t_tables;
+
+    t0 = now_sec();
+    for (uint32_t r = 0; r < BENCH_DECODE_ROUNDS; r++) {
+        for (size_t i = 0; i < BENCH_DECODE_INPUTS; i++) {
+            CFS_Input_t in;
+            memset(&a, 0, sizeof(a));
+            CFS_Input_Init(&in, inputs + i * BENCH_DECODE_FIELDS, BENCH_DECODE_FIELDS);
+            decode_modulo(&in, mission, &a);
+            g_sink = (uint8_t)a.FileName[1];
+        }
+    }
+    t_modulo = now_sec() - t0;
+
+    t0 = now_sec();
+    for (uint32_t r = 0; r < BENCH_DECODE_ROUNDS; r++) {
+        for (size_t i = 0; i < BENCH_DECODE_INPUTS; i++) {
+            CFS_Input_t in;
+            memset(&b, 0, sizeof(b));
+            CFS_Input_Init(&in, inputs + i * BENCH_DECODE_FIELDS, BENCH_DECODE_FIELDS);
+            decode_tables(&in, &symbols, &files, &b);
+            g_sink = (uint8_t)b.FileName[1];
+        }
+    }
+    t_tables = now_sec() - t0;
+
+    printf("\n%-10s %14s %14s\n", "Decode", "modulo", "tables");
+    printf("%-10s %11.1f ns %11.1f ns\n", "per exec", t_modulo * 1e9 / execs, t_tables * 1e9 / execs);
+
+    CFS_NameTable_Free(&symbols);
+    CFS_NameTable_Free(&files);
+    free(inputs);
+    return 0;
+}
+
+// 알려진 값: 시드 0 의 첫 네 값, 시드 12345 의 첫 13 바이트 (꼬리 바이트 순서 확인)
+static int rng_verify(void) {
+    static const uint64_t seed0[4] = {
+        0x99EC5F36CB75F2B4ULL, 0xBF6E1F784956452AULL, 0x1A5F849D4933E6E0ULL, 0x6AA594F1262D2D2CULL
+    };
+    static const uint8_t seed12345[13] = {
+        0x9B, 0xD4, 0x60, 0x41, 0x37, 0x36, 0x6A, 0xBE, 0xC6, 0x88, 0xA6, 0x37, 0x06
+    };
+    uint8_t bytes[sizeof(seed12345) + 1];
+    CFS_Rng_t rng;
+    int failures = 0;
+
+    CFS_Rng_Seed(&rng, 0);
+    for (size_t i = 0; i < 4; i++) {
+        failures += CFS_Rng_Next(&rng) != seed0[i];
+    }
+    memset(bytes, 0xEE, sizeof(bytes));
+    CFS_GenerateRandomData(bytes, sizeof(seed12345), 12345);
+    failures += memcmp(bytes, seed12345, sizeof(seed12345)) != 0 || bytes[sizeof(seed12345)] != 0xEE;
+    return failures;
+}
+
+static int bench_rng(void) {
+    static const size_t sizes[] = { 16, 200, 4096, 65536 };
+    uint8_t *buf = malloc(65536);
+    int failures = rng_verify();
+
+    printf("Verify: %s (%d mismatches)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    if (!buf || failures > 0) {
+        free(buf);
+        return 1;
+    }
+
+    printf("\n%-10s %12s %12s %12s\n", "Size", "rand()", "Next/byte", "Fill");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        uint32_t iterations = bench_iterations(size) / 4 + 1;
+        double t0, t_rand, t_next, t_fill;
+        CFS_Rng_t rng;
+
+        // 기존 방식 (srand + 바이트마다 rand), 느리므로 반복 수를 줄여 측정
+        uint32_t rand_iterations = iterations / 16 + 1;
+        t0 = now_sec();
+        for (uint32_t i = 0; i < rand_iterations; i++) {
+            srand(i);
+            for (size_t k = 0; k < size; k++) {
+                buf[k] = (uint8_t)(rand() & 0xFF);
+            }
+            g_sink = buf[size - 1];
+        }
+        t_rand = now_sec() - t0;
+
+        CFS_Rng_Seed(&rng, 1);
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            for (size_t k = 0; k < size; k++) {
+                buf[k] = (uint8_t)CFS_Rng_Next(&rng);
+            }
+            g_sink = buf[size - 1];
+        }
+        t_next = now_sec() - t0;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            CFS_GenerateRandomData(buf, size, i);
+            g_sink = buf[size - 1];
+        }
+        t_fill = now_sec() - t0;
+
+        printf("%-10zu %7.3f GB/s %7.3f GB/s %7.3f GB/s\n", size,
+               gbps(size, rand_iterations, t_rand),
+               gbps(size, iterations, t_next),
+               gbps(size, iterations, t_fill));
+    }
+
+    free(buf);
+    return 0;
+}
+
+// 비교 기준: 바이트마다 fprintf 하던 CFS_HexDump (주소는 %04zX)
+static void hexdump_printf(FILE *out, const uint8_t *bytes, size_t length, const char *prefix) {
+    for (size_t i = 0; i < length; i += 16) {
+        fprintf(out, "%s%04zX: ", prefix ? prefix : "", i);
+        for (size_t j = 0; j < 16; j++) {
+            if (i + j < length) {
+                fprintf(out, "%02X ", bytes[i + j]);
+            } else {
+                fprintf(out, "   ");
+            }
+        }
+        fprintf(out, " ");
+        for (size_t j = 0; j < 16 && i + j < length; j++) {
+            uint8_t c = bytes[i + j];
+            fprintf(out, "%c", (c >= 32 && c <= 126) ? c : '.');
+        }
+        fprintf(out, "\n");
+    }
+}
+
+// fp 에 쓴 내용을 처음부터 읽어 out 에 (NUL 종료), 읽은 길이 반환
+static size_t read_back(FILE *fp, char *out, size_t capacity) {
+    fflush(fp);
+    rewind(fp);
+    size_t n = fread(out, 1, capacity - 1, fp);
+    out[n] = '\0';
+    rewind(fp);
+    if (ftruncate(fileno(fp), 0) != 0) {
+        return 0;
+    }
+    return n;
+}
+
+// 포매터 출력이 기존 형식과 같은지, 생략/비교 줄 수가 맞는지
+static int hexdump_verify(const uint8_t *bytes) {
+    static const char *const prefixes[] = { NULL, "  ", "[crash] " };
+    static char expected[64 * 1024], actual[64 * 1024];
+    FILE *fp = tmpfile();
+    int failures = 0;
+
+    if (!fp) {
+        return 1;
+    }
+    for (size_t p = 0; p < sizeof(prefixes) / sizeof(prefixes[0]); p++) {
+        for (size_t length = 1; length < 300; length += (length < 40) ? 1 : 29) {
+            const CFS_HexDumpOptions_t opts = { prefixes[p], 0, NULL, 0 };
+            hexdump_printf(fp, bytes, length, prefixes[p]);
+            size_t n = read_back(fp, expected, sizeof(expected));
+            failures += CFS_HexDump_Write(fileno(fp), bytes, length, &opts) != CFE_SUCCESS;
+            failures += read_back(fp, actual, sizeof(actual)) != n || strcmp(expected, actual) != 0;
+        }
+    }
+
+    // 0 으로 채운 4KB: 첫 줄 + "*" / 한 바이트 다른 비교: "*", "-", "+", "*"
+    uint8_t *zeros = calloc(1, 4096);
+    uint8_t *changed = calloc(1, 4096);
+    if (zeros && changed) {
+        const CFS_HexDumpOptions_t elide = { NULL, 0x60000000ULL, NULL, CFS_HEXDUMP_ELIDE };
+        const CFS_HexDumpOptions_t diff = { NULL, 0x60000000ULL, zeros, CFS_HEXDUMP_ELIDE };
+        changed[1000] = 0x5A;
+        (void)CFS_HexDump_Write(fileno(fp), zeros, 4096, &elide);
+        (void)read_back(fp, actual, sizeof(actual));
+        failures += strcmp(actual, "60000000: 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00  ................\n*\n") != 0;
+        (void)CFS_HexDump_Write(fileno(fp), changed, 4096, &diff);
+        (void)read_back(fp, actual, sizeof(actual));
+        failures += strcmp(actual, " *\n"
+                                   "-600003E0: 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00  ................\n"
+                                   "+600003E0: 00 00 00 00 00 00 00 00 5A 00 00 00 00 00 00 00  ........Z.......\n"
+                                   " *\n") != 0;
+    }
+    free(zeros);
+    free(changed);
+    fclose(fp);
+    return failures;
+}
+
+static int bench_hexdump(void) {
+    static const size_t sizes[] = { 256, 65536, 1024 * 1024 };
+    const size_t max_size = 1024 * 1024;
+    uint8_t *bytes = malloc(max_size);
+    FILE *null_fp = fopen("/dev/null", "w");
+    int failures;
+
+    if (!bytes || !null_fp) {
+        free(bytes);
+        if (null_fp) {
+            fclose(null_fp);
+        }
+        return 1;
+    }
+    for (size_t i = 0; i < max_size; i++) {
+        bytes[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+
+    failures = hexdump_verify(bytes);
+    printf("Verify: %s (%d mismatches)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    if (failures > 0) {
+        free(bytes);
+        fclose(null_fp);
+        return 1;
+    }
+
+    // 출력 대상은 /dev/null (포맷 비용만 측정)
+    printf("\n%-10s %14s %14s\n", "Size", "fprintf/byte", "formatter");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        uint32_t iterations = bench_iterations(size) / 256 + 1;
+        double t0, t_printf, t_format;
+
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            hexdump_printf(null_fp, bytes, size, "  ");
+        }
+        fflush(null_fp);
+        t_printf = now_sec() - t0;
+
+        const CFS_HexDumpOptions_t opts = { "  ", 0, NULL, 0 };
+        t0 = now_sec();
+        for (uint32_t i = 0; i < iterations; i++) {
+            (void)CFS_HexDump_Write(fileno(null_fp), bytes, size, &opts);
+        }
+        t_format = now_sec() - t0;
+
+        printf("%-10zu %11.2f ms %11.2f ms\n", size,
+               t_printf * 1e3 / iterations, t_format * 1e3 / iterations);
+    }
+
+    free(bytes);
+    fclose(null_fp);
+    return 0;
+}
+
+static uint64_t process_faults(void) {
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? (uint64_t)(usage.ru_minflt + usage.ru_majflt) : 0;
+}
+
+// 흩어진 쓰기 → Reset → 모두 0, 이미지 복원은 Reset 후에도 그대로
+static int arena_verify(const uint8_t *src) {
+    static const uint64_t addrs[] = { 0x20000000, 0x2007FFF0, 0x20080000, 0x60000000, 0x601FFFFE,
+                                      0x63FFF000, 0x67FFF000 };
+    uint8_t readback[4096];
+    int failures = 0;
+
+    CFS_SimMem_Release();
+    for (size_t i = 0; i < sizeof(addrs) / sizeof(addrs[0]); i++) {
+        uint32_t size = (addrs[i] & 0xFFF) ? 16 : 4096;
+        if (CFS_SimMem_Write(addrs[i], src, size) != CFE_SUCCESS) {
+            failures++;
+        }
+    }
+    CFS_SimMemImage_t *image = CFS_SimMem_CaptureImage();
+    CFS_SimMem_Reset();
+    for (size_t i = 0; i < sizeof(addrs) / sizeof(addrs[0]); i++) {
+        uint32_t size = (addrs[i] & 0xFFF) ? 16 : 4096;
+        CFS_SimMem_Read(addrs[i], readback, size);
+        for (uint32_t k = 0; k < size; k++) {
+            if (readback[k] != 0) {
+                failures++;
+                break;
+            }
+        }
+    }
+    if (!image || CFS_SimMem_RestoreImage(image) != CFE_SUCCESS) {
+        failures++;
+    } else {
+        for (size_t i = 0; i < sizeof(addrs) / sizeof(addrs[0]); i++) {
+            uint32_t size = (addrs[i] & 0xFFF) ? 16 : 4096;
+            CFS_SimMem_Read(addrs[i], readback, size);
+            if (memcmp(readback, src, size) != 0) {
+                failures++;
+            }
+        }
+    }
+    CFS_SimMem_FreeImage(image);
+    CFS_SimMem_Release();
+
+    printf("Verify: %s (%d mismatches)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
+
+/*
+ * SDRAM_EXTERNAL 앞 64MB 에 이어지는 1MB 로드 64 번
+ *   cold  - 새 아레나 (첫 접근 폴트 포함)
+ *   warm  - Reset 후 같은 위치 (매핑과 미리 폴트 유지)
+ *   reset - 쓴 64MB 를 0 으로 되돌리는 시간
+ */
+static int bench_arena(void) {
+    static const struct {
+        const char          *name;
+        CFS_ArenaHugeMode_t  huge;
+        uint32_t             prefault_kb;
+    } modes[] = {
+        { "4KB demand",   CFS_ARENA_HUGE_OFF,      0 },
+        { "4KB prefault", CFS_ARENA_HUGE_OFF,      CFS_ARENA_DEFAULT_PREFAULT_KB },
+        { "thp",          CFS_ARENA_HUGE_THP,      CFS_ARENA_DEFAULT_PREFAULT_KB },
+        { "hugetlb",      CFS_ARENA_HUGE_EXPLICIT, CFS_ARENA_DEFAULT_PREFAULT_KB },
+    };
+    const uint32_t size = 1024 * 1024;
+    const uint32_t loads = 64;
+    uint8_t *src = malloc(size);
+
+    if (!src) {
+        return 1;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        src[i] = (uint8_t)(i * 131u + (i >> 9));
+    }
+    if (arena_verify(src) != 0) {
+        free(src);
+        return 1;
+    }
+
+    printf("\n%-13s %-10s %10s %8s %10s %8s %10s\n", "Arena", "backing", "cold", "faults",
+           "warm", "faults", "reset");
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        uint64_t maps_before[CFS_ARENA_BACKING_COUNT];
+        double t0, t_cold, t_warm, t_reset;
+        uint64_t f0, f_cold, f_warm;
+
+        CFS_SimMem_Release();
+        CFS_Arena_Configure(modes[m].huge, modes[m].prefault_kb);
+        memcpy(maps_before, CFS_Arena_GetStats()->maps, sizeof(maps_before));
+
+        f0 = process_faults();
+        t0 = now_sec();
+        for (uint32_t i = 0; i < loads; i++) {
+            CFS_SimMem_LoadStream(0x60000000ULL + (uint64_t)i * size, src, size, MM_MAX_UNINTERRUPTIBLE_DATA,
+                                  CFS_SIMMEM_LOAD_STREAM, 0, NULL);
+        }
+        t_cold = now_sec() - t0;
+        f_cold = process_faults() - f0;
+
+        // SDRAM 영역을 받은 방식 (모드가 안 되면 다음 방식으로 내려감)
+        int backing = CFS_ARENA_BACKING_PAGES;
+        for (int b = 0; b < CFS_ARENA_BACKING_COUNT; b++) {
+            if (CFS_Arena_GetStats()->maps[b] != maps_before[b]) {
+                backing = b;
+            }
+        }
+
+        t0 = now_sec();
+        CFS_SimMem_Reset();
+        t_reset = now_sec() - t0;
+
+        f0 = process_faults();
+        t0 = now_sec();
+        for (uint32_t i = 0; i < loads; i++) {
+            CFS_SimMem_LoadStream(0x60000000ULL + (uint64_t)i * size, src, size, MM_MAX_UNINTERRUPTIBLE_DATA,
+                                  CFS_SIMMEM_LOAD_STREAM, 0, NULL);
+        }
+        t_warm = now_sec() - t0;
+        f_warm = process_faults() - f0;
+
+        printf("%-13s %-10s %7.2f ms %8lu %7.2f ms %8lu %7.2f ms\n", modes[m].name,
+               CFS_Arena_BackingName((CFS_ArenaBacking_t)backing), t_cold * 1e3, f_cold,
+               t_warm * 1e3, f_warm, t_reset * 1e3);
+    }
+
+    CFS_SimMem_Release();
+    CFS_Arena_Configure(CFS_ARENA_HUGE_AUTO, CFS_ARENA_DEFAULT_PREFAULT_KB);
+    free(src);
+    return 0;
+}
+
+static void usage(const char *prog) {
+    printf("Usage: %s <benchmark>\n", prog);
+    printf("Benchmarks:\n");
+    printf("  fill     Fill engine vs memset and byte loop (MM_FillMemCmd)\n");
+    printf("  dump     Dump file emission: buffered vs zero-copy VFS vs tmpfs writev\n");
+    printf("  load     Single-pass streaming CRC + copy vs multi-pass load (MM_LoadMemFromFileCmd)\n");
+    printf("  decode   Input field decode: modulo + string assembly vs precomputed tables\n");
+    printf("  hexdump  Hex dump: fprintf per byte vs block formatter (crash reports)\n");
+    printf("  rng      Random payload generation: srand/rand vs per-context PRNG\n");
+    printf("  arena    Simulated memory arenas: demand paging vs prefault vs hugepages, reset cost\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (strcmp(argv[1], "fill") == 0) {
+        return bench_fill();
+    }
+    if (strcmp(argv[1], "dump") == 0) {
+        return bench_dump();
+    }
+    if (strcmp(argv[1], "load") == 0) {
+        return bench_load();
+    }
+    if (strcmp(argv[1], "decode") == 0) {
+        return bench_decode();
+    }
+    if (strcmp(argv[1], "hexdump") == 0) {
+        return bench_hexdump();
+    }
+    if (strcmp(argv[1], "rng") == 0) {
+        return bench_rng();
+    }
+    if (strcmp(argv[1], "arena") == 0) {
+        return bench_arena();
+    }
+
+    usage(argv[0]);
+    return 1;
+}